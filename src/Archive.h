@@ -6,7 +6,12 @@
 
 #include "Traits.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 #if (!defined ISLITTLEENDIAN)
 # define ISLITTLEENDIAN 1
@@ -17,6 +22,9 @@ static bool constexpr is_little_endian = bool(ISLITTLEENDIAN);
 namespace Microsoft {
 namespace Featurizer {
 
+template <typename T>
+class ArchiveArray;
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         Archive
 ///  \brief         Object that can be used when serializing and deserializing
@@ -43,6 +51,9 @@ public:
 
     using ByteArray                         = std::vector<unsigned char>;
 
+    // Keeps the memory referenced by a deserializing `Archive` alive
+    using BufferOwner                       = std::shared_ptr<void const>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Types
@@ -59,6 +70,15 @@ public:
     Archive(ByteArray data);
     Archive(unsigned char const *pBuffer, size_t cbBuffer);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Archive
+    ///  \brief         Deserializes from a buffer that is kept alive by `pOwner`
+    ///                 (for example, a `MemoryMappedFile`). The buffer isn't
+    ///                 copied, and arrays written by `serialize_array` are
+    ///                 referenced in place rather than copied.
+    ///
+    Archive(BufferOwner pOwner, unsigned char const *pBuffer, size_t cbBuffer);
+
     ~Archive(void) = default;
 
     Archive(Archive const &) = delete;
@@ -71,6 +91,14 @@ public:
     Archive & serialize(unsigned char const *pBuffer, size_t cBuffer);
     template <typename T> Archive & serialize(T const &value);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            serialize_array
+    ///  \brief         Serializes the items so that they are aligned relative to
+    ///                 the start of the archive, which allows them to be used in
+    ///                 place when deserialized (see `deserialize_array`).
+    ///
+    template <typename T> Archive & serialize_array(T const *pItems, size_t cItems);
+
     ByteArray commit(void);
 
     // Methods valid when `Mode` is `ModeValue::Deserialzing`
@@ -79,6 +107,15 @@ public:
 
     template <typename T> T deserialize(void);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            deserialize_array
+    ///  \brief         Deserializes items written by `serialize_array`. The
+    ///                 result references the archive's buffer (and keeps it
+    ///                 alive) when the buffer has an owner and the items are
+    ///                 suitably aligned; otherwise, the items are copied.
+    ///
+    template <typename T> ArchiveArray<T> deserialize_array(void);
+
     bool AtEnd(void) const;
 
 private:
@@ -87,8 +124,14 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
+    // Alignment of the items written by `serialize_array`; large enough for
+    // vectorized access.
+    static constexpr size_t const           ArrayAlignment = 16;
+
     ByteArray                               _buffer;
+    BufferOwner const                       _pOwner;
 
+    unsigned char const * const             _pBeginBuffer;
     unsigned char const *                   _pBuffer;
     unsigned char const * const             _pEndBuffer;
 
@@ -102,6 +145,81 @@ private:
 
     template <typename T> T deserialize_impl(std::true_type);
     template <typename T> T deserialize_impl(std::false_type);
+
+    size_t get_array_padding(size_t offset) const;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ArchiveArray
+///  \brief         Immutable array returned by `Archive::deserialize_array`.
+///                 The items either reference memory that the array keeps
+///                 alive (such as a memory-mapped file) or are owned by the
+///                 array itself.
+///
+template <typename T>
+class ArchiveArray {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    static_assert(std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false, "T must be a non-bool arithmetic type");
+
+    using value_type                        = T;
+    using const_iterator                    = T const *;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ArchiveArray(void);
+    explicit ArchiveArray(std::vector<T> items);
+    ArchiveArray(Archive::BufferOwner pOwner, T const *pItems, size_t cItems);
+
+    ~ArchiveArray(void) = default;
+
+    ArchiveArray(ArchiveArray const &) = delete;
+    ArchiveArray & operator =(ArchiveArray const &) = delete;
+
+    // Moved-from arrays are empty
+    ArchiveArray(ArchiveArray &&other);
+    ArchiveArray & operator =(ArchiveArray &&other);
+
+    bool operator==(ArchiveArray const &other) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            is_in_place
+    ///  \brief         Returns true if the items reference memory owned by
+    ///                 another object rather than by this array.
+    ///
+    bool is_in_place(void) const;
+
+    T const * data(void) const;
+    size_t size(void) const;
+    bool empty(void) const;
+
+    const_iterator begin(void) const;
+    const_iterator end(void) const;
+
+    T const & operator[](size_t index) const;
+    T const & front(void) const;
+    T const & back(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<T>                          _items;             // Empty when in place
+    Archive::BufferOwner                    _pOwner;            // Null when not in place
+
+    // Moving `_items` doesn't invalidate its data, so these remain valid in
+    // the destination when the array is moved.
+    T const *                               _pItems;
+    size_t                                  _cItems;
 };
 
 // ----------------------------------------------------------------------
@@ -125,6 +243,7 @@ inline Archive::Archive(size_t cReservedSize) :
             return result;
         }()
     ),
+    _pBeginBuffer(nullptr),
     _pBuffer(nullptr),
     _pEndBuffer(nullptr) {
 }
@@ -132,12 +251,32 @@ inline Archive::Archive(size_t cReservedSize) :
 inline Archive::Archive(ByteArray data) :
     Mode(ModeValue::Deserializing),
     _buffer(std::move(data)),
-    _pBuffer(_buffer.data()),
+    _pBeginBuffer(_buffer.data()),
+    _pBuffer(_pBeginBuffer),
     _pEndBuffer(_pBuffer + _buffer.size()) {
 }
 
 inline Archive::Archive(unsigned char const *pBuffer, size_t cbBuffer) :
     Mode(ModeValue::Deserializing),
+    _pBeginBuffer(pBuffer),
+    _pBuffer(pBuffer),
+    _pEndBuffer(_pBuffer + cbBuffer)
+{
+    if((pBuffer == nullptr && cbBuffer != 0) || (pBuffer != nullptr && cbBuffer == 0))
+        throw std::invalid_argument("Invalid input buffer");
+}
+
+inline Archive::Archive(BufferOwner pOwner, unsigned char const *pBuffer, size_t cbBuffer) :
+    Mode(ModeValue::Deserializing),
+    _pOwner(
+        [&pOwner](void) -> BufferOwner & {
+            if(!pOwner)
+                throw std::invalid_argument("pOwner");
+
+            return pOwner;
+        }()
+    ),
+    _pBeginBuffer(pBuffer),
     _pBuffer(pBuffer),
     _pEndBuffer(_pBuffer + cbBuffer)
 {
@@ -162,6 +301,32 @@ Archive & Archive::serialize(T const &value) {
     return serialize_impl(value, std::integral_constant<bool, ISLITTLEENDIAN>());
 }
 
+template <typename T>
+Archive & Archive::serialize_array(T const *pItems, size_t cItems) {
+    static_assert(std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false, "T must be a non-bool arithmetic type");
+
+    if(Mode != ModeValue::Serializing)
+        throw std::runtime_error("Invalid mode");
+
+    if(pItems == nullptr && cItems != 0)
+        throw std::invalid_argument("Invalid buffer");
+
+    serialize(static_cast<std::uint64_t>(cItems));
+
+    _buffer.resize(_buffer.size() + get_array_padding(_buffer.size()), 0);
+
+    if(ISLITTLEENDIAN) {
+        if(cItems)
+            serialize(reinterpret_cast<unsigned char const *>(pItems), cItems * sizeof(T));
+    }
+    else {
+        for(size_t index = 0; index < cItems; ++index)
+            serialize(pItems[index]);
+    }
+
+    return *this;
+}
+
 inline Archive::ByteArray Archive::commit(void) {
     if(Mode != ModeValue::Serializing)
         throw std::runtime_error("Invalid mode");
@@ -174,6 +339,32 @@ T Archive::deserialize(void) {
     return deserialize_impl<T>(std::integral_constant<bool, ISLITTLEENDIAN>());
 }
 
+template <typename T>
+ArchiveArray<T> Archive::deserialize_array(void) {
+    std::uint64_t const                     cItems(deserialize<std::uint64_t>());
+
+    update_buffer_ptr(get_array_padding(static_cast<size_t>(_pBuffer - _pBeginBuffer)));
+
+    if(cItems > static_cast<std::uint64_t>(_pEndBuffer - _pBuffer) / sizeof(T))
+        throw std::runtime_error("Invalid buffer");
+
+    T const * const                         pItems(reinterpret_cast<T const *>(_pBuffer));
+
+    if(ISLITTLEENDIAN && _pOwner && reinterpret_cast<std::uintptr_t>(pItems) % alignof(T) == 0) {
+        _pBuffer += cItems * sizeof(T);
+        return ArchiveArray<T>(_pOwner, pItems, static_cast<size_t>(cItems));
+    }
+
+    std::vector<T>                          items;
+
+    items.reserve(static_cast<size_t>(cItems));
+
+    for(std::uint64_t index = 0; index < cItems; ++index)
+        items.emplace_back(deserialize<T>());
+
+    return ArchiveArray<T>(std::move(items));
+}
+
 inline unsigned char const * Archive::get_buffer_ptr(void) const {
     if(Mode != ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
@@ -204,6 +395,133 @@ inline bool Archive::AtEnd(void) const {
     return _pBuffer == _pEndBuffer;
 }
 
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline size_t Archive::get_array_padding(size_t offset) const {
+    return (ArrayAlignment - offset % ArrayAlignment) % ArrayAlignment;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ArchiveArray
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+ArchiveArray<T>::ArchiveArray(void) :
+    _pItems(nullptr),
+    _cItems(0) {
+}
+
+template <typename T>
+ArchiveArray<T>::ArchiveArray(std::vector<T> items) :
+    _items(std::move(items)),
+    _pItems(_items.data()),
+    _cItems(_items.size()) {
+}
+
+template <typename T>
+ArchiveArray<T>::ArchiveArray(Archive::BufferOwner pOwner, T const *pItems, size_t cItems) :
+    _pOwner(
+        [&pOwner](void) -> Archive::BufferOwner & {
+            if(!pOwner)
+                throw std::invalid_argument("pOwner");
+
+            return pOwner;
+        }()
+    ),
+    _pItems(
+        [&pItems, &cItems](void) {
+            if(pItems == nullptr && cItems != 0)
+                throw std::invalid_argument("pItems");
+
+            return pItems;
+        }()
+    ),
+    _cItems(cItems) {
+}
+
+template <typename T>
+ArchiveArray<T>::ArchiveArray(ArchiveArray &&other) :
+    _items(std::move(other._items)),
+    _pOwner(std::move(other._pOwner)),
+    _pItems(other._pItems),
+    _cItems(other._cItems) {
+    other._items.clear();
+    other._pItems = nullptr;
+    other._cItems = 0;
+}
+
+template <typename T>
+ArchiveArray<T> & ArchiveArray<T>::operator =(ArchiveArray &&other) {
+    if(this != &other) {
+        _items = std::move(other._items);
+        _pOwner = std::move(other._pOwner);
+        _pItems = other._pItems;
+        _cItems = other._cItems;
+
+        other._items.clear();
+        other._pOwner.reset();
+        other._pItems = nullptr;
+        other._cItems = 0;
+    }
+
+    return *this;
+}
+
+template <typename T>
+bool ArchiveArray<T>::operator==(ArchiveArray const &other) const {
+    return _cItems == other._cItems && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T>
+bool ArchiveArray<T>::is_in_place(void) const {
+    return static_cast<bool>(_pOwner);
+}
+
+template <typename T>
+T const * ArchiveArray<T>::data(void) const {
+    return _pItems;
+}
+
+template <typename T>
+size_t ArchiveArray<T>::size(void) const {
+    return _cItems;
+}
+
+template <typename T>
+bool ArchiveArray<T>::empty(void) const {
+    return _cItems == 0;
+}
+
+template <typename T>
+typename ArchiveArray<T>::const_iterator ArchiveArray<T>::begin(void) const {
+    return _pItems;
+}
+
+template <typename T>
+typename ArchiveArray<T>::const_iterator ArchiveArray<T>::end(void) const {
+    return _pItems + _cItems;
+}
+
+template <typename T>
+T const & ArchiveArray<T>::operator[](size_t index) const {
+    assert(index < _cItems);
+    return _pItems[index];
+}
+
+template <typename T>
+T const & ArchiveArray<T>::front(void) const {
+    assert(_cItems);
+    return _pItems[0];
+}
+
+template <typename T>
+T const & ArchiveArray<T>::back(void) const {
+    assert(_cItems);
+    return _pItems[_cItems - 1];
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
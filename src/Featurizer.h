@@ -7,6 +7,8 @@
 #include <cstring>                          // For `strcmp`
 #include <memory>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -118,6 +120,14 @@ private:
 ///                 This derived class provides functionality common where
 ///                 there is only one output for each input.
 ///
+///                 A derived class may also provide a non-virtual
+///                 `TransformedType transform(InputType const &input)` method
+///                 that returns the output directly. Callers that know the
+///                 concrete type (such as `PipelineExecutionTransformer`) invoke
+///                 it rather than `execute`, avoiding the virtual call and callback.
+///                 Such classes should also implement `execute_batch_impl` in
+///                 terms of `execute_batch_transform`.
+///
 template <typename InputT, typename TransformedT>
 class StandardTransformer : public Transformer<InputT, TransformedT> {
 public:
@@ -146,13 +156,53 @@ public:
     TransformedType execute(InputType const &input);
     using BaseType::execute;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cInputs` contiguous values, writing the
+    ///                 result for `pInputs[i]` to `pOutputs[i]`. When
+    ///                 `TransformedType` is move assignable, `pOutputs` must
+    ///                 reference `cInputs` constructed values that are assigned;
+    ///                 otherwise, it must reference uninitialized storage for
+    ///                 `cInputs` values that are constructed in place (and
+    ///                 destroyed again if an exception is thrown).
+    ///
+    void execute_batch(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs);
+
+protected:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Protected Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch_transform
+    ///  \brief         `execute_batch_impl` implementation for `Transformers`
+    ///                 that provide a `transform` method.
+    ///
+    template <typename TransformerT>
+    static void execute_batch_transform(TransformerT &transformer, InputType const *pInputs, size_t cInputs, TransformedType *pOutputs);
+
 private:
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    using IsMoveAssignableOutput            = std::integral_constant<bool, std::is_move_assignable<TransformedType>::value>;
+
     void flush_impl(CallbackFunction const &callback) override;
+
+    // The default implementation invokes `execute` for each input; `Transformers`
+    // whose work per row is trivial should override this method with a loop that
+    // avoids the per-row virtual call and callback.
+    virtual void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs);
+
+    static void assign_output(TransformedType *pOutput, TransformedType value, std::true_type /*is_move_assignable*/);
+    static void assign_output(TransformedType *pOutput, TransformedType value, std::false_type /*is_move_assignable*/);
+
+    static void destroy_outputs(TransformedType *pBeginOutputs, TransformedType *pEndOutputs, std::true_type /*is_move_assignable*/);
+    static void destroy_outputs(TransformedType *pBeginOutputs, TransformedType *pEndOutputs, std::false_type /*is_move_assignable*/);
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -191,19 +241,112 @@ using AnnotationPtr                         = std::shared_ptr<Annotation>;
 // `Estimators` with the same name may generate different Annotations based on
 // the settings provided when it was constructed...
 using AnnotationPtrs                        = std::vector<AnnotationPtr>;
-// TODO: Updating the vector should be thread safe when executing the DAGs in parallel.
 
 namespace Details {
 
 struct RawStringComparison {
-    inline bool operator()(char const *p1, char const *p2) const { return strcmp(p1, p2) < 0; }
+    inline bool operator()(char const *p1, char const *p2) const { return p1 != p2 && strcmp(p1, p2) < 0; }
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            InternAnnotationName
+///  \brief         Returns a process-wide copy of `name`. The same pointer
+///                 is returned for all strings that compare as equal, and the
+///                 pointer remains valid for the lifetime of the process.
+///
+char const * InternAnnotationName(char const *name);
+
 } // namespace Details
 
-// A single column supports `Annotations` from different `Estimators`...
-using AnnotationMap                         = std::map<char const *, AnnotationPtrs, Details::RawStringComparison>;
-// TODO: Updating the map should be thread safe when executing the DAGs in parallel.
+/////////////////////////////////////////////////////////////////////////
+///  \class         AnnotationMap
+///  \brief         A single column supports `Annotations` from different `Estimators`,
+///                 keyed by the `Estimator`'s name.
+///
+///                 All methods are synchronized, so that `Estimators` within a
+///                 DAG can be trained (and completed) in parallel. Entries are
+///                 only accessible through methods that hold the lock; lookups
+///                 return the `Annotations` rather than iterators into the map.
+///
+///                 Keys are interned (see `Details::InternAnnotationName`), so
+///                 they remain valid after the `Estimator` that added them has
+///                 been destroyed.
+///
+class AnnotationMap : private std::map<char const *, AnnotationPtrs, Details::RawStringComparison> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                          = std::map<char const *, AnnotationPtrs, Details::RawStringComparison>;
+
+    using typename BaseType::size_type;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    AnnotationMap(void) = default;
+    ~AnnotationMap(void) = default;
+
+    AnnotationMap(AnnotationMap const &other);
+    AnnotationMap(AnnotationMap &&other);
+
+    AnnotationMap & operator=(AnnotationMap const &other);
+    AnnotationMap & operator=(AnnotationMap &&other);
+
+    bool empty(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            size
+    ///  \brief         Returns the number of `Estimators` that have added
+    ///                 `Annotations`.
+    ///
+    size_type size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            add_annotation
+    ///  \brief         Adds an `Annotation` produced by the named `Estimator`.
+    ///                 This method is thread safe.
+    ///
+    void add_annotation(char const *name, AnnotationPtr pAnnotation);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_annotation
+    ///  \brief         Returns the first `Annotation` produced by the named
+    ///                 `Estimator` that is a `DerivedAnnotationT`, or nullptr
+    ///                 if one doesn't exist. This method is thread safe; the
+    ///                 result shares ownership of the `Annotation`, so it remains
+    ///                 valid if the `Annotation` is concurrently removed.
+    ///
+    template <typename DerivedAnnotationT>
+    std::shared_ptr<DerivedAnnotationT> get_annotation(char const *name) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_annotations
+    ///  \brief         Returns all `Annotations` produced by the named `Estimator`,
+    ///                 in the order in which they were added. The result is empty
+    ///                 if the `Estimator` hasn't added any.
+    ///
+    AnnotationPtrs get_annotations(char const *name) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            remove_annotations
+    ///  \brief         Removes and returns all `Annotations` produced by the named
+    ///                 `Estimator`.
+    ///
+    AnnotationPtrs remove_annotations(char const *name);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    mutable std::mutex                      _mutex;
+};
 
 // An `Estimator` may support multiple columns...
 using AnnotationMaps                        = std::vector<AnnotationMap>;
@@ -292,6 +435,10 @@ protected:
     ///                 Unfortunately, nonstd::optional doesn't support reference types.
     ///                 Consider the return value to be a potentially null pointer.
     ///
+    ///                 The pointer is not owned; it is only valid while the
+    ///                 `Annotation` remains in `allAnnotations`, so the `Annotations`
+    ///                 produced by `name` must not be removed while it is in use.
+    ///
     template <typename DerivedAnnotationT>
     static DerivedAnnotationT * get_annotation_impl(AnnotationMaps const &allAnnotations, size_t colIndex, char const *name);
 
@@ -522,6 +669,163 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Details
+// |
+// ----------------------------------------------------------------------
+inline char const * Details::InternAnnotationName(char const *name) {
+    // ----------------------------------------------------------------------
+    using LockGuard                         = std::lock_guard<std::mutex>;
+    // ----------------------------------------------------------------------
+
+    // Names are never removed, so pointers to the strings remain valid
+    static std::mutex                       mutex;
+    static std::set<std::string>            names;
+
+    LockGuard                               lock(mutex);
+
+    return names.emplace(name).first->c_str();
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  AnnotationMap
+// |
+// ----------------------------------------------------------------------
+inline AnnotationMap::AnnotationMap(AnnotationMap const &other) :
+    BaseType(
+        [&other](void) {
+            std::lock_guard<std::mutex>     lock(other._mutex);
+
+            return static_cast<BaseType const &>(other);
+        }()
+    ) {
+}
+
+inline AnnotationMap::AnnotationMap(AnnotationMap &&other) :
+    BaseType(
+        [&other](void) {
+            std::lock_guard<std::mutex>     lock(other._mutex);
+
+            return std::move(static_cast<BaseType &>(other));
+        }()
+    ) {
+}
+
+inline AnnotationMap & AnnotationMap::operator=(AnnotationMap const &other) {
+    if(this != &other) {
+        std::lock(_mutex, other._mutex);
+
+        std::lock_guard<std::mutex>         lock1(_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex>         lock2(other._mutex, std::adopt_lock);
+
+        static_cast<BaseType &>(*this) = static_cast<BaseType const &>(other);
+    }
+
+    return *this;
+}
+
+inline AnnotationMap & AnnotationMap::operator=(AnnotationMap &&other) {
+    if(this != &other) {
+        std::lock(_mutex, other._mutex);
+
+        std::lock_guard<std::mutex>         lock1(_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex>         lock2(other._mutex, std::adopt_lock);
+
+        static_cast<BaseType &>(*this) = std::move(static_cast<BaseType &>(other));
+    }
+
+    return *this;
+}
+
+inline bool AnnotationMap::empty(void) const {
+    std::lock_guard<std::mutex>             lock(_mutex);
+
+    return BaseType::empty();
+}
+
+inline AnnotationMap::size_type AnnotationMap::size(void) const {
+    std::lock_guard<std::mutex>             lock(_mutex);
+
+    return BaseType::size();
+}
+
+inline void AnnotationMap::add_annotation(char const *name, AnnotationPtr pAnnotation) {
+    if(name == nullptr || *name == 0)
+        throw std::invalid_argument("name");
+    if(!pAnnotation)
+        throw std::invalid_argument("pAnnotation");
+
+    std::lock_guard<std::mutex>             lock(_mutex);
+    iterator                                iter(BaseType::find(name));
+
+    if(iter == BaseType::end()) {
+        std::pair<iterator, bool> const     result(BaseType::emplace(std::make_pair(Details::InternAnnotationName(name), AnnotationPtrs())));
+
+        if(result.first == BaseType::end() || result.second == false)
+            throw std::runtime_error("Invalid insertion");
+
+        iter = result.first;
+    }
+
+    iter->second.emplace_back(std::move(pAnnotation));
+}
+
+template <typename DerivedAnnotationT>
+std::shared_ptr<DerivedAnnotationT> AnnotationMap::get_annotation(char const *name) const {
+    if(name == nullptr || *name == 0)
+        throw std::invalid_argument("name");
+
+    std::lock_guard<std::mutex>             lock(_mutex);
+    const_iterator const                    iter(BaseType::find(name));
+
+    if(iter != BaseType::end()) {
+        for(auto const &annotation : iter->second) {
+            std::shared_ptr<DerivedAnnotationT>     result(std::dynamic_pointer_cast<DerivedAnnotationT>(annotation));
+
+            if(result)
+                return result;
+        }
+    }
+
+    return std::shared_ptr<DerivedAnnotationT>();
+}
+
+inline AnnotationPtrs AnnotationMap::get_annotations(char const *name) const {
+    if(name == nullptr || *name == 0)
+        throw std::invalid_argument("name");
+
+    std::lock_guard<std::mutex>             lock(_mutex);
+    const_iterator const                    iter(BaseType::find(name));
+
+    if(iter == BaseType::end())
+        return AnnotationPtrs();
+
+    return iter->second;
+}
+
+inline AnnotationPtrs AnnotationMap::remove_annotations(char const *name) {
+    if(name == nullptr || *name == 0)
+        throw std::invalid_argument("name");
+
+    std::lock_guard<std::mutex>             lock(_mutex);
+    iterator const                          iter(BaseType::find(name));
+
+    if(iter == BaseType::end())
+        return AnnotationPtrs();
+
+    AnnotationPtrs                          result(std::move(iter->second));
+
+    BaseType::erase(iter);
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  CreateTestAnnotationMapsPtr
+// |
+// ----------------------------------------------------------------------
 inline AnnotationMapsPtr CreateTestAnnotationMapsPtr(size_t numCols) {
     AnnotationMaps                          maps;
 
@@ -589,6 +893,37 @@ typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTran
     return execute(value);
 }
 
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::execute_batch(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) {
+    if(cInputs == 0)
+        return;
+
+    if(pInputs == nullptr)
+        throw std::invalid_argument("pInputs");
+    if(pOutputs == nullptr)
+        throw std::invalid_argument("pOutputs");
+
+    execute_batch_impl(pInputs, cInputs, pOutputs);
+}
+
+template <typename InputT, typename TransformedT>
+template <typename TransformerT>
+/*static*/ void StandardTransformer<InputT, TransformedT>::execute_batch_transform(TransformerT &transformer, InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) {
+    InputType const * const                 pEndInputs(pInputs + cInputs);
+    TransformedType * const                 pBeginOutputs(pOutputs);
+
+    try {
+        while(pInputs != pEndInputs) {
+            assign_output(pOutputs, transformer.transform(*pInputs++), IsMoveAssignableOutput());
+            ++pOutputs;
+        }
+    }
+    catch(...) {
+        destroy_outputs(pBeginOutputs, pOutputs, IsMoveAssignableOutput());
+        throw;
+    }
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -597,6 +932,58 @@ void StandardTransformer<InputT, TransformedT>::flush_impl(CallbackFunction cons
     // This method doesn't do anything for StandardTransformers
 }
 
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) {
+    InputType const * const                 pEndInputs(pInputs + cInputs);
+    TransformedType * const                 pBeginOutputs(pOutputs);
+
+    try {
+        while(pInputs != pEndInputs) {
+            bool                            isSet(false);
+
+            execute(
+                *pInputs++,
+                [&pOutputs, &isSet](TransformedType value) {
+                    assert(isSet == false);
+                    assign_output(pOutputs, std::move(value), IsMoveAssignableOutput());
+                    isSet = true;
+                }
+            );
+
+            assert(isSet);
+            ++pOutputs;
+        }
+    }
+    catch(...) {
+        destroy_outputs(pBeginOutputs, pOutputs, IsMoveAssignableOutput());
+        throw;
+    }
+}
+
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::assign_output(TransformedType *pOutput, TransformedType value, std::true_type /*is_move_assignable*/) {
+    *pOutput = std::move(value);
+}
+
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::assign_output(TransformedType *pOutput, TransformedType value, std::false_type /*is_move_assignable*/) {
+    // Types created with FEATURIZER_MOVE_CONSTRUCTOR_ONLY can't be assigned, so
+    // `pOutput` references uninitialized storage.
+    new (static_cast<void *>(pOutput)) TransformedType(std::move(value));
+}
+
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::destroy_outputs(TransformedType *, TransformedType *, std::true_type /*is_move_assignable*/) {
+    // Assigned values are owned by the caller
+}
+
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::destroy_outputs(TransformedType *pBeginOutputs, TransformedType *pEndOutputs, std::false_type /*is_move_assignable*/) {
+    // Return the storage to the caller in the state that it was received
+    while(pBeginOutputs != pEndOutputs)
+        (pBeginOutputs++)->~TransformedType();
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Estimator
@@ -636,31 +1023,12 @@ inline Estimator::Estimator(char const *name, AnnotationMapsPtr pAllColumnAnnota
 
     AnnotationMaps &                        allAnnotations(*allColumnAnnotations);
 
+    // The number of columns doesn't change once the `AnnotationMaps` are
+    // shared, so only the column's map needs to be synchronized.
     if(colIndex >= allAnnotations.size())
         throw std::invalid_argument("colIndex");
 
-    AnnotationPtrs &                        annotations(
-        [&allAnnotations, &colIndex, &name](void) -> AnnotationPtrs & {
-            AnnotationMap &                 columnAnnotations(allAnnotations[colIndex]);
-
-            // TODO: Acquire read map lock
-            AnnotationMap::iterator const   iter(columnAnnotations.find(name));
-
-            if(iter != columnAnnotations.end())
-                return iter->second;
-
-            // TODO: Promote read lock to write lock
-            std::pair<AnnotationMap::iterator, bool> const result(columnAnnotations.emplace(std::make_pair(name, AnnotationPtrs())));
-
-            if(result.first == columnAnnotations.end() || result.second == false)
-                throw std::runtime_error("Invalid insertion");
-
-            return result.first->second;
-        }()
-    );
-
-    // TODO: Acquire vector read lock
-    annotations.emplace_back(std::move(pAnnotation));
+    allAnnotations[colIndex].add_annotation(name, std::move(pAnnotation));
 }
 
 inline void Estimator::add_annotation(AnnotationPtr pAnnotation, size_t colIndex) const {
@@ -674,23 +1042,7 @@ DerivedAnnotationT * Estimator::get_annotation_impl(AnnotationMaps const &allAnn
     if(name == nullptr || *name == 0)
         throw std::invalid_argument("name");
 
-    AnnotationMap const &                   columnAnnotations(allAnnotations[colIndex]);
-
-    // TODO: Acquire read map lock
-    AnnotationMap::const_iterator const     column_annotations_iter(columnAnnotations.find(name));
-
-    if(column_annotations_iter != columnAnnotations.end()) {
-        AnnotationPtrs const &              annotations(column_annotations_iter->second);
-
-        // TODO: Acquire vector read lock
-
-        for(auto const &annotation : annotations) {
-            if(dynamic_cast<DerivedAnnotationT *>(annotation.get()) != nullptr)
-                return &static_cast<DerivedAnnotationT &>(*annotation);
-        }
-    }
-
-    return nullptr;
+    return allAnnotations[colIndex].get_annotation<DerivedAnnotationT>(name).get();
 }
 
 // ----------------------------------------------------------------------
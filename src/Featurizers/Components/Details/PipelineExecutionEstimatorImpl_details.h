@@ -4,6 +4,12 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
 #include "EstimatorTraits.h"
 
 namespace Microsoft {
@@ -72,6 +78,273 @@ struct ValidateEstimators<
     static constexpr bool const             value = true;
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       ChainOutputType
+///  \brief         Output type of a chain of `Estimators`.
+///
+template <typename EstimatorTupleT>
+using ChainOutputType                       = typename EstimatorOutputType<typename std::tuple_element<std::tuple_size<EstimatorTupleT>::value - 1, EstimatorTupleT>::type>::type;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         IsFusableEstimator
+///  \brief         True if the `Estimator` doesn't produce a `Transformer` or
+///                 produces a `StandardTransformer`, which generates exactly
+///                 one output for each input.
+///
+template <typename EstimatorT, bool IsTransformerEstimatorV=IsTransformerEstimator<EstimatorT>::value>
+struct IsFusableEstimator {
+    static constexpr bool const             value = true;
+};
+
+template <typename EstimatorT>
+struct IsFusableEstimator<EstimatorT, true> {
+    using TransformerType                   = typename EstimatorT::TransformerType;
+
+    static constexpr bool const             value =
+        std::is_base_of<
+            StandardTransformer<typename TransformerType::InputType, typename TransformerType::TransformedType>,
+            TransformerType
+        >::value;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         AreFusableEstimators
+///  \brief         True if every `Estimator` in the chain is fusable (see
+///                 `IsFusableEstimator`), in which case the `Transformer`
+///                 chain can be executed without callbacks.
+///
+template <int N, typename EstimatorTupleT, typename EnableIfT=void>
+struct AreFusableEstimators;
+
+template <int N, typename EstimatorTupleT>
+struct AreFusableEstimators<
+    N,
+    EstimatorTupleT,
+    typename std::enable_if<N != std::tuple_size<EstimatorTupleT>::value - 1>::type
+> {
+    static constexpr bool const             value =
+        IsFusableEstimator<typename std::tuple_element<N, EstimatorTupleT>::type>::value
+        && AreFusableEstimators<N + 1, EstimatorTupleT>::value;
+};
+
+template <int N, typename EstimatorTupleT>
+struct AreFusableEstimators<
+    N,
+    EstimatorTupleT,
+    typename std::enable_if<N == std::tuple_size<EstimatorTupleT>::value - 1>::type
+> {
+    static constexpr bool const             value = IsFusableEstimator<typename std::tuple_element<N, EstimatorTupleT>::type>::value;
+};
+
+// ----------------------------------------------------------------------
+template <typename, typename T>
+class HasTransformMethodImpl {
+    static_assert(std::integral_constant<T, false>::value, "Second template parameter must be a function type");
+};
+
+template <typename T, typename ReturnT, typename... ArgTs>
+class HasTransformMethodImpl<T, ReturnT (ArgTs...)> {
+private:
+    template <typename U> static constexpr std::false_type Check(...);
+
+    template <typename U>
+    static constexpr std::true_type Check(
+        U *,
+        typename std::enable_if<
+            std::is_same<
+                decltype(std::declval<U const &>().transform(std::declval<ArgTs>()...)),
+                ReturnT
+            >::value,
+            void *
+        >::type
+    );
+
+public:
+    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr))>::value;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HasTransformMethod
+///  \brief         True if the `StandardTransformer` provides a non-virtual
+///                 `transform` method (see `StandardTransformer`).
+///
+template <typename TransformerT>
+class HasTransformMethod : public HasTransformMethodImpl<TransformerT, typename TransformerT::TransformedType (typename TransformerT::InputType const &)> {};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         BufferChunkSource
+///  \brief         Presents a caller-provided buffer as a sequence of chunks
+///                 to the stages of a pipelined `Estimator` chain.
+///
+///                 Chunk sources implement:
+///                     bool next(ItemType const *&pItems, size_t &cItems);
+///                     void cancel(void);
+///
+///                 where `next` returns false once the source is exhausted
+///                 and `cancel` is invoked by a consumer that no longer
+///                 needs data.
+///
+template <typename T>
+class BufferChunkSource {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ItemType                          = T;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    BufferChunkSource(T const *pItems, size_t cItems, size_t chunkSize) :
+        _pItems(pItems),
+        _pEndItems(pItems + cItems),
+        _chunkSize(chunkSize) {
+        assert(_chunkSize);
+    }
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(BufferChunkSource);
+
+    bool next(T const *&pItems, size_t &cItems) {
+        if(_pItems == _pEndItems)
+            return false;
+
+        pItems = _pItems;
+        cItems = std::min(_chunkSize, static_cast<size_t>(_pEndItems - _pItems));
+
+        _pItems += cItems;
+        return true;
+    }
+
+    void cancel(void) {
+        _pItems = _pEndItems;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    T const *                               _pItems;
+    T const * const                         _pEndItems;
+    size_t const                            _chunkSize;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ChunkQueue
+///  \brief         Bounded, lock-free, single producer/single consumer queue
+///                 of chunks that connects two stages of a pipelined
+///                 `Estimator` chain; the consumer side is a chunk source
+///                 (see `BufferChunkSource`).
+///
+///                 Waiting producers and consumers yield rather than block,
+///                 as a stage is expected to be waiting only briefly.
+///
+template <typename T>
+class ChunkQueue {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ItemType                          = T;
+    using ChunkType                         = std::vector<T>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ChunkQueue(size_t maxChunks) :
+        _chunks(maxChunks),
+        _head(0),
+        _tail(0),
+        _isClosed(false),
+        _isCancelled(false) {
+        assert(maxChunks);
+    }
+
+    ChunkQueue(ChunkQueue const &) = delete;
+    ChunkQueue & operator =(ChunkQueue const &) = delete;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            push
+    ///  \brief         Adds a chunk to the queue, waiting while the queue is
+    ///                 full. Returns false if the consumer has cancelled.
+    ///
+    bool push(ChunkType chunk) {
+        size_t const                        tail(_tail.load(std::memory_order_relaxed));
+
+        while(tail - _head.load(std::memory_order_acquire) == _chunks.size()) {
+            if(_isCancelled.load(std::memory_order_acquire))
+                return false;
+
+            std::this_thread::yield();
+        }
+
+        if(_isCancelled.load(std::memory_order_acquire))
+            return false;
+
+        _chunks[tail % _chunks.size()] = std::move(chunk);
+        _tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            close
+    ///  \brief         Invoked by the producer once all chunks have been pushed.
+    ///
+    void close(void) {
+        _isClosed.store(true, std::memory_order_release);
+    }
+
+    bool next(T const *&pItems, size_t &cItems) {
+        size_t const                        head(_head.load(std::memory_order_relaxed));
+
+        while(head == _tail.load(std::memory_order_acquire)) {
+            // Check the tail again after observing the close, as the last chunk
+            // may have been pushed immediately before it.
+            if(_isClosed.load(std::memory_order_acquire) && head == _tail.load(std::memory_order_acquire))
+                return false;
+
+            std::this_thread::yield();
+        }
+
+        _current = std::move(_chunks[head % _chunks.size()]);
+        _head.store(head + 1, std::memory_order_release);
+
+        pItems = _current.data();
+        cItems = _current.size();
+
+        return true;
+    }
+
+    void cancel(void) {
+        _isCancelled.store(true, std::memory_order_release);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<ChunkType>                  _chunks;
+
+    std::atomic<size_t>                     _head;              // Written by the consumer
+    std::atomic<size_t>                     _tail;              // Written by the producer
+    std::atomic<bool>                       _isClosed;
+    std::atomic<bool>                       _isCancelled;
+
+    ChunkType                               _current;           // Consumer only
+};
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -190,6 +463,27 @@ public:
         return estimator.fit(pItems, cItems);
     }
 
+    template <typename SourceT>
+    FitResult fit_stream(SourceT &source, size_t /*maxQueuedChunks*/) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+        ThisEstimator &                     estimator(thisElement.get_estimator());
+
+        typename SourceT::ItemType const *  pItems;
+        size_t                              cItems;
+
+        while(source.next(pItems, cItems)) {
+            FitResult const                 result(estimator.fit(pItems, cItems));
+
+            if(result != FitResult::Continue) {
+                // The remaining chunks aren't needed
+                source.cancel();
+                return result;
+            }
+        }
+
+        return FitResult::Continue;
+    }
+
     bool on_data_completed(void) {
         EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
         ThisEstimator &                     estimator(thisElement.get_estimator());
@@ -221,6 +515,11 @@ public:
 
         return estimator.get_state() == TrainingState::Finished;
     }
+
+    // Training can only be restarted when a non-terminal `Estimator` completes
+    bool can_reset(void) const {
+        return false;
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -281,6 +580,33 @@ public:
         return thisElement.execute_next_fit(pItems, cItems);
     }
 
+    template <typename SourceT>
+    FitResult fit_stream(SourceT &source, size_t maxQueuedChunks) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+        ThisEstimator &                     estimator(thisElement.get_estimator());
+
+        if(estimator.get_state() == TrainingState::Training) {
+            typename SourceT::ItemType const *      pItems;
+            size_t                                  cItems;
+
+            while(source.next(pItems, cItems)) {
+                if(estimator.fit(pItems, cItems) == FitResult::Continue)
+                    continue;
+
+                // The remaining chunks aren't needed
+                source.cancel();
+
+                complete_chained_estimator();
+
+                return thisElement.has_all_training_finished() ? FitResult::Complete : FitResult::Reset;
+            }
+
+            return FitResult::Continue;
+        }
+
+        return thisElement.execute_next_fit_stream(source, maxQueuedChunks);
+    }
+
     bool on_data_completed(void) {
         EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
         NextEstimatorChainElement &         nextElement(static_cast<NextEstimatorChainElement &>(thisElement));
@@ -319,6 +645,16 @@ public:
         return nextElement.has_all_training_finished();
     }
 
+    // True if this or a downstream non-terminal `Estimator` may still complete,
+    // at which point training restarts (`FitResult::Reset`) for the
+    // `Estimators` that follow it.
+    bool can_reset(void) const {
+        EstimatorChainElementT const &      thisElement(static_cast<EstimatorChainElementT const &>(*this));
+        NextEstimatorChainElement const &   nextElement(static_cast<NextEstimatorChainElement const &>(thisElement));
+
+        return thisElement.get_estimator().get_state() != TrainingState::Completed || nextElement.can_reset();
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -433,9 +769,11 @@ public:
 
     using TerminalMixin::begin_training;
     using TerminalMixin::fit;
+    using TerminalMixin::fit_stream;
     using TerminalMixin::on_data_completed;
     using TerminalMixin::complete_training;
     using TerminalMixin::has_all_training_finished;
+    using TerminalMixin::can_reset;
 
 private:
     // ----------------------------------------------------------------------
@@ -510,9 +848,11 @@ public:
 
     using TerminalMixin::begin_training;
     using TerminalMixin::fit;
+    using TerminalMixin::fit_stream;
     using TerminalMixin::on_data_completed;
     using TerminalMixin::complete_training;
     using TerminalMixin::has_all_training_finished;
+    using TerminalMixin::can_reset;
 
     using TransformerMixin::move_transformer;
 
@@ -593,9 +933,11 @@ public:
 
     using IntraMixin::begin_training;
     using IntraMixin::fit;
+    using IntraMixin::fit_stream;
     using IntraMixin::on_data_completed;
     using IntraMixin::complete_training;
     using IntraMixin::has_all_training_finished;
+    using IntraMixin::can_reset;
 
 private:
     // ----------------------------------------------------------------------
@@ -614,6 +956,11 @@ private:
         return NextEstimatorChainElement::fit(pItems, cItems);
     }
 
+    template <typename SourceT>
+    FitResult execute_next_fit_stream(SourceT &source, size_t maxQueuedChunks) {
+        return NextEstimatorChainElement::fit_stream(source, maxQueuedChunks);
+    }
+
     void create_transformer_if_necessary(void) {
     }
 
@@ -689,9 +1036,11 @@ public:
 
     using IntraMixin::begin_training;
     using IntraMixin::fit;
+    using IntraMixin::fit_stream;
     using IntraMixin::on_data_completed;
     using IntraMixin::complete_training;
     using IntraMixin::has_all_training_finished;
+    using IntraMixin::can_reset;
 
     using TransformerMixin::move_transformer;
 
@@ -737,6 +1086,75 @@ private:
         return FitResult::Continue;
     }
 
+    template <typename SourceT>
+    FitResult execute_next_fit_stream(SourceT &source, size_t maxQueuedChunks) {
+        // ----------------------------------------------------------------------
+        using TransformedType               = typename ThisEstimator::TransformedType;
+        using Queue                         = ChunkQueue<TransformedType>;
+        // ----------------------------------------------------------------------
+
+        // The downstream elements consume this element's output on a separate thread,
+        // one chunk at a time.
+        Queue                               queue(maxQueuedChunks);
+        FitResult                           result(FitResult::Continue);
+        std::exception_ptr                  downstreamException;
+        std::thread                         downstream(
+            [this, &queue, &result, &downstreamException, maxQueuedChunks](void) {
+                try {
+                    result = static_cast<NextEstimatorChainElement &>(*this).fit_stream(queue, maxQueuedChunks);
+                }
+                catch(...) {
+                    downstreamException = std::current_exception();
+                    queue.cancel();
+                }
+            }
+        );
+
+        std::exception_ptr                  exception;
+
+        try {
+            auto &                                  transformer(TransformerMixin::get_transformer());
+            typename SourceT::ItemType const *      pItems;
+            size_t                                  cItems;
+
+            while(source.next(pItems, cItems)) {
+                typename Queue::ChunkType           transformed;
+
+                // Assume a 1:1 mapping between input and output
+                transformed.reserve(cItems);
+
+                auto const                          callback(
+                    [&transformed](TransformedType output) {
+                        transformed.emplace_back(std::move(output));
+                    }
+                );
+
+                for(typename SourceT::ItemType const *pItem = pItems; pItem != pItems + cItems; ++pItem)
+                    transformer.execute(*pItem, callback);
+
+                if(transformed.empty() == false && queue.push(std::move(transformed)) == false) {
+                    // The downstream elements don't need any more data
+                    source.cancel();
+                    break;
+                }
+            }
+        }
+        catch(...) {
+            exception = std::current_exception();
+            source.cancel();
+        }
+
+        queue.close();
+        downstream.join();
+
+        if(exception)
+            std::rethrow_exception(exception);
+        if(downstreamException)
+            std::rethrow_exception(downstreamException);
+
+        return result;
+    }
+
     void create_transformer_if_necessary(void) {
         typename ThisEstimatorChainElementBase::ThisEstimator &             thisEstimator(ThisEstimatorChainElementBase::get_estimator());
 
@@ -810,6 +1228,18 @@ private:
     using ThisEstimatorChainElement         = EstimatorChainElement<N, EstimatorTupleT>;
 
 public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+
+    // Intermediate values used by `execute_fused_batch`; created once per batch
+    // and reused for each block within it.
+    struct BatchBuffers {
+        BatchBuffers(size_t) {}
+    };
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -828,6 +1258,9 @@ public:
     void save(Archive &) const {
     }
 
+    // `get_transformer` overloads are selected by the index of the element
+    void get_transformer(std::integral_constant<int, N>) = delete;
+
     template <typename InputT, typename CallbackT>
     void execute(InputT &input, CallbackT const &callback) {
         callback(std::move(input));
@@ -836,6 +1269,16 @@ public:
     template <typename CallbackT>
     void flush(CallbackT const &) {
     }
+
+    template <typename InputT>
+    ChainOutputType<EstimatorTupleT> execute_fused(InputT &input) {
+        return std::move(input);
+    }
+
+    template <typename InputT>
+    void execute_fused_batch(InputT const *pInputs, size_t cInputs, ChainOutputType<EstimatorTupleT> *pOutputs, BatchBuffers &) {
+        std::copy(pInputs, pInputs + cInputs, pOutputs);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -859,6 +1302,15 @@ private:
     using ThisEstimator                     = typename std::tuple_element<N, EstimatorTupleT>::type;
 
 public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    struct BatchBuffers {
+        BatchBuffers(size_t) {}
+    };
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -876,6 +1328,10 @@ public:
         _pTransformer->save(ar);
     }
 
+    typename ThisEstimator::TransformerType & get_transformer(std::integral_constant<int, N>) {
+        return static_cast<typename ThisEstimator::TransformerType &>(*_pTransformer);
+    }
+
     bool operator==(TransformerChainElement const &other) const {
         // ----------------------------------------------------------------------
         using ThisTransformer               = typename ThisEstimator::TransformerType;
@@ -894,6 +1350,16 @@ public:
         _pTransformer->flush(callback);
     }
 
+    template <typename InputT>
+    ChainOutputType<EstimatorTupleT> execute_fused(InputT &input) {
+        return transform(input, std::integral_constant<bool, HasTransformMethod<ThisTransformer>::value>());
+    }
+
+    template <typename InputT>
+    void execute_fused_batch(InputT const *pInputs, size_t cInputs, ChainOutputType<EstimatorTupleT> *pOutputs, BatchBuffers &) {
+        static_cast<ThisStandardTransformer &>(*_pTransformer).execute_batch(pInputs, cInputs, pOutputs);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -901,6 +1367,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     using TransformerUniquePtr              = typename ThisEstimator::TransformerUniquePtr;
+    using ThisTransformer                   = typename ThisEstimator::TransformerType;
+
+    // Only used when the chain is fusable
+    using ThisStandardTransformer           = StandardTransformer<typename ThisTransformer::InputType, typename ThisTransformer::TransformedType>;
 
     // ----------------------------------------------------------------------
     // |
@@ -908,6 +1378,21 @@ private:
     // |
     // ----------------------------------------------------------------------
     TransformerUniquePtr const              _pTransformer;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename InputT>
+    typename ThisTransformer::TransformedType transform(InputT const &input, std::true_type /*HasTransformMethod*/) const {
+        return static_cast<ThisTransformer const &>(*_pTransformer).transform(input);
+    }
+
+    template <typename InputT>
+    typename ThisTransformer::TransformedType transform(InputT &input, std::false_type /*HasTransformMethod*/) const {
+        return static_cast<ThisStandardTransformer &>(*_pTransformer).execute(input);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -934,6 +1419,13 @@ private:
     using NextTransformerChainElement       = TransformerChainElement<N + 1, EstimatorTupleT>;
 
 public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BatchBuffers                      = typename NextTransformerChainElement::BatchBuffers;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -955,6 +1447,9 @@ public:
         NextTransformerChainElement::save(ar);
     }
 
+    using NextTransformerChainElement::get_transformer;
+    void get_transformer(std::integral_constant<int, N>) = delete;
+
     template <typename InputT, typename CallbackT>
     void execute(InputT const &input, CallbackT const &callback) {
         NextTransformerChainElement::execute(input, callback);
@@ -964,6 +1459,16 @@ public:
     void flush(CallbackT const &callback) {
         NextTransformerChainElement::flush(callback);
     }
+
+    template <typename InputT>
+    ChainOutputType<EstimatorTupleT> execute_fused(InputT &input) {
+        return NextTransformerChainElement::execute_fused(input);
+    }
+
+    template <typename InputT>
+    void execute_fused_batch(InputT const *pInputs, size_t cInputs, ChainOutputType<EstimatorTupleT> *pOutputs, BatchBuffers &buffers) {
+        NextTransformerChainElement::execute_fused_batch(pInputs, cInputs, pOutputs, buffers);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -991,7 +1496,26 @@ private:
     using ThisEstimator                     = typename std::tuple_element<N, EstimatorTupleT>::type;
     using ThisTransformer                   = typename ThisEstimator::TransformerType;
 
+    // Only used when the chain is fusable
+    using ThisStandardTransformer           = StandardTransformer<typename ThisTransformer::InputType, typename ThisTransformer::TransformedType>;
+
 public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    struct BatchBuffers {
+        // Not a std::vector, as this stage may produce bools
+        std::unique_ptr<typename ThisTransformer::TransformedType []>    pTransformed;
+        typename NextTransformerChainElement::BatchBuffers               next;
+
+        BatchBuffers(size_t cMaxInputs) :
+            pTransformed(new typename ThisTransformer::TransformedType[cMaxInputs]),
+            next(cMaxInputs) {
+        }
+    };
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -1017,6 +1541,12 @@ public:
         _pTransformer->save(ar);
     }
 
+    using NextTransformerChainElement::get_transformer;
+
+    ThisTransformer & get_transformer(std::integral_constant<int, N>) {
+        return static_cast<ThisTransformer &>(*_pTransformer);
+    }
+
     template <typename InputT, typename CallbackT>
     void execute(InputT const &input, CallbackT const &callback) {
         NextTransformerChainElement &       next(static_cast<NextTransformerChainElement &>(*this));
@@ -1042,6 +1572,19 @@ public:
         next.flush(callback);
     }
 
+    template <typename InputT>
+    ChainOutputType<EstimatorTupleT> execute_fused(InputT &input) {
+        typename ThisTransformer::TransformedType           output(transform(input, std::integral_constant<bool, HasTransformMethod<ThisTransformer>::value>()));
+
+        return NextTransformerChainElement::execute_fused(output);
+    }
+
+    template <typename InputT>
+    void execute_fused_batch(InputT const *pInputs, size_t cInputs, ChainOutputType<EstimatorTupleT> *pOutputs, BatchBuffers &buffers) {
+        static_cast<ThisStandardTransformer &>(*_pTransformer).execute_batch(pInputs, cInputs, buffers.pTransformed.get());
+        NextTransformerChainElement::execute_fused_batch(buffers.pTransformed.get(), cInputs, pOutputs, buffers.next);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -1056,6 +1599,21 @@ private:
     // |
     // ----------------------------------------------------------------------
     TransformerUniquePtr const              _pTransformer;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename InputT>
+    typename ThisTransformer::TransformedType transform(InputT const &input, std::true_type /*HasTransformMethod*/) const {
+        return static_cast<ThisTransformer const &>(*_pTransformer).transform(input);
+    }
+
+    template <typename InputT>
+    typename ThisTransformer::TransformedType transform(InputT &input, std::false_type /*HasTransformMethod*/) const {
+        return static_cast<ThisStandardTransformer &>(*_pTransformer).execute(input);
+    }
 };
 
 } // namespace Impl
@@ -1081,6 +1639,14 @@ public:
 
     using TransformerChain                  = Impl::TransformerChainElement<0, EstimatorTuple>;
     using EstimatorChain                    = Impl::EstimatorChainElement<0, EstimatorTuple>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+
+    // True if every `Transformer` in the pipeline is a `StandardTransformer`,
+    // in which case the stages can be invoked directly rather than through
+    // nested callbacks.
+    static constexpr bool const             IsFused = Impl::AreFusableEstimators<0, EstimatorTuple>::value;
 };
 
 } // namespace Details
@@ -5,11 +5,13 @@
 #pragma once
 
 #include <algorithm>
+#include <exception>
 #include <iterator>
 #include <unordered_map>
 #include <queue>
 #include <regex>
 #include <set>
+#include <thread>
 
 #include "TrainingOnlyEstimatorImpl.h"
 #include "IndexMapEstimator.h"
@@ -128,10 +130,23 @@ public:
         std::float_t minDf,
         std::float_t maxDf,
         std::uint32_t ngramRangeMin,
-        std::uint32_t ngramRangeMax
+        std::uint32_t ngramRangeMax,
+        std::uint32_t numThreads=1
     );
 
     void fit(InputType const &input);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            fit
+    ///  \brief         Distributes the documents across `numThreads` workers,
+    ///                 each of which counts terms into its own map; the maps
+    ///                 are merged in `complete_training`. Term frequencies
+    ///                 don't depend on the order in which documents are
+    ///                 processed, so the results are the same as those
+    ///                 produced when training on a single thread.
+    ///
+    void fit(InputType const *pItems, size_t cItems);
+
     DocumentStatisticsAnnotationData complete_training(void);
 
 private:
@@ -157,19 +172,24 @@ private:
     std::float_t const                      _maxDf;
     std::uint32_t const                     _ngramRangeMin;
     std::uint32_t const                     _ngramRangeMax;
+    std::uint32_t const                     _numThreads;
 
     ParseFunctionType const                 _parseFunc;
 
     FrequencyMap                            _termFrequency;
     std::uint32_t                           _totalNumDocuments;
 
-
+    // Term frequencies counted by each worker thread (populated when training with
+    // more than 1 thread and merged into `_termFrequency` in `complete_training`)
+    std::vector<FrequencyMap>               _workerTermFrequencies;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    void fit_document(InputType const &input, FrequencyMap &termFrequency) const;
+
     template <
         typename SetT,
         typename CreateKeyFuncT,            // SetT::value_type (InputTypeConstIterator begin, InputTypeConstIterator end)
@@ -178,8 +198,9 @@ private:
     void fit_impl(
         InputType const &input,
         CreateKeyFuncT const &createKeyFunc,
-        KeyToStringFuncT const &createStringFromKeyFunc
-    );
+        KeyToStringFuncT const &createStringFromKeyFunc,
+        FrequencyMap &termFrequency
+    ) const;
 };
 
 } // namespace Details
@@ -218,7 +239,8 @@ public:
         std::float_t minDf,
         std::float_t maxDf,
         std::uint32_t ngramRangeMin,
-        std::uint32_t ngramRangeMax
+        std::uint32_t ngramRangeMax,
+        std::uint32_t numThreads=1
     );
     ~DocumentStatisticsEstimator(void) override = default;
 
@@ -233,13 +255,91 @@ public:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
+namespace Details {
+
+inline bool IsAsciiWordChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+inline bool IsAsciiDigitChar(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline bool IsAsciiAlphaChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline bool IsAsciiSpaceChar(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+inline bool IsNotAsciiWordChar(char c) { return IsAsciiWordChar(c) == false; }
+inline bool IsNotAsciiDigitChar(char c) { return IsAsciiDigitChar(c) == false; }
+inline bool IsNotAsciiAlphaChar(char c) { return IsAsciiAlphaChar(c) == false; }
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetCharacterClassTokenizer
+///  \brief         Most custom token patterns match runs of a single character
+///                 class (for example, "\w+" or "[^\s]+"). These patterns can be
+///                 tokenized by splitting on the characters outside of the class,
+///                 which is much faster than `std::regex` and produces the same
+///                 tokens. Returns false if `regexToken` isn't one of these patterns.
+///
+inline bool GetCharacterClassTokenizer(std::string const &regexToken, bool (*&isSeparator)(char), size_t &minTokenLength) {
+    struct PatternInfo {
+        char const *                        Pattern;
+        bool                                (*IsSeparator)(char);
+        size_t                              MinTokenLength;
+    };
+
+    static PatternInfo const                patterns[] = {
+        { "\\w+", IsNotAsciiWordChar, 1 },
+        { "\\b\\w\\w+\\b", IsNotAsciiWordChar, 2 },
+        { "\\w\\w+", IsNotAsciiWordChar, 2 },
+        { "\\d+", IsNotAsciiDigitChar, 1 },
+        { "[a-zA-Z]+", IsNotAsciiAlphaChar, 1 },
+        { "[A-Za-z]+", IsNotAsciiAlphaChar, 1 },
+        { "\\S+", IsAsciiSpaceChar, 1 },
+        { "[^\\s]+", IsAsciiSpaceChar, 1 }
+    };
+
+    for(PatternInfo const &info : patterns) {
+        if(regexToken == info.Pattern) {
+            isSeparator = info.IsSeparator;
+            minTokenLength = info.MinTokenLength;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace Details
+
 inline void DocumentParseFuncGenerator(ParseFunctionType &parseFunc, AnalyzerMethod const &analyzer, std::string const & regexToken, std::uint32_t const & ngramRangeMin, std::uint32_t const & ngramRangeMax) {
     if (analyzer == AnalyzerMethod::Word) {
-        if (!regexToken.empty()) {
-            parseFunc = [regexToken] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+        bool                                (*isSeparator)(char)(nullptr);
+        size_t                              minTokenLength(0);
+
+        if (!regexToken.empty() && Details::GetCharacterClassTokenizer(regexToken, isSeparator, minTokenLength)) {
+            parseFunc = [isSeparator, minTokenLength] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+                Microsoft::Featurizer::Strings::Parse<std::string::const_iterator, bool (*)(char)>(
+                    input,
+                    isSeparator,
+                    [&callback, minTokenLength] (StringIterator begin, StringIterator end) {
+                        if (static_cast<size_t>(std::distance(begin, end)) >= minTokenLength)
+                            callback(begin, end);
+                    }
+                );
+            };
+        } else if (!regexToken.empty()) {
+            // Compile the regex once rather than every time that a document is parsed
+            std::regex                      regex(regexToken);
+
+            parseFunc = [regex] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
                 Microsoft::Featurizer::Strings::ParseRegex<std::string::const_iterator, std::regex>(
                     input,
-                    std::regex(regexToken),
+                    regex,
                     callback
                 );
             };
@@ -381,7 +481,8 @@ DocumentStatisticsEstimator<MaxNumTrainingItemsV>::DocumentStatisticsEstimator(
     std::float_t minDf,
     std::float_t maxDf,
     std::uint32_t ngramRangeMin,
-    std::uint32_t ngramRangeMax
+    std::uint32_t ngramRangeMax,
+    std::uint32_t numThreads
 ) :
     BaseType(
         std::move(pAllColumnAnnotations),
@@ -395,7 +496,8 @@ DocumentStatisticsEstimator<MaxNumTrainingItemsV>::DocumentStatisticsEstimator(
         std::move(minDf),
         std::move(maxDf),
         std::move(ngramRangeMin),
-        std::move(ngramRangeMax)
+        std::move(ngramRangeMax),
+        std::move(numThreads)
     ) {
 }
 
@@ -577,7 +679,8 @@ inline Details::DocumentStatisticsTrainingOnlyPolicy::DocumentStatisticsTraining
     std::float_t minDf,
     std::float_t maxDf,
     std::uint32_t ngramRangeMin,
-    std::uint32_t ngramRangeMax
+    std::uint32_t ngramRangeMax,
+    std::uint32_t numThreads
 ) :
     //decorator is an optional parameter
     _stringDecoratorFunc(std::move(decorator)),
@@ -645,6 +748,16 @@ inline Details::DocumentStatisticsTrainingOnlyPolicy::DocumentStatisticsTraining
             }()
         )
     ),
+    _numThreads(
+        std::move(
+            [&numThreads](void) -> std::uint32_t & {
+                if(numThreads == 0)
+                    throw std::invalid_argument("numThreads");
+
+                return numThreads;
+            }()
+        )
+    ),
     _parseFunc(
         [this](void) -> ParseFunctionType {
             ParseFunctionType parseFunc;
@@ -662,6 +775,67 @@ inline Details::DocumentStatisticsTrainingOnlyPolicy::DocumentStatisticsTraining
 }
 
 inline void Details::DocumentStatisticsTrainingOnlyPolicy::fit(InputType const &input) {
+    fit_document(input, _termFrequency);
+    _totalNumDocuments += 1;
+}
+
+inline void Details::DocumentStatisticsTrainingOnlyPolicy::fit(InputType const *pItems, size_t cItems) {
+    // Starting threads isn't worth it for small batches
+    static constexpr size_t const           MinItemsPerThread = 64;
+
+    size_t const                            numThreads(std::min(static_cast<size_t>(_numThreads), cItems / MinItemsPerThread));
+
+    if(cItems > std::numeric_limits<std::uint32_t>::max() - _totalNumDocuments)
+        throw std::runtime_error("Too many documents");
+
+    if(numThreads <= 1) {
+        InputType const * const             pEndItems(pItems + cItems);
+
+        while(pItems != pEndItems)
+            fit(*pItems++);
+
+        return;
+    }
+
+    if(_workerTermFrequencies.empty())
+        _workerTermFrequencies.resize(_numThreads);
+
+    std::vector<std::thread>                threads;
+    std::vector<std::exception_ptr>         exceptions(numThreads);
+
+    threads.reserve(numThreads);
+
+    for(size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        InputType const * const             pBegin(pItems + cItems * threadIndex / numThreads);
+        InputType const * const             pEnd(pItems + cItems * (threadIndex + 1) / numThreads);
+
+        threads.emplace_back(
+            [this, pBegin, pEnd, &exceptions, threadIndex](void) {
+                try {
+                    FrequencyMap &          termFrequency(_workerTermFrequencies[threadIndex]);
+
+                    for(InputType const *pItem = pBegin; pItem != pEnd; ++pItem)
+                        fit_document(*pItem, termFrequency);
+                }
+                catch(...) {
+                    exceptions[threadIndex] = std::current_exception();
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    for(auto const &exception : exceptions) {
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+
+    _totalNumDocuments += static_cast<std::uint32_t>(cItems);
+}
+
+inline void Details::DocumentStatisticsTrainingOnlyPolicy::fit_document(InputType const &input, FrequencyMap &termFrequency) const {
     if(_stringDecoratorFunc) {
         fit_impl<std::set<std::string>>(
             input,
@@ -670,7 +844,8 @@ inline void Details::DocumentStatisticsTrainingOnlyPolicy::fit(InputType const &
             },
             [](std::string const &value) -> std::string const & { //I add a const here
                 return value;
-            }
+            },
+            termFrequency
         );
     }
     else {
@@ -686,13 +861,29 @@ inline void Details::DocumentStatisticsTrainingOnlyPolicy::fit(InputType const &
             },
             [](InputTypeConstIteratorRange const &range) -> std::string {
                 return std::string(std::get<0>(range), std::get<1>(range));
-            }
+            },
+            termFrequency
         );
     }
 }
 
 inline DocumentStatisticsAnnotationData Details::DocumentStatisticsTrainingOnlyPolicy::complete_training(void) {
 
+    //merge the frequencies counted by the worker threads
+    for (FrequencyMap &workerTermFrequency : _workerTermFrequencies) {
+        if (_termFrequency.empty()) {
+            _termFrequency = std::move(workerTermFrequency);
+            continue;
+        }
+
+        for (auto &kvp : workerTermFrequency)
+            _termFrequency[kvp.first] += kvp.second;
+
+        FrequencyMap().swap(workerTermFrequency);
+    }
+
+    _workerTermFrequencies.clear();
+
     //prune map by maxDf, minDf and topKTerms
     FrequencyMap                            prunedTermFreq(PruneTermFreqMap(std::move(_termFrequency), _minDf, _maxDf, static_cast<std::float_t>(_totalNumDocuments), _topKTerms));
 
@@ -714,7 +905,7 @@ inline DocumentStatisticsAnnotationData Details::DocumentStatisticsTrainingOnlyP
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 template <typename SetT, typename CreateKeyFuncT, typename KeyToStringFuncT>
-void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &input, CreateKeyFuncT const &createKeyFunc, KeyToStringFuncT const &keyToStringFunc) {
+void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &input, CreateKeyFuncT const &createKeyFunc, KeyToStringFuncT const &keyToStringFunc, FrequencyMap &termFrequency) const {
     SetT                                    documents;
 
     std::string processedInput;
@@ -742,14 +933,14 @@ void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &in
     );
 
     auto const                              getCountFunc(
-        [this, &keyToStringFunc](typename SetT::value_type const &key) -> typename FrequencyMap::mapped_type & {
+        [&termFrequency, &keyToStringFunc](typename SetT::value_type const &key) -> typename FrequencyMap::mapped_type & {
             auto                                        mapKey(keyToStringFunc(key));
-            typename FrequencyMap::iterator const       iter(_termFrequency.find(mapKey));
+            typename FrequencyMap::iterator const       iter(termFrequency.find(mapKey));
 
-            if(iter != _termFrequency.end())
+            if(iter != termFrequency.end())
                 return iter->second;
 
-            std::pair<typename FrequencyMap::iterator, bool> const          result(_termFrequency.insert(std::make_pair(std::move(mapKey), 0)));
+            std::pair<typename FrequencyMap::iterator, bool> const          result(termFrequency.insert(std::make_pair(std::move(mapKey), 0)));
 
             return result.first->second;
         }
@@ -757,8 +948,6 @@ void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &in
 
     for(auto const &key : documents)
         getCountFunc(key) += 1;
-
-    _totalNumDocuments += 1;
 }
 
 } // namespace Components
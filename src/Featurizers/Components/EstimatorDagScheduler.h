@@ -0,0 +1,391 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         EstimatorDagScheduler
+///  \brief         Trains a directed acyclic graph (DAG) of `FitEstimators`
+///                 that share an `AnnotationMapsPtr`, running `Estimators`
+///                 that don't depend upon each other in parallel.
+///
+///                 Each node declares the `Annotations` that it produces and
+///                 consumes, identified by column and `Estimator` name. A node
+///                 is started once every node that produces an `Annotation`
+///                 that it consumes has completed training.
+///
+///                 Nodes are fit in parallel, but `complete_training` is
+///                 invoked on one node at a time; `Annotations` are generally
+///                 created while completing, and some `Estimators` (such as
+///                 `GrainEstimatorImpl`) inspect the shared `AnnotationMaps`
+///                 to detect the `Annotations` created by their children.
+///
+class EstimatorDagScheduler {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using NodeId                            = size_t;
+    using NodeFunction                      = std::function<void (void)>;
+
+    struct AnnotationKey {
+        size_t const                        ColIndex;
+        std::string const                   Name;
+
+        AnnotationKey(size_t colIndex, std::string name);
+    };
+
+    using AnnotationKeys                    = std::vector<AnnotationKey>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    EstimatorDagScheduler(std::uint32_t numThreads);
+    ~EstimatorDagScheduler(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(EstimatorDagScheduler);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            add
+    ///  \brief         Adds a node that invokes `fitFunc` on a worker thread
+    ///                 and then `completeFunc` (serialized with the completion
+    ///                 of all other nodes).
+    ///
+    NodeId add(NodeFunction fitFunc, NodeFunction completeFunc, AnnotationKeys produces, AnnotationKeys consumes);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            add
+    ///  \brief         Adds a node that trains the `Estimator` on the provided
+    ///                 items, replaying them as requested by the `Estimator`.
+    ///                 Both the `Estimator` and the items must remain valid
+    ///                 until `execute` returns.
+    ///
+    template <typename EstimatorT>
+    NodeId add(EstimatorT &estimator, typename EstimatorT::InputType const *pItems, size_t cItems, AnnotationKeys produces, AnnotationKeys consumes);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute
+    ///  \brief         Trains all of the nodes. Nothing is started if the
+    ///                 dependencies contain a cycle. If a node throws, nodes
+    ///                 that have not yet started are abandoned and the
+    ///                 exception is rethrown once the running nodes finish.
+    ///
+    void execute(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct Node {
+        NodeFunction                        FitFunc;
+        NodeFunction                        CompleteFunc;
+        AnnotationKeys                      Produces;
+        AnnotationKeys                      Consumes;
+
+        std::vector<NodeId>                 Dependents;
+        size_t                              NumPending;
+    };
+
+    using Nodes                             = std::vector<Node>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint32_t                           _numThreads;
+    Nodes                                   _nodes;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<NodeId> resolve_dependencies(void);
+    void execute_parallel(std::vector<NodeId> ready);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  EstimatorDagScheduler::AnnotationKey
+// |
+// ----------------------------------------------------------------------
+inline EstimatorDagScheduler::AnnotationKey::AnnotationKey(size_t colIndex, std::string name) :
+    ColIndex(colIndex),
+    Name(
+        [&name](void) -> std::string & {
+            if(name.empty())
+                throw std::invalid_argument("name");
+
+            return name;
+        }()
+    ) {
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  EstimatorDagScheduler
+// |
+// ----------------------------------------------------------------------
+inline EstimatorDagScheduler::EstimatorDagScheduler(std::uint32_t numThreads) :
+    _numThreads(
+        [&numThreads](void) {
+            if(numThreads == 0)
+                throw std::invalid_argument("numThreads");
+
+            return numThreads;
+        }()
+    ) {
+}
+
+inline EstimatorDagScheduler::NodeId EstimatorDagScheduler::add(NodeFunction fitFunc, NodeFunction completeFunc, AnnotationKeys produces, AnnotationKeys consumes) {
+    if(!fitFunc)
+        throw std::invalid_argument("fitFunc");
+    if(!completeFunc)
+        throw std::invalid_argument("completeFunc");
+
+    _nodes.emplace_back(Node{std::move(fitFunc), std::move(completeFunc), std::move(produces), std::move(consumes), std::vector<NodeId>(), 0});
+    return _nodes.size() - 1;
+}
+
+template <typename EstimatorT>
+EstimatorDagScheduler::NodeId EstimatorDagScheduler::add(EstimatorT &estimator, typename EstimatorT::InputType const *pItems, size_t cItems, AnnotationKeys produces, AnnotationKeys consumes) {
+    if(pItems == nullptr && cItems != 0)
+        throw std::invalid_argument("pItems");
+
+    return add(
+        [&estimator, pItems, cItems](void) {
+            estimator.begin_training();
+
+            while(estimator.get_state() == TrainingState::Training) {
+                if(cItems && estimator.fit(pItems, cItems) == FitResult::Reset)
+                    continue;
+
+                if(estimator.get_state() == TrainingState::Training)
+                    estimator.on_data_completed();
+            }
+        },
+        [&estimator](void) {
+            estimator.complete_training();
+        },
+        std::move(produces),
+        std::move(consumes)
+    );
+}
+
+inline void EstimatorDagScheduler::execute(void) {
+    std::vector<NodeId>                     order(resolve_dependencies());
+
+    if(_numThreads == 1 || _nodes.size() <= 1) {
+        for(NodeId id : order) {
+            _nodes[id].FitFunc();
+            _nodes[id].CompleteFunc();
+        }
+
+        return;
+    }
+
+    std::vector<NodeId>                     ready;
+
+    for(NodeId id : order) {
+        if(_nodes[id].NumPending == 0)
+            ready.emplace_back(id);
+    }
+
+    execute_parallel(std::move(ready));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline std::vector<EstimatorDagScheduler::NodeId> EstimatorDagScheduler::resolve_dependencies(void) {
+    for(Node &node : _nodes) {
+        node.Dependents.clear();
+        node.NumPending = 0;
+    }
+
+    // A node depends upon every other node that produces an `Annotation` that
+    // it consumes.
+    for(NodeId consumerId = 0; consumerId < _nodes.size(); ++consumerId) {
+        Node &                              consumer(_nodes[consumerId]);
+
+        for(NodeId producerId = 0; producerId < _nodes.size(); ++producerId) {
+            if(producerId == consumerId)
+                continue;
+
+            Node &                          producer(_nodes[producerId]);
+
+            bool const                      isDependency(
+                std::any_of(
+                    consumer.Consumes.begin(),
+                    consumer.Consumes.end(),
+                    [&producer](AnnotationKey const &consumed) {
+                        return std::any_of(
+                            producer.Produces.begin(),
+                            producer.Produces.end(),
+                            [&consumed](AnnotationKey const &produced) {
+                                return produced.ColIndex == consumed.ColIndex && produced.Name == consumed.Name;
+                            }
+                        );
+                    }
+                )
+            );
+
+            if(isDependency) {
+                producer.Dependents.emplace_back(consumerId);
+                ++consumer.NumPending;
+            }
+        }
+    }
+
+    // Topological sort; nodes are visited in the order in which they were added
+    // when there are no dependencies between them.
+    std::vector<size_t>                     numPending;
+    std::vector<NodeId>                     order;
+
+    numPending.reserve(_nodes.size());
+    order.reserve(_nodes.size());
+
+    for(NodeId id = 0; id < _nodes.size(); ++id) {
+        numPending.emplace_back(_nodes[id].NumPending);
+
+        if(numPending.back() == 0)
+            order.emplace_back(id);
+    }
+
+    for(size_t index = 0; index < order.size(); ++index) {
+        for(NodeId dependent : _nodes[order[index]].Dependents) {
+            if(--numPending[dependent] == 0)
+                order.emplace_back(dependent);
+        }
+    }
+
+    if(order.size() != _nodes.size())
+        throw std::runtime_error("The dependencies contain a cycle");
+
+    return order;
+}
+
+inline void EstimatorDagScheduler::execute_parallel(std::vector<NodeId> initiallyReady) {
+    // ----------------------------------------------------------------------
+    using UniqueLock                        = std::unique_lock<std::mutex>;
+    // ----------------------------------------------------------------------
+
+    std::mutex                              mutex;
+    std::condition_variable                 cv;
+    std::deque<NodeId>                      ready(initiallyReady.begin(), initiallyReady.end());
+    size_t                                  numRemaining(_nodes.size());
+    std::exception_ptr                      pException;
+
+    std::mutex                              completeMutex;
+
+    auto const                              worker(
+        [this, &mutex, &cv, &ready, &numRemaining, &pException, &completeMutex](void) {
+            UniqueLock                      lock(mutex);
+
+            while(true) {
+                cv.wait(
+                    lock,
+                    [&ready, &numRemaining, &pException](void) {
+                        return ready.empty() == false || numRemaining == 0 || pException;
+                    }
+                );
+
+                if(numRemaining == 0 || pException)
+                    break;
+
+                NodeId const                id(ready.front());
+
+                ready.pop_front();
+                lock.unlock();
+
+                Node &                      node(_nodes[id]);
+                std::exception_ptr          pNodeException;
+
+                try {
+                    node.FitFunc();
+
+                    std::lock_guard<std::mutex>         completeLock(completeMutex);
+
+                    node.CompleteFunc();
+                }
+                catch(...) {
+                    pNodeException = std::current_exception();
+                }
+
+                lock.lock();
+
+                if(pNodeException) {
+                    if(!pException)
+                        pException = pNodeException;
+                }
+                else {
+                    --numRemaining;
+
+                    for(NodeId dependent : node.Dependents) {
+                        if(--_nodes[dependent].NumPending == 0)
+                            ready.emplace_back(dependent);
+                    }
+                }
+
+                cv.notify_all();
+            }
+        }
+    );
+
+    size_t const                            numThreads(std::min(static_cast<size_t>(_numThreads), _nodes.size()));
+    std::vector<std::thread>                threads;
+
+    threads.reserve(numThreads - 1);
+
+    for(size_t i = 1; i < numThreads; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for(auto &thread : threads)
+        thread.join();
+
+    if(pException)
+        std::rethrow_exception(pException);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,233 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/// Returned by `GrainDictionary::find` when a grain hasn't been interned
+static constexpr std::uint32_t const        InvalidGrainId = std::numeric_limits<std::uint32_t>::max();
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         GrainDictionary
+///  \brief         Interns grain keys, assigning each distinct key a dense id
+///                 in [0, size()) in the order in which it was first seen.
+///
+///                 Per-grain state can then be stored in contiguous arrays
+///                 indexed by id; a key is hashed and compared once per
+///                 lookup rather than once per container that holds state
+///                 for the grain.
+///
+///                 Ids are located with an open addressing (linear probing)
+///                 table of 32-bit ids that is kept at most half full; the
+///                 hash of each key is stored so that keys are never rehashed
+///                 when the table grows.
+///
+template <typename KeyT, typename HashT=std::hash<KeyT>>
+class GrainDictionary {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using KeyType                           = KeyT;
+    using IdType                            = std::uint32_t;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    GrainDictionary(void);
+    ~GrainDictionary(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(GrainDictionary);
+
+    size_t size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            intern
+    ///  \brief         Returns the id of the key, assigning the next id if the
+    ///                 key hasn't been seen before (in which case the id is
+    ///                 equal to the previous value of `size()`).
+    ///
+    IdType intern(KeyT const &key);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns the id of the key or `InvalidGrainId` if the key
+    ///                 hasn't been interned.
+    ///
+    IdType find(KeyT const &key) const;
+
+    KeyT const & key(IdType id) const;
+
+    void clear(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr size_t const           InitialNumSlots = 16;
+
+    HashT                                   _hasher;
+
+    std::vector<KeyT>                       _keys;
+    std::vector<std::uint64_t>              _hashes;            // One item per id
+    std::vector<IdType>                     _slots;             // Slot -> id (or InvalidGrainId)
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    size_t find_slot(KeyT const &key, std::uint64_t hash) const;
+    void grow(void);
+
+    static std::uint64_t Mix(std::uint64_t value);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       GrainDictionaryPtr
+///  \brief         A `GrainDictionary` shared by the components that are
+///                 trained on the same time series.
+///
+template <typename KeyT, typename HashT=std::hash<KeyT>>
+using GrainDictionaryPtr                    = std::shared_ptr<GrainDictionary<KeyT, HashT>>;
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  GrainDictionary
+// |
+// ----------------------------------------------------------------------
+template <typename KeyT, typename HashT>
+constexpr size_t const GrainDictionary<KeyT, HashT>::InitialNumSlots;
+
+template <typename KeyT, typename HashT>
+GrainDictionary<KeyT, HashT>::GrainDictionary(void) :
+    _slots(InitialNumSlots, InvalidGrainId) {
+}
+
+template <typename KeyT, typename HashT>
+size_t GrainDictionary<KeyT, HashT>::size(void) const {
+    return _keys.size();
+}
+
+template <typename KeyT, typename HashT>
+typename GrainDictionary<KeyT, HashT>::IdType GrainDictionary<KeyT, HashT>::intern(KeyT const &key) {
+    std::uint64_t const                     hash(Mix(static_cast<std::uint64_t>(_hasher(key))));
+    size_t const                            slot(find_slot(key, hash));
+
+    if(_slots[slot] != InvalidGrainId)
+        return _slots[slot];
+
+    if(_keys.size() == InvalidGrainId)
+        throw std::runtime_error("Too many grains");
+
+    IdType const                            id(static_cast<IdType>(_keys.size()));
+
+    _keys.emplace_back(key);
+    _hashes.emplace_back(hash);
+    _slots[slot] = id;
+
+    if(_keys.size() * 2 > _slots.size())
+        grow();
+
+    return id;
+}
+
+template <typename KeyT, typename HashT>
+typename GrainDictionary<KeyT, HashT>::IdType GrainDictionary<KeyT, HashT>::find(KeyT const &key) const {
+    return _slots[find_slot(key, Mix(static_cast<std::uint64_t>(_hasher(key))))];
+}
+
+template <typename KeyT, typename HashT>
+KeyT const & GrainDictionary<KeyT, HashT>::key(IdType id) const {
+    if(id >= _keys.size())
+        throw std::invalid_argument("id");
+
+    return _keys[id];
+}
+
+template <typename KeyT, typename HashT>
+void GrainDictionary<KeyT, HashT>::clear(void) {
+    _keys.clear();
+    _hashes.clear();
+    _slots.assign(InitialNumSlots, InvalidGrainId);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename KeyT, typename HashT>
+size_t GrainDictionary<KeyT, HashT>::find_slot(KeyT const &key, std::uint64_t hash) const {
+    // The number of slots is a power of 2
+    size_t const                            mask(_slots.size() - 1);
+    size_t                                  slot(static_cast<size_t>(hash) & mask);
+
+    while(true) {
+        IdType const                        id(_slots[slot]);
+
+        if(id == InvalidGrainId || (_hashes[id] == hash && _keys[id] == key))
+            return slot;
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+template <typename KeyT, typename HashT>
+void GrainDictionary<KeyT, HashT>::grow(void) {
+    std::vector<IdType>                     slots(_slots.size() * 2, InvalidGrainId);
+    size_t const                            mask(slots.size() - 1);
+
+    for(IdType id = 0; id < _keys.size(); ++id) {
+        size_t                              slot(static_cast<size_t>(_hashes[id]) & mask);
+
+        while(slots[slot] != InvalidGrainId)
+            slot = (slot + 1) & mask;
+
+        slots[slot] = id;
+    }
+
+    _slots = std::move(slots);
+}
+
+template <typename KeyT, typename HashT>
+/*static*/ std::uint64_t GrainDictionary<KeyT, HashT>::Mix(std::uint64_t value) {
+    // SplitMix64 finalizer; `std::hash` of an integer is often the identity,
+    // which would cluster sequential keys in adjacent slots.
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -4,7 +4,12 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
+#include <exception>
+#include <map>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "../../Featurizer.h"
 #include "Details/EstimatorTraits.h"
@@ -31,7 +36,7 @@ public:
             GrainT,
             AnnotationPtr,
             std::hash<GrainT>,
-            Traits<GrainT>::key_equal
+            typename Traits<GrainT>::key_equal
         >;
 
     // ----------------------------------------------------------------------
@@ -65,11 +70,29 @@ struct GrainEstimatorTraits {
     using TransformedType                   = std::tuple<GrainT, typename Details::EstimatorOutputType<EstimatorT>::type>;
 };
 
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GroupRows
+///  \brief         Stable counting sort of row indexes by key. On return,
+///                 `keys` holds the distinct keys in the order in which they
+///                 were first seen, and the rows associated with `keys[i]`
+///                 are `rows[offsets[i]]` through `rows[offsets[i + 1] - 1]`
+///                 (in their original order).
+///
+template <typename KeyT>
+void GroupRows(std::vector<KeyT> const &rowKeys, std::vector<KeyT> &keys, std::vector<size_t> &offsets, std::vector<size_t> &rows);
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         GrainTransformer
 ///  \brief         A Transformer that applies a Transformer unique to the
 ///                 observed grain using grain-specific state.
 ///
+///                 Grains are located with a hash table; flushing and
+///                 serialization visit the grains in sorted order.
+///
 template <typename GrainT, typename EstimatorT>
 class GrainTransformer :
     public Transformer<
@@ -99,6 +122,9 @@ public:
     using GrainTransformerTypeUniquePtr     = std::unique_ptr<GrainTransformerType>;
     using TransformerMap                    = std::map<GrainT, GrainTransformerTypeUniquePtr>;
 
+    using InputType                         = typename BaseType::InputType;
+    using CallbackFunction                  = typename BaseType::CallbackFunction;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -113,13 +139,45 @@ public:
 
     void save(Archive &ar) const override;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Groups `cInputs` rows by grain and executes the rows of
+    ///                 each grain contiguously (in their original order), so
+    ///                 that a grain's `Transformer` is visited once per batch.
+    ///
+    ///                 Grains are processed in the order in which they first
+    ///                 appear within the batch; as a result, output is grouped
+    ///                 by grain rather than emitted in input order. No rows are
+    ///                 executed if any of the grains is not found.
+    ///
+    void execute_batch(InputType const *pInputs, size_t cInputs, CallbackFunction const &callback);
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using TransformerTable =
+        std::unordered_map<
+            GrainT,
+            GrainTransformerTypeUniquePtr,
+            std::hash<GrainT>,
+            typename Traits<GrainT>::key_equal
+        >;
+
+    using TransformerTableValue             = typename TransformerTable::value_type;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    TransformerMap                          _transformers;
+    TransformerTable                        _transformers;
+
+    // Elements of `_transformers` sorted by grain (references to unordered_map
+    // elements remain valid when the table is rehashed or moved)
+    std::vector<TransformerTableValue *>    _orderedTransformers;
 
     // ----------------------------------------------------------------------
     // |
@@ -128,23 +186,23 @@ private:
     // ----------------------------------------------------------------------
 
     // MSVC has problems when the declaration and definition are separated
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        GrainT const &                      grain(std::get<0>(input));
-        GrainTransformerType &              transformer(
-            [this, &grain](void) -> GrainTransformerType & {
+    TransformerTableValue & find_transformer(GrainT const &grain) {
+        typename TransformerTable::iterator const       iter(_transformers.find(grain));
 
-                typename TransformerMap::iterator const                     iter(_transformers.find(grain));
+        if(iter == _transformers.end())
+            throw std::runtime_error("Grain not found");
 
-                if(iter == _transformers.end())
-                    throw std::runtime_error("Grain not found");
+        // TODO: Add support for a "default transformer" that (if provided during construction)
+        //       is cloned when a grain isn't found.
 
-                // TODO: Add support for a "default transformer" that (if provided during construction)
-                //       is cloned when a grain isn't found.
+        assert(iter->second);
+        return *iter;
+    }
 
-                assert(iter->second);
-                return *iter->second;
-            }()
-        );
+    // MSVC has problems when the declaration and definition are separated
+    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        GrainT const &                      grain(std::get<0>(input));
+        GrainTransformerType &              transformer(*find_transformer(grain).second);
 
         typename EstimatorT::InputType const &          grainInput(std::get<1>(input));
 
@@ -158,7 +216,9 @@ private:
 
     // MSVC has problems when the declaration and definition are separated
     void flush_impl(typename BaseType::CallbackFunction const &callback) override {
-        for(auto &kvp : _transformers) {
+        for(TransformerTableValue *pValue : _orderedTransformers) {
+            TransformerTableValue &         kvp(*pValue);
+
             kvp.second->flush(
                 [&callback, &kvp](typename EstimatorT::TransformedType output) {
                     callback(std::make_tuple(kvp.first, std::move(output)));
@@ -198,7 +258,16 @@ public:
     // |
     // ----------------------------------------------------------------------
     GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations);
-    GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Constructor
+    ///  \brief         When `numThreads` is greater than 1, the rows of each
+    ///                 sufficiently large batch are partitioned by grain and
+    ///                 the per-grain estimators are trained on up to
+    ///                 `numThreads` worker threads. Per-grain estimators are
+    ///                 always created and completed on the calling thread.
+    ///
+    GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc, std::uint32_t numThreads=1);
 
     ~GrainEstimatorImplBase(void) override = default;
 
@@ -210,7 +279,13 @@ protected:
     // |  Protected Types
     // |
     // ----------------------------------------------------------------------
-    using EstimatorMap                      = typename GrainEstimatorAnnotation<GrainT>::AnnotationMap;
+    using EstimatorMap =
+        std::unordered_map<
+            GrainT,
+            EstimatorT,
+            std::hash<GrainT>,
+            typename Traits<GrainT>::key_equal
+        >;
 
     // ----------------------------------------------------------------------
     // |
@@ -219,6 +294,9 @@ protected:
     // ----------------------------------------------------------------------
     EstimatorMap                            _estimators;
 
+    // Elements of `_estimators` in the order in which the grains were first seen
+    std::vector<typename EstimatorMap::value_type *>    _orderedEstimators;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -230,6 +308,7 @@ private:
     // invoking _createFunc.
     AnnotationMapsPtr const                 _pAllColumnAnnotations;
     CreateEstimatorFunc const               _createFunc;
+    std::uint32_t const                     _numThreads;
 
     size_t                                  _cRemainingTrainingItems;
 
@@ -241,6 +320,9 @@ private:
     bool begin_training_impl(void) override;
     FitResult fit_impl(InputType const *pItems, size_t cItems) override;
     void complete_training_impl(void) override;
+
+    EstimatorT & get_estimator(GrainT const &grain);
+    void fit_grain(EstimatorT &estimator, InputType const &input);
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -375,6 +457,11 @@ private:
 ///                 being aware of grains, and then "wrapped" by this object
 ///                 in those scenarios where grain-specific state is required.
 ///
+///                 Per-grain estimators can be trained in parallel (see the
+///                 `numThreads` constructor parameter); per-grain state is
+///                 located with hash tables during both training and
+///                 inference.
+///
 ///                 Note that this using statement immediately forwards to
 ///                 a second implementation, as it isn't possible in C++
 ///                 to have a template that supports both default template
@@ -425,15 +512,24 @@ GrainEstimatorAnnotation<GrainT>::GrainEstimatorAnnotation(AnnotationMap annotat
 template <typename GrainT, typename EstimatorT>
 GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers) :
     _transformers(
-        std::move(
-            [&transformers](void) -> TransformerMap & {
-                if(transformers.empty())
-                    throw std::invalid_argument("transformers");
+        [&transformers](void) {
+            if(transformers.empty())
+                throw std::invalid_argument("transformers");
 
-                return transformers;
-            }()
-        )
+            return transformers.size();
+        }()
     ) {
+    _orderedTransformers.reserve(transformers.size());
+
+    // `transformers` is sorted by grain
+    for(auto &kvp : transformers) {
+        std::pair<typename TransformerTable::iterator, bool> const      result(_transformers.emplace(kvp.first, std::move(kvp.second)));
+
+        if(result.first == _transformers.end() || result.second == false)
+            throw std::runtime_error("Invalid insertion");
+
+        _orderedTransformers.emplace_back(&*result.first);
+    }
 }
 
 template <typename GrainT, typename EstimatorT>
@@ -464,11 +560,47 @@ GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar) :
 
 template <typename GrainT, typename EstimatorT>
 void GrainTransformer<GrainT, EstimatorT>::save(Archive &ar) const /*override*/ {
-    Traits<std::uint64_t>::serialize(ar, _transformers.size());
+    Traits<std::uint64_t>::serialize(ar, _orderedTransformers.size());
+
+    for(TransformerTableValue const *pValue: _orderedTransformers) {
+        Traits<GrainT>::serialize(ar, pValue->first);
+        pValue->second->save(ar);
+    }
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::execute_batch(InputType const *pInputs, size_t cInputs, CallbackFunction const &callback) {
+    if(cInputs == 0)
+        return;
+
+    if(pInputs == nullptr)
+        throw std::invalid_argument("pInputs");
+    if(!callback)
+        throw std::invalid_argument("callback");
+
+    std::vector<TransformerTableValue *>    rowTransformers;
+
+    rowTransformers.reserve(cInputs);
+
+    for(InputType const *pInput = pInputs; pInput != pInputs + cInputs; ++pInput)
+        rowTransformers.emplace_back(&find_transformer(std::get<0>(*pInput)));
+
+    std::vector<TransformerTableValue *>    groups;
+    std::vector<size_t>                     offsets;
+    std::vector<size_t>                     rows;
+
+    Details::GroupRows(rowTransformers, groups, offsets, rows);
+
+    for(size_t group = 0; group < groups.size(); ++group) {
+        TransformerTableValue &             kvp(*groups[group]);
+        auto const                          grainCallback(
+            [&callback, &kvp](typename EstimatorT::TransformedType output) {
+                callback(std::make_tuple(kvp.first, std::move(output)));
+            }
+        );
 
-    for(auto const &kvp: _transformers) {
-        Traits<GrainT>::serialize(ar, kvp.first);
-        kvp.second->save(ar);
+        for(size_t offset = offsets[group]; offset != offsets[group + 1]; ++offset)
+            kvp.second->execute(std::get<1>(pInputs[rows[offset]]), grainCallback);
     }
 }
 
@@ -489,7 +621,7 @@ Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::G
 }
 
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
-Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc) :
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GrainEstimatorImplBase(char const *name, AnnotationMapsPtr pAllColumnAnnotations, CreateEstimatorFunc createFunc, std::uint32_t numThreads) :
     BaseT(name, pAllColumnAnnotations),
     _pAllColumnAnnotations(pAllColumnAnnotations),
     _createFunc(
@@ -502,6 +634,14 @@ Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::G
             }()
         )
     ),
+    _numThreads(
+        [&numThreads](void) -> std::uint32_t & {
+            if(numThreads == 0)
+                throw std::invalid_argument("numThreads");
+
+            return numThreads;
+        }()
+    ),
     _cRemainingTrainingItems(MaxNumTrainingItemsV) {
 }
 
@@ -515,38 +655,71 @@ bool Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItems
 
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
 FitResult Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::fit_impl(InputType const *pItems, size_t cItems) /*override*/ {
+    // Starting threads isn't worth it for small batches
+    static constexpr size_t const           MinItemsPerThread = 64;
+
     size_t const                            cRemainingItems(std::min(_cRemainingTrainingItems, cItems));
     InputType const * const                 pEndItems(pItems + cRemainingItems);
 
-    while(pItems != pEndItems) {
-        EstimatorT &                        estimator(
-            [this, pItems](void) -> EstimatorT & {
-                GrainT const &                          grain(std::get<0>(*pItems));
-                typename EstimatorMap::iterator const   iter(_estimators.find(grain));
-
-                if(iter != _estimators.end())
-                    return iter->second;
-
-                std::pair<typename EstimatorMap::iterator, bool> const      result(_estimators.emplace(std::make_pair(grain, _createFunc(_pAllColumnAnnotations))));
-
-                result.first->second.begin_training();
-
-                return result.first->second;
-            }()
-        );
-
-        if(estimator.get_state() == TrainingState::Training) {
-            typename EstimatorT::InputType const &      input(std::get<1>(*pItems));
-            FitResult const                             result(estimator.fit(input));
+    if(_numThreads == 1 || cRemainingItems / MinItemsPerThread <= 1) {
+        while(pItems != pEndItems) {
+            fit_grain(get_estimator(std::get<0>(*pItems)), *pItems);
+            ++pItems;
+        }
+    }
+    else {
+        // Estimators are created (and begin training) on this thread, as creation
+        // may access the shared `AnnotationMaps`. Each grain's rows are then fit by
+        // a single worker in their original order.
+        std::vector<EstimatorT *>           rowEstimators;
+
+        rowEstimators.reserve(cRemainingItems);
+
+        for(InputType const *pItem = pItems; pItem != pEndItems; ++pItem)
+            rowEstimators.emplace_back(&get_estimator(std::get<0>(*pItem)));
+
+        std::vector<EstimatorT *>           groups;
+        std::vector<size_t>                 offsets;
+        std::vector<size_t>                 rows;
+
+        Details::GroupRows(rowEstimators, groups, offsets, rows);
+
+        size_t const                        numThreads(std::min(static_cast<size_t>(_numThreads), std::min(groups.size(), cRemainingItems / MinItemsPerThread)));
+        std::atomic<size_t>                 nextGroup(0);
+        std::vector<std::thread>            threads;
+        std::vector<std::exception_ptr>     exceptions(numThreads);
+
+        threads.reserve(numThreads);
+
+        for(size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+            threads.emplace_back(
+                [this, pItems, &groups, &offsets, &rows, &nextGroup, &exceptions, threadIndex](void) {
+                    try {
+                        size_t              group;
+
+                        // Grains are claimed one at a time so that a few large grains don't
+                        // leave the other workers idle.
+                        while((group = nextGroup++) < groups.size()) {
+                            EstimatorT &    estimator(*groups[group]);
+
+                            for(size_t offset = offsets[group]; offset != offsets[group + 1]; ++offset)
+                                fit_grain(estimator, pItems[rows[offset]]);
+                        }
+                    }
+                    catch(...) {
+                        exceptions[threadIndex] = std::current_exception();
+                    }
+                }
+            );
+        }
 
-            // Don't allow resetting, as we don't have a good way to reset all of the estimators associated with
-            // each of the unique grains.
+        for(auto &thread : threads)
+            thread.join();
 
-            if(result == FitResult::Reset)
-                throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
+        for(auto const &exception : exceptions) {
+            if(exception)
+                std::rethrow_exception(exception);
         }
-
-        ++pItems;
     }
 
     _cRemainingTrainingItems -= cRemainingItems;
@@ -558,90 +731,137 @@ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItems
     // ----------------------------------------------------------------------
     using ThisAnnotation                    = GrainEstimatorAnnotation<GrainT>;
     using ThisAnnotationMap                 = typename ThisAnnotation::AnnotationMap;
-    using Sizes                             = std::vector<size_t>;
     // ----------------------------------------------------------------------
 
     // This code is admittedly strange. We don't know if the per-grain `Estimator` creates `Annotations`.
     // We are making the assumption that `Annotations` will only be created when `complete_training` is called
     // (I believe that that is a reasonable assumption).
     //
-    // To check if the `Estimator` has created an `Annotation`, we will capture the size of the `AnnotationMaps`
-    // before `complete_training` and after `complete_training` is invoked. Changes in size indicate that an
-    // `Annotation` has been created (note that this isn't safe if multiple threads are simultaneously
-    // modifying the `AnnotationMap` (but that problem will go away when we switch to contexts)).
-    //
-    // If a new `Annotation` is detected, we will remove it from the global `AnnotationMaps` and add it to our
-    // internal `AnnotationMap`. Once complete, we will check for the presence of added `Annotations` and
-    // create a grain-based `Annotation` that contains all the grain-specific `Annotations`.
+    // Once the per-grain `Estimator` has completed, we remove any `Annotations` that it added (identified by
+    // its name) from the global `AnnotationMaps` and add them to our internal `AnnotationMap`. The removal is
+    // synchronized, so other `Estimators` within the DAG may be adding `Annotations` at the same time. Once
+    // complete, we will check for the presence of added `Annotations` and create a grain-based `Annotation`
+    // that contains all the grain-specific `Annotations`.
     //
     // TODO: All of this code needs to change when we switch from using `AnnotationMaps` in favor of graph
     //       contexts.
 
-    Sizes const                             sizes(
-        [this](void) {
-            Sizes                           result;
-
-            result.reserve(_pAllColumnAnnotations->size());
-
-            for(AnnotationMap const &map: *_pAllColumnAnnotations)
-                result.emplace_back(map.size());
-
-            return result;
-        }()
-    );
-
     ThisAnnotationMap                       newAnnotations;
     size_t                                  colIndex(0);
 
-    for(auto & kvp : _estimators) {
+    for(typename EstimatorMap::value_type *pValue : _orderedEstimators) {
+        typename EstimatorMap::value_type &             kvp(*pValue);
+
         kvp.second.complete_training();
 
         bool                                addedNewAnnotation(false);
 
         for(size_t i = 0; i < _pAllColumnAnnotations->size(); ++i) {
-            assert(_pAllColumnAnnotations->size() == sizes.size());
-            assert(i < _pAllColumnAnnotations->size());
+            AnnotationPtrs                  annotations((*_pAllColumnAnnotations)[i].remove_annotations(kvp.second.Name));
 
-            AnnotationMap &                 map((*_pAllColumnAnnotations)[i]);
-            size_t const &                  size(sizes[i]);
+            if(annotations.empty())
+                continue;
 
-            if(map.size() != size) {
-                assert(map.size() == size + 1);
+            if(addedNewAnnotation)
+                throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
 
-                if(addedNewAnnotation)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
+            if(newAnnotations.empty() == false && colIndex != i)
+                throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
 
-                if(newAnnotations.empty() == false && colIndex != i)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
+            colIndex = i;
 
-                colIndex = i;
+            // There should be only one entry
+            if(annotations.size() != 1)
+                throw std::runtime_error("Unexpected AnnotationMap size");
 
-                // If here, something was added. We expect that Annotation to be associated with the grain-based Estimator.
-                AnnotationMap::iterator     iter(map.find(kvp.second.Name));
+            // Insert this value into our working map
+            std::pair<typename ThisAnnotationMap::iterator, bool> const     result(newAnnotations.emplace(std::make_pair(kvp.first, std::move(annotations[0]))));
 
-                if(iter == map.end())
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
+            if(result.first == newAnnotations.end() || result.second == false)
+                throw std::runtime_error("Invalid AnnotationMap insertion");
 
-                // There should be only one entry
-                if(iter->second.size() != 1)
-                    throw std::runtime_error("Unexpected AnnotationMap size");
+            addedNewAnnotation = true;
+        }
+    }
 
-                // Insert this value into our working map
-                std::pair<typename ThisAnnotationMap::iterator, bool> const     result(newAnnotations.emplace(std::make_pair(kvp.first, std::move(iter->second[0]))));
+    if(newAnnotations.empty() == false)
+        BaseT::add_annotation(std::make_shared<ThisAnnotation>(std::move(newAnnotations)), std::move(colIndex));
+}
 
-                if(result.first == newAnnotations.end() || result.second == false)
-                    throw std::runtime_error("Invalid AnnotationMap insertion");
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+EstimatorT & Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::get_estimator(GrainT const &grain) {
+    typename EstimatorMap::iterator const   iter(_estimators.find(grain));
 
-                addedNewAnnotation = true;
+    if(iter != _estimators.end())
+        return iter->second;
 
-                // Remove the value from the global map (which should restore the original sizes)
-                map.erase(iter);
-            }
+    std::pair<typename EstimatorMap::iterator, bool> const      result(_estimators.emplace(grain, _createFunc(_pAllColumnAnnotations)));
+
+    _orderedEstimators.emplace_back(&*result.first);
+    result.first->second.begin_training();
+
+    return result.first->second;
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::fit_grain(EstimatorT &estimator, InputType const &input) {
+    if(estimator.get_state() != TrainingState::Training)
+        return;
+
+    FitResult const                         result(estimator.fit(std::get<1>(input)));
+
+    // Don't allow resetting, as we don't have a good way to reset all of the estimators associated with
+    // each of the unique grains.
+
+    if(result == FitResult::Reset)
+        throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Details
+// |
+// ----------------------------------------------------------------------
+template <typename KeyT>
+void Details::GroupRows(std::vector<KeyT> const &rowKeys, std::vector<KeyT> &keys, std::vector<size_t> &offsets, std::vector<size_t> &rows) {
+    std::unordered_map<KeyT, size_t>        groupIndexes;
+    std::vector<size_t>                     rowGroups;
+
+    keys.clear();
+    offsets.clear();
+    rowGroups.reserve(rowKeys.size());
+
+    // Count the rows in each group
+    for(KeyT const &key : rowKeys) {
+        std::pair<typename std::unordered_map<KeyT, size_t>::iterator, bool> const      result(groupIndexes.emplace(key, keys.size()));
+
+        if(result.second) {
+            keys.emplace_back(key);
+            offsets.emplace_back(0);
         }
+
+        rowGroups.emplace_back(result.first->second);
+        ++offsets[result.first->second];
     }
 
-    if(newAnnotations.empty() == false)
-        BaseT::add_annotation(std::make_shared<ThisAnnotation>(std::move(newAnnotations)), std::move(colIndex));
+    // Convert the counts into starting offsets
+    size_t                                  total(0);
+
+    for(size_t &offset : offsets) {
+        size_t const                        count(offset);
+
+        offset = total;
+        total += count;
+    }
+
+    offsets.emplace_back(total);
+
+    std::vector<size_t>                     positions(offsets.begin(), offsets.end() - 1);
+
+    rows.resize(rowKeys.size());
+
+    for(size_t row = 0; row < rowGroups.size(); ++row)
+        rows[positions[rowGroups[row]]++] = row;
 }
 
 } // namespace Components
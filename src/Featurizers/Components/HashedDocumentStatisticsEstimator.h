@@ -0,0 +1,330 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "DocumentStatisticsEstimator.h"
+#include "../../3rdParty/MurmurHash3.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+static constexpr char const * const         HashedDocumentStatisticsEstimatorName("HashedDocumentStatisticsEstimator");
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetTermBucket
+///  \brief         Maps the term [begin, end) to a bucket in [0, numBuckets).
+///
+std::uint32_t GetTermBucket(StringIterator begin, StringIterator end, std::uint32_t hashingSeedVal, std::uint32_t numBuckets);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedDocumentStatisticsAnnotationData
+///  \brief         Number of documents that contain at least one term
+///                 that hashes to each bucket.
+///
+class HashedDocumentStatisticsAnnotationData {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<std::uint32_t> const        DocumentFrequencies;    // One item per bucket
+    std::uint32_t const                     TotalNumDocuments;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedDocumentStatisticsAnnotationData(std::vector<std::uint32_t> documentFrequencies, std::uint32_t totalNumDocuments);
+    ~HashedDocumentStatisticsAnnotationData(void) = default;
+
+    HashedDocumentStatisticsAnnotationData(HashedDocumentStatisticsAnnotationData &&other);
+};
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedDocumentStatisticsTrainingOnlyPolicy
+///  \brief         `HashedDocumentStatisticsEstimator` implementation details.
+///
+class HashedDocumentStatisticsTrainingOnlyPolicy {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using InputType                         = std::string;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr char const * const     NameValue = HashedDocumentStatisticsEstimatorName;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedDocumentStatisticsTrainingOnlyPolicy(
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax,
+        std::uint32_t hashingSeedVal,
+        std::uint32_t numBuckets
+    );
+
+    void fit(InputType const &input);
+    HashedDocumentStatisticsAnnotationData complete_training(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    bool const                              _lowercase;
+    AnalyzerMethod const                    _analyzer;
+    std::string const                       _regexToken;
+    std::uint32_t const                     _ngramRangeMin;
+    std::uint32_t const                     _ngramRangeMax;
+    std::uint32_t const                     _hashingSeedVal;
+    std::uint32_t const                     _numBuckets;
+
+    ParseFunctionType const                 _parseFunc;
+
+    std::vector<std::uint32_t>              _documentFrequencies;
+
+    // The (1-based) document that last updated each bucket, so that a bucket
+    // is counted once per document without creating a set of its terms.
+    std::vector<std::uint32_t>              _lastDocuments;
+    std::uint32_t                           _totalNumDocuments;
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedDocumentStatisticsEstimator
+///  \brief         Computes per-bucket document frequencies for an input
+///                 column using the hashing trick, so that the memory used
+///                 during training is proportional to the number of buckets
+///                 rather than the size of the vocabulary.
+///
+template <
+    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()
+>
+class HashedDocumentStatisticsEstimator : public TrainingOnlyEstimatorImpl<Details::HashedDocumentStatisticsTrainingOnlyPolicy, MaxNumTrainingItemsV> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                          = TrainingOnlyEstimatorImpl<Details::HashedDocumentStatisticsTrainingOnlyPolicy, MaxNumTrainingItemsV>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedDocumentStatisticsEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        size_t colIndex,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax,
+        std::uint32_t hashingSeedVal,
+        std::uint32_t numBuckets
+    );
+    ~HashedDocumentStatisticsEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HashedDocumentStatisticsEstimator);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline std::uint32_t GetTermBucket(StringIterator begin, StringIterator end, std::uint32_t hashingSeedVal, std::uint32_t numBuckets) {
+    assert(numBuckets != 0);
+
+    std::uint32_t                           hashVal;
+
+    MurmurHash3_x86_32(begin == end ? nullptr : &*begin, static_cast<int>(std::distance(begin, end)), hashingSeedVal, &hashVal);
+    return hashVal % numBuckets;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  HashedDocumentStatisticsAnnotationData
+// |
+// ----------------------------------------------------------------------
+inline HashedDocumentStatisticsAnnotationData::HashedDocumentStatisticsAnnotationData(std::vector<std::uint32_t> documentFrequencies, std::uint32_t totalNumDocuments) :
+    DocumentFrequencies(
+        std::move(
+            [&documentFrequencies](void) -> std::vector<std::uint32_t> & {
+                if(documentFrequencies.empty())
+                    throw std::invalid_argument("documentFrequencies");
+
+                return documentFrequencies;
+            }()
+        )
+    ),
+    TotalNumDocuments(
+        std::move(
+            [&totalNumDocuments](void) -> std::uint32_t & {
+                if(totalNumDocuments == 0)
+                    throw std::invalid_argument("totalNumDocuments");
+
+                return totalNumDocuments;
+            }()
+        )
+    ) {
+}
+
+inline HashedDocumentStatisticsAnnotationData::HashedDocumentStatisticsAnnotationData(HashedDocumentStatisticsAnnotationData &&other) :
+    DocumentFrequencies(std::move(const_cast<std::vector<std::uint32_t> &>(other.DocumentFrequencies))),
+    TotalNumDocuments(std::move(other.TotalNumDocuments)) {
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Details::HashedDocumentStatisticsTrainingOnlyPolicy
+// |
+// ----------------------------------------------------------------------
+inline Details::HashedDocumentStatisticsTrainingOnlyPolicy::HashedDocumentStatisticsTrainingOnlyPolicy(
+    bool lowercase,
+    AnalyzerMethod analyzer,
+    std::string regexToken,
+    std::uint32_t ngramRangeMin,
+    std::uint32_t ngramRangeMax,
+    std::uint32_t hashingSeedVal,
+    std::uint32_t numBuckets
+) :
+    _lowercase(std::move(lowercase)),
+    _analyzer(std::move(analyzer)),
+    _regexToken(std::move(regexToken)),
+    _ngramRangeMin(
+        std::move(
+            [&ngramRangeMin](void) -> std::uint32_t & {
+                if(ngramRangeMin == 0)
+                    throw std::invalid_argument("ngramRangeMin");
+
+                return ngramRangeMin;
+            }()
+        )
+    ),
+    _ngramRangeMax(
+        std::move(
+            [&ngramRangeMax](void) -> std::uint32_t & {
+                if(ngramRangeMax == 0)
+                    throw std::invalid_argument("ngramRangeMax");
+
+                return ngramRangeMax;
+            }()
+        )
+    ),
+    _hashingSeedVal(std::move(hashingSeedVal)),
+    _numBuckets(
+        std::move(
+            [&numBuckets](void) -> std::uint32_t & {
+                if(numBuckets == 0)
+                    throw std::invalid_argument("numBuckets");
+
+                return numBuckets;
+            }()
+        )
+    ),
+    _parseFunc(
+        [this](void) -> ParseFunctionType {
+            ParseFunctionType parseFunc;
+            DocumentParseFuncGenerator(parseFunc, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax);
+            return parseFunc;
+        }()
+    ),
+    _documentFrequencies(_numBuckets, 0),
+    _lastDocuments(_numBuckets, 0),
+    _totalNumDocuments(0) {
+        if (_ngramRangeMin > _ngramRangeMax)
+            throw std::invalid_argument("_ngramRangeMin > _ngramRangeMax");
+}
+
+inline void Details::HashedDocumentStatisticsTrainingOnlyPolicy::fit(InputType const &input) {
+    if(_totalNumDocuments == std::numeric_limits<std::uint32_t>::max())
+        throw std::runtime_error("Too many documents");
+
+    std::uint32_t const                     document(_totalNumDocuments + 1);
+    std::string const                       processedInput(DocumentDecorator(input, _lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax));
+
+    _parseFunc(
+        processedInput,
+        [this, document](StringIterator begin, StringIterator end) {
+            std::uint32_t const             bucket(GetTermBucket(begin, end, _hashingSeedVal, _numBuckets));
+
+            if(_lastDocuments[bucket] != document) {
+                _lastDocuments[bucket] = document;
+                ++_documentFrequencies[bucket];
+            }
+        }
+    );
+
+    _totalNumDocuments = document;
+}
+
+inline HashedDocumentStatisticsAnnotationData Details::HashedDocumentStatisticsTrainingOnlyPolicy::complete_training(void) {
+    std::vector<std::uint32_t>().swap(_lastDocuments);
+
+    return HashedDocumentStatisticsAnnotationData(std::move(_documentFrequencies), std::move(_totalNumDocuments));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  HashedDocumentStatisticsEstimator
+// |
+// ----------------------------------------------------------------------
+template <size_t MaxNumTrainingItemsV>
+HashedDocumentStatisticsEstimator<MaxNumTrainingItemsV>::HashedDocumentStatisticsEstimator(
+    AnnotationMapsPtr pAllColumnAnnotations,
+    size_t colIndex,
+    bool lowercase,
+    AnalyzerMethod analyzer,
+    std::string regexToken,
+    std::uint32_t ngramRangeMin,
+    std::uint32_t ngramRangeMax,
+    std::uint32_t hashingSeedVal,
+    std::uint32_t numBuckets
+) :
+    BaseType(
+        std::move(pAllColumnAnnotations),
+        std::move(colIndex),
+        true,
+        std::move(lowercase),
+        std::move(analyzer),
+        std::move(regexToken),
+        std::move(ngramRangeMin),
+        std::move(ngramRangeMax),
+        std::move(hashingSeedVal),
+        std::move(numBuckets)
+    ) {
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
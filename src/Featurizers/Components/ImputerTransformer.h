@@ -59,6 +59,8 @@ public:
 
     void save(Archive &ar) const override;
 
+    TransformedType transform(InputType const &input) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -66,6 +68,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) override;
 };
 
 // ----------------------------------------------------------------------
@@ -128,19 +131,37 @@ void ImputerTransformer<InputT, TransformedT>::save(Archive &ar) const /*overrid
     Traits<decltype(Value)>::serialize(ar, Value);
 }
 
+template <typename InputT, typename TransformedT>
+typename ImputerTransformer<InputT, TransformedT>::TransformedType ImputerTransformer<InputT, TransformedT>::transform(InputType const &input) const {
+    // ----------------------------------------------------------------------
+    using TheseTraits                       = Traits<InputType>;
+    // ----------------------------------------------------------------------
+
+    if(TheseTraits::IsNull(input))
+        return Value;
+
+    return static_cast<TransformedT>(TheseTraits::GetNullableValue(input));
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void ImputerTransformer<InputT, TransformedT>::execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void ImputerTransformer<InputT, TransformedT>::execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) /*override*/ {
     // ----------------------------------------------------------------------
     using TheseTraits                       = Traits<InputType>;
     // ----------------------------------------------------------------------
 
-    if(TheseTraits::IsNull(input))
-        callback(Value);
-    else
-        callback(static_cast<TransformedT>(TheseTraits::GetNullableValue(input)));
+    for(size_t i = 0; i < cInputs; ++i) {
+        InputType const &                   input(pInputs[i]);
+
+        pOutputs[i] = TheseTraits::IsNull(input) ? Value : static_cast<TransformedT>(TheseTraits::GetNullableValue(input));
+    }
 }
 
 } // namespace Components
@@ -6,6 +6,7 @@
 
 #include <queue>
 
+#include "QuantileSketch.h"
 #include "TrainingOnlyEstimatorImpl.h"
 
 namespace Microsoft {
@@ -47,6 +48,14 @@ namespace Details {
 ///  \class         MedianTrainingOnlyPolicy
 ///  \brief         `MedianEstimator` implementation details.
 ///
+///                 By default, the exact median is calculated and every value
+///                 encountered during training is retained. When
+///                 `maxRankError` is not 0, an approximate median is calculated
+///                 with a `QuantileSketch` whose memory usage is independent of
+///                 the number of values; the rank of the approximate median is
+///                 within `maxRankError * <number of values>` of the rank of the
+///                 exact median (with 99% confidence).
+///
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 class MedianTrainingOnlyPolicy {
 public:
@@ -58,6 +67,7 @@ public:
     static_assert(Traits<TransformedT>::IsNullableType == false || Traits<TransformedT>::IsNativeNullableType, "'TransformedT' should not be a nullable type");
 
     using InputType                         = InputT;
+    using SketchType                        = QuantileSketch<TransformedT>;
 
     // ----------------------------------------------------------------------
     // |
@@ -71,9 +81,30 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
+    MedianTrainingOnlyPolicy(std::float_t maxRankError=0.0f);
+
     void fit(InputType const &input);
     MedianAnnotationData<TransformedT> complete_training(void);
 
+    bool is_approximate(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_sketch
+    ///  \brief         Returns the values summarized so far, which can be
+    ///                 serialized and merged into another estimator that was
+    ///                 created with the same `maxRankError`. Only available
+    ///                 when calculating an approximate median.
+    ///
+    SketchType const & get_sketch(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            merge
+    ///  \brief         Adds the values summarized by a sketch (for example,
+    ///                 one trained on another partition of the data). Only
+    ///                 available when calculating an approximate median.
+    ///
+    void merge(SketchType const &sketch);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -95,6 +126,8 @@ private:
     MaxHeapType                             _smaller;
     MinHeapType                             _larger;
 
+    nonstd::optional<SketchType>            _sketch;            // Only set when calculating an approximate median
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -108,6 +141,9 @@ private:
 
     TransformedT _get_interpolated_value(std::true_type /*supports Interpolated values*/);
     TransformedT _get_interpolated_value(std::false_type /*supports Interpolated values*/);
+
+    TransformedT _get_sketch_median(std::true_type /*supports Interpolated values*/) const;
+    TransformedT _get_sketch_median(std::false_type /*supports Interpolated values*/) const;
 };
 
 } // namespace Details
@@ -150,6 +186,21 @@ MedianAnnotationData<T>::MedianAnnotationData(T median) :
 // |  Details::MedianTrainingOnlyPolicy
 // |
 // ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::MedianTrainingOnlyPolicy(std::float_t maxRankError) :
+    _sketch(
+        [&maxRankError](void) -> nonstd::optional<SketchType> {
+            if(maxRankError < 0.0f || maxRankError >= 1.0f)
+                throw std::invalid_argument("maxRankError");
+
+            if(maxRankError <= 0.0f)
+                return nonstd::optional<SketchType>();
+
+            return SketchType(SketchType::GetK(maxRankError));
+        }()
+    ) {
+}
+
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit(InputType const &input) {
     fit_impl(input, std::integral_constant<bool, Traits<InputT>::IsNullableType>());
@@ -157,6 +208,18 @@ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>
 
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::complete_training(void) {
+    if(_sketch) {
+        if(_sketch->empty())
+            throw std::runtime_error("No elements were provided during training");
+
+        TransformedT                        median(_get_sketch_median(std::integral_constant<bool, InterpolateValuesV>()));
+
+        // Clean up after ourselves
+        _sketch = SketchType(_sketch->k());
+
+        return median;
+    }
+
     size_t const                            numElements(_smaller.size() + _larger.size());
 
     if(numElements == 0)
@@ -189,6 +252,27 @@ MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, Tra
     return median;
 }
 
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+bool Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::is_approximate(void) const {
+    return static_cast<bool>(_sketch);
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+typename Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::SketchType const & Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::get_sketch(void) const {
+    if(!_sketch)
+        throw std::runtime_error("The exact median is being calculated");
+
+    return *_sketch;
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::merge(SketchType const &sketch) {
+    if(!_sketch)
+        throw std::runtime_error("The exact median is being calculated");
+
+    _sketch->merge(sketch);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -208,6 +292,11 @@ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 template <typename U>
 void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(U const &input) {
+    if(_sketch) {
+        _sketch->update(static_cast<TransformedT>(input));
+        return;
+    }
+
     if(_smaller.empty() || static_cast<TransformedT>(input) <= _smaller.top()) {
 #if (defined __apple_build_version__)
         _smaller.push(static_cast<TransformedT>(input));
@@ -265,6 +354,16 @@ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, Interpolate
     throw std::runtime_error("This should never be called");
 }
 
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_sketch_median(std::true_type /*supports Interpolated values*/) const {
+    return static_cast<TransformedT>(_sketch->interpolated_quantile(0.5));
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_sketch_median(std::false_type /*supports Interpolated values*/) const {
+    return _sketch->quantile(0.5);
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -12,6 +12,47 @@ namespace Featurizer {
 namespace Featurizers {
 namespace Components {
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         PipelinedTraining
+///  \brief         Enables pipelined training in a `PipelineExecutionEstimatorImpl`.
+///
+///                 Each batch is split into chunks of `ChunkSize` items. Once
+///                 an `Estimator` within the pipeline has been trained, its
+///                 `Transformer` runs on its own thread and feeds the
+///                 downstream `Estimators` one chunk at a time through a
+///                 queue that holds at most `MaxQueuedChunks` chunks.
+///
+///                 When the input type is copyable, the items seen during
+///                 training are retained so that passes requested by
+///                 `Estimators` within the pipeline (`FitResult::Reset`, or
+///                 an `Estimator` that completes in `on_data_completed`) are
+///                 replayed internally rather than by the caller. Items are
+///                 only retained while an `Estimator` other than the last may
+///                 still complete, and at most `MaxReplayItems` items are
+///                 retained. Once either limit is reached, the retained items
+///                 are released and the caller provides any additional passes
+///                 (as it does for inputs that aren't copyable).
+///
+struct PipelinedTraining {
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr size_t const           DefaultMaxReplayItems = 64 * 1024;
+
+    size_t const                            ChunkSize;
+    size_t const                            MaxQueuedChunks;
+    size_t const                            MaxReplayItems; // 0 to never retain items
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    explicit PipelinedTraining(size_t chunkSize=1024, size_t maxQueuedChunks=4, size_t maxReplayItems=DefaultMaxReplayItems);
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         PipelineExecutionTransformer
 ///  \brief         `Transformer` associated with a `PipelineExecutionEstimatorImpl`
@@ -53,10 +94,97 @@ public:
 
     void save(Archive &ar) const override;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_transformer
+    ///  \brief         Returns the `Transformer` created by the `Estimator` at
+    ///                 `IndexV` within the pipeline, which can be used to change
+    ///                 the `Transformer's` runtime settings.
+    ///
+    // MSVC has problems when the method definition is separated from the declaration
+    template <int IndexV>
+    typename std::tuple_element<IndexV, std::tuple<EstimatorTs...>>::type::TransformerType & get_transformer(void) {
+        return _transformerChain.get_transformer(std::integral_constant<int, IndexV>());
+    }
+
     using BaseType::execute;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute
+    ///  \brief         Transforms a single value. When every `Transformer` in the
+    ///                 pipeline is a `StandardTransformer` (see
+    ///                 `PipelineTraits::IsFused`), the stages are invoked
+    ///                 directly, with each intermediate value held as a local
+    ///                 rather than passed through nested `std::function` callbacks.
+    ///
     // MSVC has problems when the method definition is separated from the declaration
     typename BaseType::TransformedType execute(typename BaseType::InputType &input) {
+        return execute_single(input, std::integral_constant<bool, PipelineTraits::IsFused>());
+    }
+
+    typename BaseType::TransformedType execute(typename BaseType::InputType const &input) {
+        typename BaseType::InputType        temp(input);
+
+        return execute(temp);
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cInputs` values, writing the result for
+    ///                 `pInputs[i]` to `pOutputs[i]` (which must already be
+    ///                 constructed). The input is processed in blocks, where
+    ///                 each stage transforms the entire block before the next
+    ///                 stage is invoked; the buffers that hold the intermediate
+    ///                 values are allocated once and reused for every block.
+    ///                 Only available when `PipelineTraits::IsFused`.
+    ///
+    // MSVC has problems when the method definition is separated from the declaration
+    void execute_batch(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) {
+        static_assert(PipelineTraits::IsFused, "Batch execution requires that every Transformer in the pipeline is a StandardTransformer");
+
+        if(cInputs == 0)
+            return;
+
+        if(pInputs == nullptr)
+            throw std::invalid_argument("pInputs");
+        if(pOutputs == nullptr)
+            throw std::invalid_argument("pOutputs");
+
+        // Large enough to amortize the per-stage overhead, small enough that
+        // the intermediate values remain in cache between stages.
+        static constexpr size_t const       BlockSize = 256;
+
+        typename TransformerChain::BatchBuffers         buffers(std::min(cInputs, BlockSize));
+
+        while(cInputs) {
+            size_t const                    cBlock(std::min(cInputs, BlockSize));
+
+            _transformerChain.execute_fused_batch(pInputs, cBlock, pOutputs, buffers);
+
+            pInputs += cBlock;
+            pOutputs += cBlock;
+            cInputs -= cBlock;
+        }
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    using TransformerChain                  = typename PipelineTraits::TransformerChain;
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    TransformerChain                        _transformerChain;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+
+    // MSVC has problems when the method definition is separated from the declaration
+    typename BaseType::TransformedType execute_single(typename BaseType::InputType &input, std::true_type /*IsFused*/) {
+        return _transformerChain.execute_fused(input);
+    }
+
+    // MSVC has problems when the method definition is separated from the declaration
+    typename BaseType::TransformedType execute_single(typename BaseType::InputType &input, std::false_type /*IsFused*/) {
         // ----------------------------------------------------------------------
         using TransformedType               = typename BaseType::TransformedType;
         // ----------------------------------------------------------------------
@@ -80,24 +208,6 @@ public:
         return std::move(*pResult);
     }
 
-    typename BaseType::TransformedType execute(typename BaseType::InputType const &input) {
-        typename BaseType::InputType        temp(input);
-
-        return execute(temp);
-    }
-
-private:
-    // ----------------------------------------------------------------------
-    // |  Private Types
-    using TransformerChain                  = typename PipelineTraits::TransformerChain;
-
-    // ----------------------------------------------------------------------
-    // |  Private Data
-    TransformerChain                        _transformerChain;
-
-    // ----------------------------------------------------------------------
-    // |  Private Methods
-
     // MSVC has problems when attempting to separate the definition from the declaration
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
         _transformerChain.execute(input, callback);
@@ -142,6 +252,7 @@ public:
     // |
     // ----------------------------------------------------------------------
     PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations);
+    PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, PipelinedTraining pipelinedTraining);
 
     /////////////////////////////////////////////////////////////////////////
     ///  \fn            PipelineExecutionEstimatorImpl
@@ -190,6 +301,9 @@ public:
     template <typename... ConstructFuncTs>
     PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, ConstructFuncTs &&... args);
 
+    template <typename... ConstructFuncTs>
+    PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, PipelinedTraining pipelinedTraining, ConstructFuncTs &&... args);
+
     ~PipelineExecutionEstimatorImpl(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(PipelineExecutionEstimatorImpl);
@@ -201,6 +315,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     using EstimatorChain                    = typename PipelineTraits::EstimatorChain;
+    using InputTypes                        = std::vector<typename BaseType::InputType>;
 
     // ----------------------------------------------------------------------
     // |
@@ -209,6 +324,19 @@ private:
     // ----------------------------------------------------------------------
     EstimatorChain                          _estimatorChain;
 
+    size_t const                            _chunkSize;         // 0 when training isn't pipelined
+    size_t const                            _maxQueuedChunks;
+    size_t const                            _maxReplayItems;
+
+    // Items seen during pipelined training, replayed when an `Estimator` requests another pass
+    InputTypes                              _replayItems;
+
+    // False once `_maxReplayItems` has been exceeded; the caller replays the data from then on
+    bool                                    _isReplayingItems;
+
+    // std::vector<bool> doesn't provide contiguous storage
+    static constexpr bool const             CanReplayItems = std::is_copy_constructible<typename BaseType::InputType>::value && std::is_same<typename BaseType::InputType, bool>::value == false;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -218,12 +346,28 @@ private:
 
     // MSVC has problems when attempting to separate the definition from the declaration
     FitResult fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) override {
-        return _estimatorChain.fit(pBuffer, cBuffer);
+        if(_chunkSize == 0)
+            return _estimatorChain.fit(pBuffer, cBuffer);
+
+        return fit_pipelined(pBuffer, cBuffer, std::integral_constant<bool, CanReplayItems>());
     }
 
     bool on_data_completed_impl(void) override;
     void complete_training_impl(void) override;
 
+    // MSVC has problems when attempting to separate the definition from the declaration
+    FitResult fit_pipelined(typename BaseType::InputType const *pItems, size_t cItems) {
+        Details::Impl::BufferChunkSource<typename BaseType::InputType>     source(pItems, cItems, _chunkSize);
+
+        return _estimatorChain.fit_stream(source, _maxQueuedChunks);
+    }
+
+    FitResult fit_pipelined(typename BaseType::InputType const *pItems, size_t cItems, std::true_type /*CanReplayItems*/);
+    FitResult fit_pipelined(typename BaseType::InputType const *pItems, size_t cItems, std::false_type /*CanReplayItems*/);
+
+    bool on_data_completed_pipelined(std::true_type /*CanReplayItems*/);
+    bool on_data_completed_pipelined(std::false_type /*CanReplayItems*/);
+
     // MSVC has problems when attempting to separate the definition from the declaration
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
         return typename BaseType::TransformerUniquePtr(new TransformerType(_estimatorChain));
@@ -240,6 +384,31 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 
+// ----------------------------------------------------------------------
+// |
+// |  PipelinedTraining
+// |
+// ----------------------------------------------------------------------
+inline PipelinedTraining::PipelinedTraining(size_t chunkSize, size_t maxQueuedChunks, size_t maxReplayItems) :
+    ChunkSize(
+        [&chunkSize](void) -> size_t & {
+            if(chunkSize == 0)
+                throw std::invalid_argument("chunkSize");
+
+            return chunkSize;
+        }()
+    ),
+    MaxQueuedChunks(
+        [&maxQueuedChunks](void) -> size_t & {
+            if(maxQueuedChunks == 0)
+                throw std::invalid_argument("maxQueuedChunks");
+
+            return maxQueuedChunks;
+        }()
+    ),
+    MaxReplayItems(maxReplayItems) {
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  PipelineExecutionTransformer
@@ -273,14 +442,45 @@ void PipelineExecutionTransformer<EstimatorTs...>::save(Archive &ar) const /*ove
 template <typename... EstimatorTs>
 PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations) :
     BaseType(name, pAllColumnAnnotations),
-    _estimatorChain(pAllColumnAnnotations) {
+    _estimatorChain(pAllColumnAnnotations),
+    _chunkSize(0),
+    _maxQueuedChunks(0),
+    _maxReplayItems(0),
+    _isReplayingItems(false) {
+}
+
+template <typename... EstimatorTs>
+PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, PipelinedTraining pipelinedTraining) :
+    BaseType(name, pAllColumnAnnotations),
+    _estimatorChain(pAllColumnAnnotations),
+    _chunkSize(pipelinedTraining.ChunkSize),
+    _maxQueuedChunks(pipelinedTraining.MaxQueuedChunks),
+    _maxReplayItems(pipelinedTraining.MaxReplayItems),
+    _isReplayingItems(false) {
 }
 
 template <typename... EstimatorTs>
 template <typename... ConstructFuncTs>
 PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, ConstructFuncTs &&... funcs) :
     BaseType(name, pAllColumnAnnotations),
-    _estimatorChain(std::forward<ConstructFuncTs>(funcs)...) {
+    _estimatorChain(std::forward<ConstructFuncTs>(funcs)...),
+    _chunkSize(0),
+    _maxQueuedChunks(0),
+    _maxReplayItems(0),
+    _isReplayingItems(false) {
+
+    static_assert(sizeof...(EstimatorTs) == sizeof...(ConstructFuncTs), "The number of constructor creation args must be equal to the number of estimators");
+}
+
+template <typename... EstimatorTs>
+template <typename... ConstructFuncTs>
+PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, PipelinedTraining pipelinedTraining, ConstructFuncTs &&... funcs) :
+    BaseType(name, pAllColumnAnnotations),
+    _estimatorChain(std::forward<ConstructFuncTs>(funcs)...),
+    _chunkSize(pipelinedTraining.ChunkSize),
+    _maxQueuedChunks(pipelinedTraining.MaxQueuedChunks),
+    _maxReplayItems(pipelinedTraining.MaxReplayItems),
+    _isReplayingItems(false) {
 
     static_assert(sizeof...(EstimatorTs) == sizeof...(ConstructFuncTs), "The number of constructor creation args must be equal to the number of estimators");
 }
@@ -290,17 +490,86 @@ PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(c
 // ----------------------------------------------------------------------
 template <typename... EstimatorTs>
 bool PipelineExecutionEstimatorImpl<EstimatorTs...>::begin_training_impl(void) /*override*/ {
+    _isReplayingItems = _maxReplayItems != 0;
+
     return _estimatorChain.begin_training();
 }
 
 template <typename... EstimatorTs>
 bool PipelineExecutionEstimatorImpl<EstimatorTs...>::on_data_completed_impl(void) /*override*/ {
-    return _estimatorChain.on_data_completed();
+    if(_chunkSize == 0)
+        return _estimatorChain.on_data_completed();
+
+    return on_data_completed_pipelined(std::integral_constant<bool, CanReplayItems>());
 }
 
 template <typename... EstimatorTs>
 void PipelineExecutionEstimatorImpl<EstimatorTs...>::complete_training_impl(void) /*override*/ {
     _estimatorChain.complete_training();
+
+    InputTypes().swap(_replayItems);
+}
+
+template <typename... EstimatorTs>
+FitResult PipelineExecutionEstimatorImpl<EstimatorTs...>::fit_pipelined(typename BaseType::InputType const *pItems, size_t cItems, std::true_type /*CanReplayItems*/) {
+    // The items are only needed while training may still be restarted
+    if(_isReplayingItems == false || _estimatorChain.can_reset() == false)
+        return fit_pipelined(pItems, cItems);
+
+    // Rather than retaining an unbounded number of items, release them and
+    // let the caller replay the data
+    if(cItems > _maxReplayItems - _replayItems.size()) {
+        _isReplayingItems = false;
+        InputTypes().swap(_replayItems);
+
+        return fit_pipelined(pItems, cItems);
+    }
+
+    _replayItems.insert(_replayItems.end(), pItems, pItems + cItems);
+
+    FitResult                               result(fit_pipelined(pItems, cItems));
+
+    while(result == FitResult::Reset)
+        result = fit_pipelined(_replayItems.data(), _replayItems.size());
+
+    if(_estimatorChain.can_reset() == false)
+        InputTypes().swap(_replayItems);
+
+    return result;
+}
+
+template <typename... EstimatorTs>
+FitResult PipelineExecutionEstimatorImpl<EstimatorTs...>::fit_pipelined(typename BaseType::InputType const *pItems, size_t cItems, std::false_type /*CanReplayItems*/) {
+    // The caller replays the data
+    return fit_pipelined(pItems, cItems);
+}
+
+template <typename... EstimatorTs>
+bool PipelineExecutionEstimatorImpl<EstimatorTs...>::on_data_completed_pipelined(std::true_type /*CanReplayItems*/) {
+    // The items have been released, so the caller replays the data
+    if(_isReplayingItems == false || _estimatorChain.can_reset() == false)
+        return _estimatorChain.on_data_completed();
+
+    // Replay the items rather than asking the caller for another pass
+    while(_estimatorChain.on_data_completed() == false) {
+        FitResult                           result(FitResult::Reset);
+
+        while(result == FitResult::Reset)
+            result = fit_pipelined(_replayItems.data(), _replayItems.size());
+
+        if(result == FitResult::Complete)
+            break;
+    }
+
+    InputTypes().swap(_replayItems);
+
+    return true;
+}
+
+template <typename... EstimatorTs>
+bool PipelineExecutionEstimatorImpl<EstimatorTs...>::on_data_completed_pipelined(std::false_type /*CanReplayItems*/) {
+    // The caller replays the data
+    return _estimatorChain.on_data_completed();
 }
 
 } // namespace Components
@@ -0,0 +1,202 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "QuantileSketch.h"
+#include "TrainingOnlyEstimatorImpl.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+static constexpr char const * const         QuantileEstimatorName("QuantileEstimator");
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileAnnotationData
+///  \brief         Annotation that summarizes the distribution of the values
+///                 encountered during training, which can be queried for any
+///                 quantile.
+///
+template <typename T>
+class QuantileAnnotationData {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using SketchType                        = QuantileSketch<T>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    SketchType const                        Sketch;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    QuantileAnnotationData(SketchType sketch);
+    ~QuantileAnnotationData(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(QuantileAnnotationData);
+};
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileTrainingOnlyPolicy
+///  \brief         `QuantileEstimator` implementation details.
+///
+template <typename InputT, typename TransformedT>
+class QuantileTrainingOnlyPolicy {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    static_assert(Traits<TransformedT>::IsNullableType == false || Traits<TransformedT>::IsNativeNullableType, "'TransformedT' should not be a nullable type");
+
+    using InputType                         = InputT;
+    using SketchType                        = QuantileSketch<TransformedT>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr char const * const     NameValue = QuantileEstimatorName;
+
+    // The rank of a quantile calculated with the default configuration is
+    // within 0.1% of the number of values of the exact rank (with 99%
+    // confidence); the sketch retains fewer than 10,000 values.
+    static constexpr std::float_t const     DefaultMaxRankError = 0.001f;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    QuantileTrainingOnlyPolicy(std::float_t maxRankError=DefaultMaxRankError);
+
+    void fit(InputType const &input);
+    QuantileAnnotationData<TransformedT> complete_training(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    SketchType                              _sketch;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void fit_impl(InputType const &input, std::true_type /*is_nullable*/);
+    void fit_impl(InputType const &input, std::false_type /*is_nullable*/);
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       QuantileEstimator
+///  \brief         An `Estimator` that summarizes the (non-null) values
+///                 encountered during training in a single pass, using memory
+///                 that is independent of the number of values, so that
+///                 quantiles can be calculated.
+///
+template <
+    typename InputT,
+    typename TransformedT=InputT,
+    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()
+>
+using QuantileEstimator                     = TrainingOnlyEstimatorImpl<Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>, MaxNumTrainingItemsV>;
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  QuantileAnnotationData
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+QuantileAnnotationData<T>::QuantileAnnotationData(SketchType sketch) :
+    Sketch(
+        std::move(
+            [&sketch](void) -> SketchType & {
+                if(sketch.empty())
+                    throw std::invalid_argument("sketch");
+
+                return sketch;
+            }()
+        )
+    ) {
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Details::QuantileTrainingOnlyPolicy
+// |
+// ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT>
+constexpr std::float_t const Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::DefaultMaxRankError;
+
+template <typename InputT, typename TransformedT>
+Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::QuantileTrainingOnlyPolicy(std::float_t maxRankError) :
+    _sketch(SketchType::GetK(maxRankError)) {
+}
+
+template <typename InputT, typename TransformedT>
+void Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::fit(InputType const &input) {
+    fit_impl(input, std::integral_constant<bool, Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT, typename TransformedT>
+QuantileAnnotationData<TransformedT> Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::complete_training(void) {
+    if(_sketch.empty())
+        throw std::runtime_error("No elements were provided during training");
+
+    SketchType                              sketch(_sketch.k());
+
+    std::swap(sketch, _sketch);
+    return QuantileAnnotationData<TransformedT>(std::move(sketch));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT>
+void Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::fit_impl(InputType const &input, std::true_type /*is_nullable*/) {
+    if(Traits<InputT>::IsNull(input))
+        return;
+
+    _sketch.update(static_cast<TransformedT>(Traits<InputT>::GetNullableValue(input)));
+}
+
+template <typename InputT, typename TransformedT>
+void Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::fit_impl(InputType const &input, std::false_type /*is_nullable*/) {
+    _sketch.update(static_cast<TransformedT>(input));
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
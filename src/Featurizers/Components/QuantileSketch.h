@@ -0,0 +1,604 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileSketch
+///  \brief         Mergeable, bounded-memory summary of a stream of values
+///                 that answers quantile queries (a KLL sketch).
+///
+///                 Values are added to level 0; when the sketch is full, the
+///                 lowest level that has reached its capacity is sorted and
+///                 every other value (starting at a random offset) is
+///                 promoted to the next level, where each value represents
+///                 twice as many of the original values. The capacity of a
+///                 level shrinks by a factor of 2/3 for each level below the
+///                 top one, so the sketch retains roughly 3 * k values
+///                 regardless of the number of values added.
+///
+///                 With 99% confidence, the rank of a value returned by
+///                 `quantile` is within `GetMaxRankError(k) * count()` of
+///                 the requested rank (about 1.3% when k is 200). Results are
+///                 exact until the sketch is first compacted (fewer than
+///                 roughly k values) and min/max values are always exact.
+///
+///                 Random offsets are generated from a seed stored in the
+///                 sketch, so training is deterministic.
+///
+template <typename T>
+class QuantileSketch {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using value_type                        = T;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint16_t const    DefaultK = 200;
+    static constexpr std::uint16_t const    MinK = 8;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetK
+    ///  \brief         Returns the smallest k whose rank error is at most
+    ///                 `maxRankError`, which must be in (0, 1).
+    ///
+    static std::uint16_t GetK(std::float_t maxRankError);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetMaxRankError
+    ///  \brief         Returns the normalized rank error (with 99%
+    ///                 confidence) of a sketch created with `k`.
+    ///
+    static std::float_t GetMaxRankError(std::uint16_t k);
+
+    explicit QuantileSketch(std::uint16_t k=DefaultK);
+    explicit QuantileSketch(Archive &ar);
+
+    ~QuantileSketch(void) = default;
+
+    QuantileSketch(QuantileSketch const &) = default;
+    QuantileSketch(QuantileSketch &&) = default;
+
+    QuantileSketch & operator =(QuantileSketch const &) = default;
+    QuantileSketch & operator =(QuantileSketch &&) = default;
+
+    bool operator==(QuantileSketch const &other) const;
+
+    void save(Archive &ar) const;
+
+    std::uint16_t k(void) const;
+
+    /// Number of values added to the sketch
+    std::uint64_t count(void) const;
+    bool empty(void) const;
+
+    /// Number of values retained by the sketch
+    size_t size(void) const;
+
+    T const & min(void) const;
+    T const & max(void) const;
+
+    void update(T value);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            merge
+    ///  \brief         Adds the values summarized by another sketch, which
+    ///                 must have been created with the same k.
+    ///
+    void merge(QuantileSketch const &other);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            quantile
+    ///  \brief         Returns the value at `rank` (in [0, 1]) of the sorted
+    ///                 values; when `rank * (count() - 1)` isn't an integer,
+    ///                 the lower of the two neighboring values is returned.
+    ///
+    T quantile(double rank) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            interpolated_quantile
+    ///  \brief         Returns the value at `rank` (in [0, 1]) of the sorted
+    ///                 values, linearly interpolating between the two
+    ///                 neighboring values when `rank * (count() - 1)` isn't
+    ///                 an integer (the same definition used by numpy's
+    ///                 `percentile`). Only available for arithmetic types.
+    ///
+    double interpolated_quantile(double rank) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using Level                             = std::vector<T>;
+    using Levels                            = std::vector<Level>;
+    using WeightedValues                    = std::vector<std::pair<T, std::uint64_t>>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint32_t const    InitialRandomState = 0x2545F491;
+
+    std::uint16_t                           _k;
+    std::uint64_t                           _count;
+    std::uint32_t                           _randomState;
+
+    T                                       _min;
+    T                                       _max;
+
+    Levels                                  _levels;        // Values at level h represent 2^h values
+    size_t                                  _size;
+    size_t                                  _capacity;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    QuantileSketch(std::uint16_t k, std::uint64_t count, std::uint32_t randomState, T min, T max, Levels levels);
+
+    size_t get_level_capacity(size_t level) const;
+    void update_capacity(void);
+
+    void compress(void);
+    bool next_random_bit(void);
+
+    WeightedValues get_sorted_values(void) const;
+
+    T const & get_value_at_rank(WeightedValues const &values, std::uint64_t rank) const;
+    void get_ranks(double rank, std::uint64_t &lower, double &fraction) const;
+
+    double interpolated_quantile(double rank, std::true_type /*is_arithmetic*/) const;
+    double interpolated_quantile(double rank, std::false_type /*is_arithmetic*/) const;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+constexpr std::uint16_t const QuantileSketch<T>::DefaultK;
+
+template <typename T>
+constexpr std::uint16_t const QuantileSketch<T>::MinK;
+
+template <typename T>
+constexpr std::uint32_t const QuantileSketch<T>::InitialRandomState;
+
+// The error bound is the empirical fit used by the Apache DataSketches KLL
+// implementation for single quantile queries (which uses the same capacity
+// ratio and minimum level width as this implementation).
+template <typename T>
+std::uint16_t QuantileSketch<T>::GetK(std::float_t maxRankError) {
+    if(maxRankError <= 0.0f || maxRankError >= 1.0f)
+        throw std::invalid_argument("maxRankError");
+
+    double const                            k(std::ceil(std::pow(2.296 / static_cast<double>(maxRankError), 1.0 / 0.9723)));
+
+    if(k > static_cast<double>(std::numeric_limits<std::uint16_t>::max()))
+        throw std::invalid_argument("maxRankError");
+
+    return std::max(MinK, static_cast<std::uint16_t>(k));
+}
+
+template <typename T>
+std::float_t QuantileSketch<T>::GetMaxRankError(std::uint16_t k) {
+    if(k < MinK)
+        throw std::invalid_argument("k");
+
+    return static_cast<std::float_t>(2.296 / std::pow(static_cast<double>(k), 0.9723));
+}
+
+template <typename T>
+QuantileSketch<T>::QuantileSketch(std::uint16_t k) :
+    QuantileSketch(
+        [&k](void) -> std::uint16_t {
+            if(k < MinK)
+                throw std::invalid_argument("k");
+
+            return k;
+        }(),
+        0,
+        InitialRandomState,
+        T(),
+        T(),
+        Levels(1)
+    ) {
+}
+
+template <typename T>
+QuantileSketch<T>::QuantileSketch(Archive &ar) :
+    QuantileSketch(
+        [&ar](void) {
+            // Version
+            std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
+            std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+            if(majorVersion != 1 || minorVersion != 0)
+                throw std::runtime_error("Unsupported archive version");
+
+            // Data
+            std::uint16_t                   k(Traits<std::uint16_t>::deserialize(ar));
+            std::uint64_t                   count(Traits<std::uint64_t>::deserialize(ar));
+            std::uint32_t                   randomState(Traits<std::uint32_t>::deserialize(ar));
+            T                               min(count ? Traits<T>::deserialize(ar) : T());
+            T                               max(count ? Traits<T>::deserialize(ar) : T());
+            Levels                          levels(Traits<Levels>::deserialize(ar));
+
+            // Each compaction preserves the total weight of the values
+            std::uint64_t                   weight(0);
+
+            for(size_t level = 0; level < levels.size() && level < 64; ++level)
+                weight += static_cast<std::uint64_t>(levels[level].size()) << level;
+
+            if(k < MinK || randomState == 0 || levels.empty() || levels.size() > 64 || weight != count)
+                throw std::runtime_error("Invalid quantile sketch");
+
+            return QuantileSketch(k, count, randomState, std::move(min), std::move(max), std::move(levels));
+        }()
+    ) {
+}
+
+template <typename T>
+bool QuantileSketch<T>::operator==(QuantileSketch const &other) const {
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    return _k == other._k
+        && _count == other._count
+        && _randomState == other._randomState
+        && (_count == 0 || (_min == other._min && _max == other._max))
+        && _levels == other._levels;
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+}
+
+template <typename T>
+void QuantileSketch<T>::save(Archive &ar) const {
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Data
+    Traits<std::uint16_t>::serialize(ar, _k);
+    Traits<std::uint64_t>::serialize(ar, _count);
+    Traits<std::uint32_t>::serialize(ar, _randomState);
+
+    if(_count) {
+        Traits<T>::serialize(ar, _min);
+        Traits<T>::serialize(ar, _max);
+    }
+
+    Traits<Levels>::serialize(ar, _levels);
+}
+
+template <typename T>
+std::uint16_t QuantileSketch<T>::k(void) const {
+    return _k;
+}
+
+template <typename T>
+std::uint64_t QuantileSketch<T>::count(void) const {
+    return _count;
+}
+
+template <typename T>
+bool QuantileSketch<T>::empty(void) const {
+    return _count == 0;
+}
+
+template <typename T>
+size_t QuantileSketch<T>::size(void) const {
+    return _size;
+}
+
+template <typename T>
+T const & QuantileSketch<T>::min(void) const {
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    return _min;
+}
+
+template <typename T>
+T const & QuantileSketch<T>::max(void) const {
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    return _max;
+}
+
+template <typename T>
+void QuantileSketch<T>::update(T value) {
+    if(_count == 0) {
+        _min = value;
+        _max = value;
+    }
+    else if(value < _min)
+        _min = value;
+    else if(_max < value)
+        _max = value;
+
+    _levels[0].emplace_back(std::move(value));
+
+    ++_count;
+    ++_size;
+
+    if(_size >= _capacity)
+        compress();
+}
+
+template <typename T>
+void QuantileSketch<T>::merge(QuantileSketch const &other) {
+    if(other._k != _k)
+        throw std::invalid_argument("other");
+
+    if(other._count == 0)
+        return;
+
+    if(_count == 0) {
+        *this = other;
+        return;
+    }
+
+    if(other._min < _min)
+        _min = other._min;
+    if(_max < other._max)
+        _max = other._max;
+
+    if(other._levels.size() > _levels.size())
+        _levels.resize(other._levels.size());
+
+    for(size_t level = 0; level < other._levels.size(); ++level)
+        _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+
+    _count += other._count;
+    _size += other._size;
+
+    update_capacity();
+
+    if(_size >= _capacity)
+        compress();
+}
+
+template <typename T>
+T QuantileSketch<T>::quantile(double rank) const {
+    std::uint64_t                           lower;
+    double                                  fraction;
+
+    get_ranks(rank, lower, fraction);
+
+    if(lower == 0)
+        return _min;
+    if(lower == _count - 1)
+        return _max;
+
+    return get_value_at_rank(get_sorted_values(), lower);
+}
+
+template <typename T>
+double QuantileSketch<T>::interpolated_quantile(double rank) const {
+    return interpolated_quantile(rank, std::integral_constant<bool, std::is_arithmetic<T>::value>());
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+QuantileSketch<T>::QuantileSketch(std::uint16_t k, std::uint64_t count, std::uint32_t randomState, T min, T max, Levels levels) :
+    _k(std::move(k)),
+    _count(std::move(count)),
+    _randomState(std::move(randomState)),
+    _min(std::move(min)),
+    _max(std::move(max)),
+    _levels(std::move(levels)),
+    _size(
+        [this](void) {
+            size_t                          size(0);
+
+            for(auto const &level : _levels)
+                size += level.size();
+
+            return size;
+        }()
+    ),
+    _capacity(0) {
+    update_capacity();
+}
+
+template <typename T>
+size_t QuantileSketch<T>::get_level_capacity(size_t level) const {
+    // Minimum number of values retained at each level
+    static constexpr size_t const           MinLevelCapacity = 8;
+
+    double                                  capacity(static_cast<double>(_k));
+
+    for(size_t depth = _levels.size() - level - 1; depth && capacity > MinLevelCapacity; --depth)
+        capacity *= 2.0 / 3.0;
+
+    return std::max(MinLevelCapacity, static_cast<size_t>(std::ceil(capacity)));
+}
+
+template <typename T>
+void QuantileSketch<T>::update_capacity(void) {
+    _capacity = 0;
+
+    for(size_t level = 0; level < _levels.size(); ++level)
+        _capacity += get_level_capacity(level);
+}
+
+template <typename T>
+void QuantileSketch<T>::compress(void) {
+    while(_size >= _capacity) {
+        size_t                              level(0);
+
+        // At least one level must be at its capacity when the sketch is full
+        while(_levels[level].size() < get_level_capacity(level))
+            ++level;
+
+        if(level + 1 == _levels.size()) {
+            _levels.emplace_back();
+            update_capacity();
+        }
+
+        Level &                             values(_levels[level]);
+        Level &                             nextValues(_levels[level + 1]);
+
+        std::sort(values.begin(), values.end());
+
+        // When there are an odd number of values, the largest one remains at
+        // this level
+        size_t const                        numValues(values.size() & ~static_cast<size_t>(1));
+
+        for(size_t index = next_random_bit() ? 1 : 0; index < numValues; index += 2)
+            nextValues.emplace_back(std::move(values[index]));
+
+        values.erase(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(numValues));
+        _size -= numValues / 2;
+    }
+}
+
+template <typename T>
+bool QuantileSketch<T>::next_random_bit(void) {
+    // xorshift32
+    _randomState ^= _randomState << 13;
+    _randomState ^= _randomState >> 17;
+    _randomState ^= _randomState << 5;
+
+    return (_randomState & 1) != 0;
+}
+
+template <typename T>
+typename QuantileSketch<T>::WeightedValues QuantileSketch<T>::get_sorted_values(void) const {
+    WeightedValues                          values;
+
+    values.reserve(_size);
+
+    for(size_t level = 0; level < _levels.size(); ++level) {
+        std::uint64_t const                 weight(static_cast<std::uint64_t>(1) << level);
+
+        for(auto const &value : _levels[level])
+            values.emplace_back(value, weight);
+    }
+
+    std::sort(
+        values.begin(),
+        values.end(),
+        [](std::pair<T, std::uint64_t> const &a, std::pair<T, std::uint64_t> const &b) {
+            return a.first < b.first;
+        }
+    );
+
+    return values;
+}
+
+template <typename T>
+T const & QuantileSketch<T>::get_value_at_rank(WeightedValues const &values, std::uint64_t rank) const {
+    assert(values.empty() == false);
+
+    std::uint64_t                           cumulativeWeight(0);
+
+    for(auto const &value : values) {
+        cumulativeWeight += value.second;
+
+        if(rank < cumulativeWeight)
+            return value.first;
+    }
+
+    return values.back().first;
+}
+
+template <typename T>
+void QuantileSketch<T>::get_ranks(double rank, std::uint64_t &lower, double &fraction) const {
+    if(rank < 0.0 || rank > 1.0)
+        throw std::invalid_argument("rank");
+
+    if(_count == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    double const                            position(rank * static_cast<double>(_count - 1));
+
+    lower = std::min(static_cast<std::uint64_t>(position), _count - 1);
+    fraction = position - static_cast<double>(lower);
+}
+
+template <typename T>
+double QuantileSketch<T>::interpolated_quantile(double rank, std::true_type /*is_arithmetic*/) const {
+    std::uint64_t                           lower;
+    double                                  fraction;
+
+    get_ranks(rank, lower, fraction);
+
+    WeightedValues const                    values(lower == 0 && fraction <= 0.0 ? WeightedValues() : get_sorted_values());
+    auto const                              getValue(
+        [this, &values](std::uint64_t r) -> double {
+            if(r == 0)
+                return static_cast<double>(_min);
+            if(r == _count - 1)
+                return static_cast<double>(_max);
+
+            return static_cast<double>(get_value_at_rank(values, r));
+        }
+    );
+
+    double const                            lowerValue(getValue(lower));
+
+    if(fraction <= 0.0)
+        return lowerValue;
+
+    return lowerValue + (getValue(lower + 1) - lowerValue) * fraction;
+}
+
+template <typename T>
+double QuantileSketch<T>::interpolated_quantile(double, std::false_type /*is_arithmetic*/) const {
+    throw std::logic_error("Interpolated quantiles are only available for arithmetic types");
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,349 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if (defined __x86_64__ || defined _M_X64 || defined __i386__ || defined _M_IX86)
+#   define FEATURIZER_SCALE_KERNELS_X86
+#   include <immintrin.h>
+
+#   if (defined _MSC_VER)
+#       include <intrin.h>
+#   endif
+#endif
+
+// GCC and Clang only allow intrinsics within functions compiled for the corresponding
+// instruction set; MSVC makes all intrinsics available everywhere.
+#if (defined FEATURIZER_SCALE_KERNELS_X86 && (defined __GNUC__ || defined __clang__))
+#   define FEATURIZER_SCALE_KERNELS_TARGET(Target)  __attribute__((target(Target)))
+#else
+#   define FEATURIZER_SCALE_KERNELS_TARGET(Target)
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          SimdLevel
+///  \brief         Instruction sets used by the scale kernels, ordered from
+///                 the least to the most capable.
+///
+enum class SimdLevel : unsigned char {
+    Scalar = 0,
+    Sse2,
+    Avx2,
+    Avx512
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetSimdLevel
+///  \brief         Returns the most capable `SimdLevel` supported by both
+///                 the CPU and the operating system. The value is calculated
+///                 once per process.
+///
+inline SimdLevel GetSimdLevel(void);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ShiftAndScale
+///  \brief         Calculates `(input - offset) / divisor` for each input.
+///
+///                 Each input is converted to `TransformedT` (and then to
+///                 `ComputeT`) before the calculation, and the result is
+///                 converted to `TransformedT`; this matches the conversions
+///                 performed by the scalar `Transformers`, so results are
+///                 identical regardless of the instruction set used. NaN
+///                 inputs produce NaN outputs.
+///
+///                 `pInputs` and `pOutputs` may reference the same buffer
+///                 when the types are the same.
+///
+template <typename InputT, typename TransformedT, typename ComputeT>
+void ShiftAndScale(
+    InputT const *pInputs,
+    size_t cInputs,
+    TransformedT *pOutputs,
+    ComputeT offset,
+    ComputeT divisor,
+    SimdLevel level=GetSimdLevel()
+);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+inline SimdLevel DetectSimdLevel(void) {
+#if (defined FEATURIZER_SCALE_KERNELS_X86)
+#   if (defined _MSC_VER)
+    int                                     info[4];
+
+    __cpuid(info, 0);
+
+    int const                               maxLeaf(info[0]);
+
+    __cpuid(info, 1);
+
+    bool const                              hasSse2((info[3] & (1 << 26)) != 0);
+    bool const                              hasOsXSave((info[2] & (1 << 27)) != 0);
+    bool const                              hasAvx((info[2] & (1 << 28)) != 0);
+
+    if(hasOsXSave && hasAvx && maxLeaf >= 7) {
+        unsigned long long const            xcr0(_xgetbv(0));
+
+        // The OS must save the XMM and YMM (and for AVX-512, the opmask and ZMM) registers
+        if((xcr0 & 0x06) == 0x06) {
+            __cpuidex(info, 7, 0);
+
+            if((xcr0 & 0xe6) == 0xe6 && (info[1] & (1 << 16)) != 0)
+                return SimdLevel::Avx512;
+
+            if((info[1] & (1 << 5)) != 0)
+                return SimdLevel::Avx2;
+        }
+    }
+
+    if(hasSse2)
+        return SimdLevel::Sse2;
+#   else
+    // `__builtin_cpu_supports` takes OS support for the extended registers into account
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f"))
+        return SimdLevel::Avx512;
+    if(__builtin_cpu_supports("avx2"))
+        return SimdLevel::Avx2;
+    if(__builtin_cpu_supports("sse2"))
+        return SimdLevel::Sse2;
+#   endif
+#endif
+
+    return SimdLevel::Scalar;
+}
+
+template <typename T>
+void ShiftAndScaleScalar(T const *pInputs, size_t cInputs, T *pOutputs, T offset, T divisor) {
+    for(size_t i = 0; i < cInputs; ++i)
+        pOutputs[i] = static_cast<T>((pInputs[i] - offset) / divisor);
+}
+
+#if (defined FEATURIZER_SCALE_KERNELS_X86)
+
+// ----------------------------------------------------------------------
+// |  SSE2
+FEATURIZER_SCALE_KERNELS_TARGET("sse2")
+inline void ShiftAndScaleSse2(float const *pInputs, size_t cInputs, float *pOutputs, float offset, float divisor) {
+    __m128 const                            vOffset(_mm_set1_ps(offset));
+    __m128 const                            vDivisor(_mm_set1_ps(divisor));
+    size_t                                  i(0);
+
+    for(; i + 4 <= cInputs; i += 4)
+        _mm_storeu_ps(pOutputs + i, _mm_div_ps(_mm_sub_ps(_mm_loadu_ps(pInputs + i), vOffset), vDivisor));
+
+    for(; i < cInputs; ++i)
+        pOutputs[i] = (pInputs[i] - offset) / divisor;
+}
+
+FEATURIZER_SCALE_KERNELS_TARGET("sse2")
+inline void ShiftAndScaleSse2(double const *pInputs, size_t cInputs, double *pOutputs, double offset, double divisor) {
+    __m128d const                           vOffset(_mm_set1_pd(offset));
+    __m128d const                           vDivisor(_mm_set1_pd(divisor));
+    size_t                                  i(0);
+
+    for(; i + 2 <= cInputs; i += 2)
+        _mm_storeu_pd(pOutputs + i, _mm_div_pd(_mm_sub_pd(_mm_loadu_pd(pInputs + i), vOffset), vDivisor));
+
+    for(; i < cInputs; ++i)
+        pOutputs[i] = (pInputs[i] - offset) / divisor;
+}
+
+// ----------------------------------------------------------------------
+// |  AVX2
+FEATURIZER_SCALE_KERNELS_TARGET("avx2")
+inline void ShiftAndScaleAvx2(float const *pInputs, size_t cInputs, float *pOutputs, float offset, float divisor) {
+    __m256 const                            vOffset(_mm256_set1_ps(offset));
+    __m256 const                            vDivisor(_mm256_set1_ps(divisor));
+    size_t                                  i(0);
+
+    for(; i + 8 <= cInputs; i += 8)
+        _mm256_storeu_ps(pOutputs + i, _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(pInputs + i), vOffset), vDivisor));
+
+    for(; i < cInputs; ++i)
+        pOutputs[i] = (pInputs[i] - offset) / divisor;
+}
+
+FEATURIZER_SCALE_KERNELS_TARGET("avx2")
+inline void ShiftAndScaleAvx2(double const *pInputs, size_t cInputs, double *pOutputs, double offset, double divisor) {
+    __m256d const                           vOffset(_mm256_set1_pd(offset));
+    __m256d const                           vDivisor(_mm256_set1_pd(divisor));
+    size_t                                  i(0);
+
+    for(; i + 4 <= cInputs; i += 4)
+        _mm256_storeu_pd(pOutputs + i, _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(pInputs + i), vOffset), vDivisor));
+
+    for(; i < cInputs; ++i)
+        pOutputs[i] = (pInputs[i] - offset) / divisor;
+}
+
+// ----------------------------------------------------------------------
+// |  AVX-512
+FEATURIZER_SCALE_KERNELS_TARGET("avx512f")
+inline void ShiftAndScaleAvx512(float const *pInputs, size_t cInputs, float *pOutputs, float offset, float divisor) {
+    __m512 const                            vOffset(_mm512_set1_ps(offset));
+    __m512 const                            vDivisor(_mm512_set1_ps(divisor));
+    size_t                                  i(0);
+
+    for(; i + 16 <= cInputs; i += 16)
+        _mm512_storeu_ps(pOutputs + i, _mm512_div_ps(_mm512_sub_ps(_mm512_loadu_ps(pInputs + i), vOffset), vDivisor));
+
+    if(i != cInputs) {
+        // Masked lanes are neither loaded, calculated, nor stored
+        __mmask16 const                     mask(static_cast<__mmask16>((1u << (cInputs - i)) - 1));
+
+        _mm512_mask_storeu_ps(
+            pOutputs + i,
+            mask,
+            _mm512_maskz_div_ps(mask, _mm512_maskz_sub_ps(mask, _mm512_maskz_loadu_ps(mask, pInputs + i), vOffset), vDivisor)
+        );
+    }
+}
+
+FEATURIZER_SCALE_KERNELS_TARGET("avx512f")
+inline void ShiftAndScaleAvx512(double const *pInputs, size_t cInputs, double *pOutputs, double offset, double divisor) {
+    __m512d const                           vOffset(_mm512_set1_pd(offset));
+    __m512d const                           vDivisor(_mm512_set1_pd(divisor));
+    size_t                                  i(0);
+
+    for(; i + 8 <= cInputs; i += 8)
+        _mm512_storeu_pd(pOutputs + i, _mm512_div_pd(_mm512_sub_pd(_mm512_loadu_pd(pInputs + i), vOffset), vDivisor));
+
+    if(i != cInputs) {
+        // Masked lanes are neither loaded, calculated, nor stored
+        __mmask8 const                      mask(static_cast<__mmask8>((1u << (cInputs - i)) - 1));
+
+        _mm512_mask_storeu_pd(
+            pOutputs + i,
+            mask,
+            _mm512_maskz_div_pd(mask, _mm512_maskz_sub_pd(mask, _mm512_maskz_loadu_pd(mask, pInputs + i), vOffset), vDivisor)
+        );
+    }
+}
+
+#endif // FEATURIZER_SCALE_KERNELS_X86
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ShiftAndScaleKernel
+///  \brief         Kernel for types without vectorized implementations.
+///
+template <typename T>
+void ShiftAndScaleKernel(SimdLevel, T const *pInputs, size_t cInputs, T *pOutputs, T offset, T divisor) {
+    ShiftAndScaleScalar(pInputs, cInputs, pOutputs, offset, divisor);
+}
+
+#if (defined FEATURIZER_SCALE_KERNELS_X86)
+
+inline void ShiftAndScaleKernel(SimdLevel level, float const *pInputs, size_t cInputs, float *pOutputs, float offset, float divisor) {
+    switch(level) {
+    case SimdLevel::Avx512:
+        ShiftAndScaleAvx512(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    case SimdLevel::Avx2:
+        ShiftAndScaleAvx2(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    case SimdLevel::Sse2:
+        ShiftAndScaleSse2(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    case SimdLevel::Scalar:
+        ShiftAndScaleScalar(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    }
+}
+
+inline void ShiftAndScaleKernel(SimdLevel level, double const *pInputs, size_t cInputs, double *pOutputs, double offset, double divisor) {
+    switch(level) {
+    case SimdLevel::Avx512:
+        ShiftAndScaleAvx512(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    case SimdLevel::Avx2:
+        ShiftAndScaleAvx2(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    case SimdLevel::Sse2:
+        ShiftAndScaleSse2(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    case SimdLevel::Scalar:
+        ShiftAndScaleScalar(pInputs, cInputs, pOutputs, offset, divisor);
+        break;
+    }
+}
+
+#endif // FEATURIZER_SCALE_KERNELS_X86
+
+template <typename InputT, typename TransformedT, typename ComputeT>
+void ShiftAndScaleImpl(InputT const *pInputs, size_t cInputs, TransformedT *pOutputs, ComputeT offset, ComputeT divisor, SimdLevel level, std::true_type /*all types are ComputeT*/) {
+    ShiftAndScaleKernel(level, pInputs, cInputs, pOutputs, offset, divisor);
+}
+
+template <typename InputT, typename TransformedT, typename ComputeT>
+void ShiftAndScaleImpl(InputT const *pInputs, size_t cInputs, TransformedT *pOutputs, ComputeT offset, ComputeT divisor, SimdLevel level, std::false_type /*all types are ComputeT*/) {
+    // Convert the input in blocks small enough to remain in the L1 cache
+    static constexpr size_t const           BlockSize = 512;
+
+    ComputeT                                buffer[BlockSize];
+
+    while(cInputs) {
+        size_t const                        cItems(cInputs < BlockSize ? cInputs : BlockSize);
+
+        for(size_t i = 0; i < cItems; ++i)
+            buffer[i] = static_cast<ComputeT>(static_cast<TransformedT>(pInputs[i]));
+
+        ShiftAndScaleKernel(level, buffer, cItems, buffer, offset, divisor);
+
+        for(size_t i = 0; i < cItems; ++i)
+            pOutputs[i] = static_cast<TransformedT>(buffer[i]);
+
+        pInputs += cItems;
+        pOutputs += cItems;
+        cInputs -= cItems;
+    }
+}
+
+} // namespace Details
+
+inline SimdLevel GetSimdLevel(void) {
+    static SimdLevel const                  level(Details::DetectSimdLevel());
+
+    return level;
+}
+
+template <typename InputT, typename TransformedT, typename ComputeT>
+void ShiftAndScale(InputT const *pInputs, size_t cInputs, TransformedT *pOutputs, ComputeT offset, ComputeT divisor, SimdLevel level) {
+    static_assert(std::is_arithmetic<InputT>::value, "'InputT' must be an arithmetic type");
+    static_assert(std::is_arithmetic<TransformedT>::value, "'TransformedT' must be an arithmetic type");
+    static_assert(std::is_arithmetic<ComputeT>::value, "'ComputeT' must be an arithmetic type");
+
+    Details::ShiftAndScaleImpl(
+        pInputs,
+        cInputs,
+        pOutputs,
+        offset,
+        divisor,
+        level,
+        std::integral_constant<bool, std::is_same<InputT, ComputeT>::value && std::is_same<TransformedT, ComputeT>::value>()
+    );
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
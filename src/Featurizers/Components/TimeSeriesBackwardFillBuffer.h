@@ -0,0 +1,480 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Featurizer.h"
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimeSeriesSpillFile
+///  \brief         Temporary file that stores records on behalf of any number
+///                 of `TimeSeriesBackwardFillBuffers`, so that the number of
+///                 open files doesn't grow with the number of grains that spill.
+///
+///                 Records are appended and read back (once) by position; the
+///                 file is created by the first write and reused from the
+///                 beginning whenever all of the records written have been read.
+///
+class TimeSeriesSpillFile {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using PositionType                      = std::fpos_t;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimeSeriesSpillFile(void);
+    ~TimeSeriesSpillFile(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesSpillFile);
+
+    /// Number of records that have been written but not read
+    size_t size(void) const;
+
+    PositionType write(Archive::ByteArray const &data);
+    Archive::ByteArray read(PositionType const &position);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct FileCloser {
+        void operator()(std::FILE *pFile) const;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::unique_ptr<std::FILE, FileCloser>  _pFile;
+    std::fpos_t                             _startPos;
+    std::fpos_t                             _endPos;
+    size_t                                  _numRecords;
+};
+
+using TimeSeriesSpillFilePtr                = std::shared_ptr<TimeSeriesSpillFile>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimeSeriesBackwardFillBuffer
+///  \brief         Backward fills the rows of a single grain as they are
+///                 streamed, emitting each row as soon as all of its null
+///                 values have been filled with the next non-null value of
+///                 the corresponding column.
+///
+///                 Only the rows since the earliest unfilled null value are
+///                 buffered, so memory is proportional to the longest gap in
+///                 any column rather than to the number of rows. For every
+///                 column, the pending null values are the trailing rows since
+///                 the column's last non-null value; the start of that run is
+///                 all that is tracked, and each value is filled once.
+///
+///                 When `maxInMemoryRows` is not 0, the oldest buffered rows
+///                 beyond that limit are spilled to a `TimeSeriesSpillFile`,
+///                 which may be shared with the buffers of other grains. Values
+///                 that fill spilled rows are recorded per column and applied
+///                 when the rows are read back.
+///
+template <typename TypesT>
+class TimeSeriesBackwardFillBuffer {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using TimePointType                     = std::chrono::system_clock::time_point;
+    using ColsToImputeType                  = typename TypesT::ColsToImputeType;
+
+    /// A row without its grain, which is the same for every row in the buffer:
+    /// <is added row, time point, values>
+    using RowType                           = std::tuple<bool, TimePointType, ColsToImputeType>;
+    using CallbackFunction                  = std::function<void (RowType)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimeSeriesBackwardFillBuffer(size_t numCols, size_t maxInMemoryRows=0, TimeSeriesSpillFilePtr pSpillFile=TimeSeriesSpillFilePtr());
+    ~TimeSeriesBackwardFillBuffer(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesBackwardFillBuffer);
+
+    /// Rows beyond the new limit are spilled by the next call to `push`
+    void set_max_in_memory_rows(size_t maxInMemoryRows);
+
+    bool empty(void) const;
+
+    /// Number of rows waiting for a value, including those that have been spilled
+    size_t size(void) const;
+    size_t in_memory_size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            push
+    ///  \brief         Adds a row, which fills the pending null values of the
+    ///                 columns where the row has a value, and invokes the
+    ///                 callback with every row that no longer has pending
+    ///                 null values (in order).
+    ///
+    void push(RowType row, CallbackFunction const &callback);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            flush
+    ///  \brief         Invokes the callback with every remaining row; values
+    ///                 that couldn't be filled remain null.
+    ///
+    void flush(CallbackFunction const &callback);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using ValueType                         = typename TypesT::ValueType;
+    using ValueTraits                       = Traits<ValueType>;
+
+    /// Value that fills the null values of spilled rows in [Begin, End)
+    struct SpilledFill {
+        std::uint64_t                       Begin;
+        std::uint64_t                       End;
+        ValueType                           Value;
+
+        SpilledFill(std::uint64_t begin, std::uint64_t end, ValueType value);
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint64_t const    NoPendingRows = std::numeric_limits<std::uint64_t>::max();
+
+    size_t const                            _numCols;
+    size_t                                  _maxInMemoryRows;
+
+    // Rows are identified by the order in which they were pushed
+    std::uint64_t                           _nextIndex;
+
+    // The index of the first of the trailing rows with a null value, by column
+    std::vector<std::uint64_t>              _firstPendingIndexes;
+
+    // The most recent rows; spilled rows precede these rows
+    std::deque<RowType>                     _rows;
+
+    // Created by the first spill if not provided
+    TimeSeriesSpillFilePtr                  _pSpillFile;
+
+    std::deque<TimeSeriesSpillFile::PositionType>   _spilledPositions;
+    std::uint64_t                           _firstSpilledIndex;
+    std::vector<std::deque<SpilledFill>>    _spilledFills;      // By column
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void emit(std::uint64_t endIndex, CallbackFunction const &callback);
+
+    void spill(RowType const &row);
+    RowType unspill(void);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesSpillFile
+// |
+// ----------------------------------------------------------------------
+inline TimeSeriesSpillFile::TimeSeriesSpillFile(void) :
+    _startPos(),
+    _endPos(),
+    _numRecords(0) {
+}
+
+inline size_t TimeSeriesSpillFile::size(void) const {
+    return _numRecords;
+}
+
+inline TimeSeriesSpillFile::PositionType TimeSeriesSpillFile::write(Archive::ByteArray const &data) {
+    if(!_pFile) {
+        _pFile.reset(std::tmpfile());
+        if(!_pFile)
+            throw std::runtime_error("Unable to create the temporary file used to spill rows");
+
+        if(std::fgetpos(_pFile.get(), &_startPos) != 0)
+            throw std::runtime_error("Unable to access the temporary file used to spill rows");
+
+        _endPos = _startPos;
+    }
+
+    PositionType const                      result(_endPos);
+    std::uint64_t const                     cData(data.size());
+
+    if(
+        std::fsetpos(_pFile.get(), &_endPos) != 0
+        || std::fwrite(&cData, sizeof(cData), 1, _pFile.get()) != 1
+        || std::fwrite(data.data(), 1, data.size(), _pFile.get()) != data.size()
+        || std::fgetpos(_pFile.get(), &_endPos) != 0
+    )
+        throw std::runtime_error("Unable to write to the temporary file used to spill rows");
+
+    ++_numRecords;
+    return result;
+}
+
+inline Archive::ByteArray TimeSeriesSpillFile::read(PositionType const &position) {
+    if(_numRecords == 0)
+        throw std::runtime_error("Invalid spilled row");
+
+    std::uint64_t                           cData(0);
+
+    if(
+        std::fsetpos(_pFile.get(), &position) != 0
+        || std::fread(&cData, sizeof(cData), 1, _pFile.get()) != 1
+    )
+        throw std::runtime_error("Unable to read from the temporary file used to spill rows");
+
+    Archive::ByteArray                      result(static_cast<size_t>(cData));
+
+    if(std::fread(result.data(), 1, result.size(), _pFile.get()) != result.size())
+        throw std::runtime_error("Unable to read from the temporary file used to spill rows");
+
+    // Reuse the file from the beginning once every record has been read
+    if(--_numRecords == 0)
+        _endPos = _startPos;
+
+    return result;
+}
+
+inline void TimeSeriesSpillFile::FileCloser::operator()(std::FILE *pFile) const {
+    std::fclose(pFile);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesBackwardFillBuffer
+// |
+// ----------------------------------------------------------------------
+template <typename TypesT>
+constexpr std::uint64_t const TimeSeriesBackwardFillBuffer<TypesT>::NoPendingRows;
+
+template <typename TypesT>
+TimeSeriesBackwardFillBuffer<TypesT>::TimeSeriesBackwardFillBuffer(size_t numCols, size_t maxInMemoryRows, TimeSeriesSpillFilePtr pSpillFile) :
+    _numCols(
+        [&numCols](void) {
+            if(numCols == 0)
+                throw std::invalid_argument("numCols");
+
+            return numCols;
+        }()
+    ),
+    _maxInMemoryRows(maxInMemoryRows),
+    _nextIndex(0),
+    _firstPendingIndexes(_numCols, NoPendingRows),
+    _pSpillFile(std::move(pSpillFile)),
+    _firstSpilledIndex(0),
+    _spilledFills(_numCols) {
+}
+
+template <typename TypesT>
+void TimeSeriesBackwardFillBuffer<TypesT>::set_max_in_memory_rows(size_t maxInMemoryRows) {
+    _maxInMemoryRows = maxInMemoryRows;
+}
+
+template <typename TypesT>
+bool TimeSeriesBackwardFillBuffer<TypesT>::empty(void) const {
+    return _rows.empty() && _spilledPositions.empty();
+}
+
+template <typename TypesT>
+size_t TimeSeriesBackwardFillBuffer<TypesT>::size(void) const {
+    return _rows.size() + _spilledPositions.size();
+}
+
+template <typename TypesT>
+size_t TimeSeriesBackwardFillBuffer<TypesT>::in_memory_size(void) const {
+    return _rows.size();
+}
+
+template <typename TypesT>
+void TimeSeriesBackwardFillBuffer<TypesT>::push(RowType row, CallbackFunction const &callback) {
+    ColsToImputeType const &                values(std::get<2>(row));
+
+    if(values.size() != _numCols)
+        throw std::runtime_error("Input data does not match the number of columns to impute.");
+
+    std::uint64_t const                     index(_nextIndex);
+    std::uint64_t const                     firstInMemoryIndex(index - _rows.size());
+
+    for(size_t col = 0; col < _numCols; ++col) {
+        std::uint64_t &                     firstPendingIndex(_firstPendingIndexes[col]);
+
+        if(ValueTraits::IsNull(values[col])) {
+            if(firstPendingIndex == NoPendingRows)
+                firstPendingIndex = index;
+
+            continue;
+        }
+
+        if(firstPendingIndex == NoPendingRows)
+            continue;
+
+        for(std::uint64_t pendingIndex = std::max(firstPendingIndex, firstInMemoryIndex); pendingIndex < index; ++pendingIndex)
+            std::get<2>(_rows[static_cast<size_t>(pendingIndex - firstInMemoryIndex)])[col] = values[col];
+
+        if(firstPendingIndex < firstInMemoryIndex)
+            _spilledFills[col].emplace_back(firstPendingIndex, firstInMemoryIndex, values[col]);
+
+        firstPendingIndex = NoPendingRows;
+    }
+
+    _rows.emplace_back(std::move(row));
+    ++_nextIndex;
+
+    std::uint64_t                           endIndex(NoPendingRows);
+
+    for(auto const &firstPendingIndex : _firstPendingIndexes)
+        endIndex = std::min(endIndex, firstPendingIndex);
+
+    emit(endIndex, callback);
+
+    if(_maxInMemoryRows != 0) {
+        while(_rows.size() > _maxInMemoryRows) {
+            spill(_rows.front());
+            _rows.pop_front();
+        }
+    }
+}
+
+template <typename TypesT>
+void TimeSeriesBackwardFillBuffer<TypesT>::flush(CallbackFunction const &callback) {
+    emit(NoPendingRows, callback);
+
+    std::fill(_firstPendingIndexes.begin(), _firstPendingIndexes.end(), NoPendingRows);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename TypesT>
+TimeSeriesBackwardFillBuffer<TypesT>::SpilledFill::SpilledFill(std::uint64_t begin, std::uint64_t end, ValueType value) :
+    Begin(begin),
+    End(end),
+    Value(std::move(value)) {
+}
+
+template <typename TypesT>
+void TimeSeriesBackwardFillBuffer<TypesT>::emit(std::uint64_t endIndex, CallbackFunction const &callback) {
+    // Spilled rows are emitted first, as they precede the rows in memory
+    while(_spilledPositions.empty() == false && _firstSpilledIndex < endIndex) {
+        RowType                             row(unspill());
+
+        ++_firstSpilledIndex;
+        _spilledPositions.pop_front();
+
+        if(_spilledPositions.empty()) {
+            for(auto &fills : _spilledFills)
+                fills.clear();
+        }
+
+        callback(std::move(row));
+    }
+
+    if(_spilledPositions.empty() == false)
+        return;
+
+    std::uint64_t                           index(_nextIndex - _rows.size());
+
+    while(_rows.empty() == false && index < endIndex) {
+        RowType                             row(std::move(_rows.front()));
+
+        _rows.pop_front();
+        ++index;
+
+        callback(std::move(row));
+    }
+}
+
+template <typename TypesT>
+void TimeSeriesBackwardFillBuffer<TypesT>::spill(RowType const &row) {
+    if(!_pSpillFile)
+        _pSpillFile = std::make_shared<TimeSeriesSpillFile>();
+
+    if(_spilledPositions.empty())
+        _firstSpilledIndex = _nextIndex - _rows.size();
+
+    // The time point is written with full precision, as `Traits` serializes
+    // time points with millisecond precision.
+    Archive                                 out;
+
+    Traits<bool>::serialize(out, std::get<0>(row));
+    Traits<TimePointType::rep>::serialize(out, std::get<1>(row).time_since_epoch().count());
+    TypesT::SerializeRow(out, std::get<2>(row));
+
+    _spilledPositions.emplace_back(_pSpillFile->write(out.commit()));
+}
+
+template <typename TypesT>
+typename TimeSeriesBackwardFillBuffer<TypesT>::RowType TimeSeriesBackwardFillBuffer<TypesT>::unspill(void) {
+    Archive                                 in(_pSpillFile->read(_spilledPositions.front()));
+    bool const                              isAdded(Traits<bool>::deserialize(in));
+    TimePointType const                     timePoint(TimePointType::duration(Traits<TimePointType::rep>::deserialize(in)));
+    RowType                                 row(isAdded, timePoint, TypesT::DeserializeRow(in));
+    ColsToImputeType &                      values(std::get<2>(row));
+
+    for(size_t col = 0; col < _numCols; ++col) {
+        std::deque<SpilledFill> &           fills(_spilledFills[col]);
+
+        while(fills.empty() == false && fills.front().End <= _firstSpilledIndex)
+            fills.pop_front();
+
+        if(ValueTraits::IsNull(values[col]) && fills.empty() == false && fills.front().Begin <= _firstSpilledIndex)
+            values[col] = fills.front().Value;
+    }
+
+    return row;
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
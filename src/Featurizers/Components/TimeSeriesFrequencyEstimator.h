@@ -8,6 +8,7 @@
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 #include "../Components/PipelineExecutionEstimatorImpl.h"
+#include "TimeSeriesImputerTypes.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -46,24 +47,39 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesFrequencyAnnotation);
 };
 
+namespace Details {
+
 /////////////////////////////////////////////////////////////////////////
-///  \class         TimeSeriesFrequencyEstimator
+///  \class         TimeSeriesFrequencyEstimatorImpl
 ///  \brief         This class computes the frequency of timeseries by keeping
 ///                 track of minimum difference(frequency) observed between two
 ///                 timepoints for a given grain. Note that frequency is same for
 ///                 complete dataset.
 ///
-class TimeSeriesFrequencyEstimator : public FitEstimator<std::tuple<std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> {
+///                 Grains are interned in a `GrainDictionary`, which may be
+///                 shared with other estimators trained on the same data, and
+///                 the last time point of each grain is stored by grain id.
+///
+template <typename TypesT>
+class TimeSeriesFrequencyEstimatorImpl : public FitEstimator<typename TypesT::InputType> {
 public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using GrainDictionaryType               = typename TypesT::GrainDictionaryType;
+    using GrainDictionaryPtr                = std::shared_ptr<GrainDictionaryType>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesFrequencyEstimator(AnnotationMapsPtr pAllColumnAnnotations);
-    ~TimeSeriesFrequencyEstimator(void) override = default;
+    TimeSeriesFrequencyEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations, GrainDictionaryPtr pGrains=GrainDictionaryPtr());
+    ~TimeSeriesFrequencyEstimatorImpl(void) override = default;
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesFrequencyEstimator);
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesFrequencyEstimatorImpl);
 
 private:
     // ----------------------------------------------------------------------
@@ -71,19 +87,23 @@ private:
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using KeyType                           = std::vector<std::string>;
-    using ColsToImputeType                  = std::vector<nonstd::optional<std::string>>;
-    using BaseType                          = FitEstimator<std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType>>;
+    using KeyType                           = typename TypesT::KeyType;
+    using BaseType                          = FitEstimator<typename TypesT::InputType>;
     using FrequencyType                     = std::chrono::system_clock::duration;
     using TimePointType                     = std::chrono::system_clock::time_point;
-    using MapType                           = std::map<KeyType, TimePointType>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    MapType                                 _grainTimePointTracker;
+    GrainDictionaryPtr const                _pGrains;
+
+    // The last time point of each grain, by grain id; grains interned by other
+    // estimators that share the dictionary are marked as not yet seen.
+    std::vector<TimePointType>              _lastTimePoints;
+    std::vector<bool>                       _isGrainSeen;
+
     FrequencyType                           _minFrequency;
 
     // ----------------------------------------------------------------------
@@ -98,7 +118,21 @@ private:
     void complete_training_impl(void) override;
 };
 
+} // namespace Details
 
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       TimeSeriesFrequencyEstimator
+///  \brief         Computes the frequency of a time series whose grains and
+///                 columns are strings.
+///
+using TimeSeriesFrequencyEstimator          = Details::TimeSeriesFrequencyEstimatorImpl<StringTimeSeriesTypes>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       NumericTimeSeriesFrequencyEstimator
+///  \brief         Computes the frequency of a time series whose grains are
+///                 pre-hashed and whose columns are numeric.
+///
+using NumericTimeSeriesFrequencyEstimator   = Details::TimeSeriesFrequencyEstimatorImpl<NumericTimeSeriesTypes>;
 
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -121,50 +155,62 @@ inline TimeSeriesFrequencyAnnotation::TimeSeriesFrequencyAnnotation(TimeSeriesFr
 
 // ----------------------------------------------------------------------
 // |
-// |  TimeSeriesFrequencyEstimator
+// |  Details::TimeSeriesFrequencyEstimatorImpl
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesFrequencyEstimator::TimeSeriesFrequencyEstimator(AnnotationMapsPtr pAllColumnAnnotations) :
+template <typename TypesT>
+Details::TimeSeriesFrequencyEstimatorImpl<TypesT>::TimeSeriesFrequencyEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations, GrainDictionaryPtr pGrains) :
     BaseType("TimeSeriesFrequencyEstimator", std::move(pAllColumnAnnotations))
+    ,_pGrains(pGrains ? std::move(pGrains) : std::make_shared<GrainDictionaryType>())
     ,_minFrequency(std::chrono::system_clock::duration::max().count()){
 }
 
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline bool TimeSeriesFrequencyEstimator::begin_training_impl(void) /*override*/ {
+template <typename TypesT>
+bool Details::TimeSeriesFrequencyEstimatorImpl<TypesT>::begin_training_impl(void) /*override*/ {
     return true;
 }
 
-inline FitResult TimeSeriesFrequencyEstimator::fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) {
+template <typename TypesT>
+FitResult Details::TimeSeriesFrequencyEstimatorImpl<TypesT>::fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) /*override*/ {
     typename BaseType::InputType const * const          pEndBuffer(pBuffer + cBuffer);
 
     while(pBuffer != pEndBuffer) {
-        std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType> const &        input(*pBuffer++);
+        typename BaseType::InputType const &                            input(*pBuffer++);
         TimePointType const &                                           timeValue (std::get<0>(input));
         KeyType const &                                                 keyValues (std::get<1>(input));
-        typename MapType::iterator const                                iter(_grainTimePointTracker.find(keyValues));
+        typename GrainDictionaryType::IdType const                      id(_pGrains->intern(keyValues));
 
-        if(iter == _grainTimePointTracker.end())
-            _grainTimePointTracker.insert(std::make_pair(keyValues, timeValue));
+        if(id >= _lastTimePoints.size()) {
+            _lastTimePoints.resize(_pGrains->size());
+            _isGrainSeen.resize(_pGrains->size(), false);
+        }
+
+        if(_isGrainSeen[id] == false)
+            _isGrainSeen[id] = true;
         else
         {
-            TimePointType const &                                       lastObservedTimeValue(iter->second);
+            TimePointType const &                                       lastObservedTimeValue(_lastTimePoints[id]);
             if(lastObservedTimeValue >= timeValue)
                 throw std::runtime_error("Input stream not in chronological order.");
 
             FrequencyType                                               currentFrequency(timeValue-lastObservedTimeValue);
             if(currentFrequency <= _minFrequency)
                 _minFrequency = currentFrequency;
-
-            iter->second = timeValue;
         }
+
+        _lastTimePoints[id] = timeValue;
     }
 
     return FitResult::Continue;
 }
 
-inline void TimeSeriesFrequencyEstimator::complete_training_impl(void) {
+template <typename TypesT>
+void Details::TimeSeriesFrequencyEstimatorImpl<TypesT>::complete_training_impl(void) /*override*/ {
+    _lastTimePoints.clear();
+    _isGrainSeen.clear();
 
     BaseType::add_annotation(std::make_shared<TimeSeriesFrequencyAnnotation>(std::move(_minFrequency)), 0);
 }
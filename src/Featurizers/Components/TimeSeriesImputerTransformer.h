@@ -4,10 +4,13 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+
 #include "../../Archive.h"
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 #include "PipelineExecutionEstimatorImpl.h"
+#include "TimeSeriesBackwardFillBuffer.h"
 #include "TimeSeriesFrequencyEstimator.h"
 #include "TimeSeriesMedianEstimator.h"
 
@@ -32,25 +35,21 @@ inline bool IsValid(TimeSeriesImputeStrategy value) {
         || value == TimeSeriesImputeStrategy::Interpolate;
 }
 
-using TimeSeriesImputerEstimatorInputType = std::tuple<
-    std::chrono::system_clock::time_point,
-    std::vector<std::string>,
-    std::vector<nonstd::optional<std::string>>
->;
+using TimeSeriesImputerEstimatorInputType = StringTimeSeriesTypes::InputType;
+using TimeSeriesImputerEstimatorTransformedType = StringTimeSeriesTypes::TransformedType;
+
+using NumericTimeSeriesImputerEstimatorInputType = NumericTimeSeriesTypes::InputType;
+using NumericTimeSeriesImputerEstimatorTransformedType = NumericTimeSeriesTypes::TransformedType;
 
-using TimeSeriesImputerEstimatorTransformedType = std::tuple<
-        bool,
-        std::chrono::system_clock::time_point,
-        std::vector<std::string>,
-        std::vector<nonstd::optional<std::string>>
-    >;
+namespace Details {
 
 /////////////////////////////////////////////////////////////////////////
-///  \class         TimeSeriesImputerEstimator
+///  \class         TimeSeriesImputerEstimatorImpl
 ///  \brief         This class retrieves TimeSeriesFrequencyAnnotation and
 ///                 Creates Imputation transformers
 ///
-class TimeSeriesImputerEstimator : public TransformerEstimator<TimeSeriesImputerEstimatorInputType, TimeSeriesImputerEstimatorTransformedType> {
+template <typename TypesT>
+class TimeSeriesImputerEstimatorImpl : public TransformerEstimator<typename TypesT::InputType, typename TypesT::TransformedType> {
 public:
     // ----------------------------------------------------------------------
     // |
@@ -59,10 +58,11 @@ public:
     // ----------------------------------------------------------------------
     using TimePointType                     = std::chrono::system_clock::time_point;
     using FrequencyType                     = std::chrono::system_clock::duration;
-    using KeyType                           = std::vector<std::string>;
-    using ColsToImputeType                  = std::vector<nonstd::optional<std::string>>;
-    using OutputRowType                     = std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>;
-    using BaseType                          = TransformerEstimator<TimeSeriesImputerEstimatorInputType, TimeSeriesImputerEstimatorTransformedType>;
+    using KeyType                           = typename TypesT::KeyType;
+    using ColsToImputeType                  = typename TypesT::ColsToImputeType;
+    using OutputRowType                     = typename TypesT::TransformedType;
+    using MedianMapType                     = typename TimeSeriesMedianAnnotationImpl<TypesT>::MedianMapType;
+    using BaseType                          = TransformerEstimator<typename TypesT::InputType, typename TypesT::TransformedType>;
     //std::chrono::system_clock::duration has different specializations of std::chrono::duration
     //in Windows and Linux. So for serDe we convert frequency to this specific type.
     using SerDeDurationType = std::chrono::duration<int64_t, std::ratio<1,1000000000>>;
@@ -71,7 +71,7 @@ public:
     class Transformer : public Microsoft::Featurizer::Transformer<typename BaseType::InputType,typename BaseType::TransformedType> {
     public:
 
-        using StrTraits                     = Traits<nonstd::optional<std::string>>;
+        using ValueTraits                   = Traits<typename TypesT::ValueType>;
         using ThisBaseType                  = Microsoft::Featurizer::Transformer<typename BaseType::InputType,typename BaseType::TransformedType>;
 
         // ----------------------------------------------------------------------
@@ -79,7 +79,7 @@ public:
         // |  Public Methods
         // |
         // ----------------------------------------------------------------------
-        Transformer(FrequencyType value, std::vector<TypeId> colsToImputeDataTypes, TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, std::map<KeyType,std::vector<double_t>> medianValues);
+        Transformer(FrequencyType value, std::vector<TypeId> colsToImputeDataTypes, TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, MedianMapType medianValues);
         Transformer(Archive & ar);
         ~Transformer(void) override = default;
 
@@ -89,6 +89,16 @@ public:
 
         void save(Archive & ar) const override;
 
+        /////////////////////////////////////////////////////////////////////////
+        ///  \fn            set_max_buffered_rows_per_grain
+        ///  \brief         When not 0, rows of a grain waiting to be backward filled
+        ///                 beyond this limit are spilled to a temporary file that is
+        ///                 shared by all grains. This is a runtime setting that isn't
+        ///                 serialized; it applies to grains that are already buffering.
+        ///
+        void set_max_buffered_rows_per_grain(std::uint64_t maxBufferedRowsPerGrain);
+        std::uint64_t get_max_buffered_rows_per_grain(void) const;
+
         // ----------------------------------------------------------------------
         // |
         // |  Public Data
@@ -97,17 +107,38 @@ public:
         FrequencyType const                             _frequency;
         std::vector<TypeId> const                       _colsToImputeDataTypes;
         TimeSeriesImputeStrategy const                  _tsImputeStrategy;
-        std::map<KeyType,std::vector<double_t>> const   _medianValues;
+        MedianMapType const                             _medianValues;
         bool const                                      _supressError;
 
     private:
+        // ----------------------------------------------------------------------
+        // |
+        // |  Private Types
+        // |
+        // ----------------------------------------------------------------------
+        using GrainDictionaryType           = typename TypesT::GrainDictionaryType;
+        using BackwardFillBufferType        = TimeSeriesBackwardFillBuffer<TypesT>;
+
+        struct GrainState {
+            OutputRowType                                       LastRow;
+            std::unique_ptr<BackwardFillBufferType>             pBackwardFill;  // Created by the first row when backward filling
+            typename MedianMapType::mapped_type const *         pMedians;       // nullptr if the grain wasn't seen during training
+
+            GrainState(OutputRowType lastRow, typename MedianMapType::mapped_type const *pGrainMedians);
+        };
+
         // ----------------------------------------------------------------------
         // |
         // |  Private Data
         // |
         // ----------------------------------------------------------------------
-        std::map<KeyType,OutputRowType>                                     _lastRowtracker;
-        std::map<KeyType,std::vector<BaseType::TransformedType>>            _buffer;
+
+        // The state of each grain is stored by the grain's id
+        GrainDictionaryType                             _grains;
+        std::vector<GrainState>                         _grainStates;
+
+        std::uint64_t                                   _maxBufferedRowsPerGrain;
+        TimeSeriesSpillFilePtr const                    _pSpillFile;
 
         // ----------------------------------------------------------------------
         // |
@@ -120,8 +151,8 @@ public:
         std::vector<typename BaseType::TransformedType> generate_rows(typename ThisBaseType::InputType const &input, TimePointType const & lastObservedTP);
         void impute(ColsToImputeType & prev, ColsToImputeType & current);
         bool no_nulls(ColsToImputeType const & input);
-        void bfill(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
-        void ffill_or_median(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
+        void bfill(typename ThisBaseType::InputType const &input, GrainState &state, typename ThisBaseType::CallbackFunction const &callback);
+        void ffill_or_median(typename ThisBaseType::InputType const &input, GrainState &state, typename ThisBaseType::CallbackFunction const &callback);
     };
 
     using TransformerType                   = Transformer;
@@ -131,10 +162,10 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError);
-    ~TimeSeriesImputerEstimator(void) override = default;
+    TimeSeriesImputerEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError);
+    ~TimeSeriesImputerEstimatorImpl(void) override = default;
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesImputerEstimator);
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesImputerEstimatorImpl);
 
 private:
     // ----------------------------------------------------------------------
@@ -168,27 +199,38 @@ private:
 
     // MSVC has problems when the function is defined outside of the declaration
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
-        AnnotationMaps const &                          maps(Estimator::get_column_annotations());
+        AnnotationMaps const &                          maps(this->get_column_annotations());
         AnnotationMap const &                           annotations(maps[0]);
 
-        AnnotationMap::const_iterator const &           tsFreqIter(annotations.find("TimeSeriesFrequencyEstimator"));
-        if(tsFreqIter == annotations.end())
+        std::shared_ptr<TimeSeriesFrequencyAnnotation> const    pTsFreqAnnotation(annotations.get_annotation<TimeSeriesFrequencyAnnotation>("TimeSeriesFrequencyEstimator"));
+        if(pTsFreqAnnotation == nullptr)
             throw std::runtime_error("Couldn't retrieve Frequency Annotation.");
-        Annotation const &                              freqAnnotation(*tsFreqIter->second[0]);
-        assert(dynamic_cast<TimeSeriesFrequencyAnnotation const *>(&freqAnnotation));
-        TimeSeriesFrequencyAnnotation const &           tsFreqAnnotation(static_cast<TimeSeriesFrequencyAnnotation const &>(freqAnnotation));
+        TimeSeriesFrequencyAnnotation const &           tsFreqAnnotation(*pTsFreqAnnotation);
 
-        AnnotationMap::const_iterator const &           tsMedianIter(annotations.find("TimeSeriesMedianEstimator"));
-        if(tsMedianIter == annotations.end())
+        std::shared_ptr<TimeSeriesMedianAnnotationImpl<TypesT>> const   pTsMedianAnnotation(annotations.get_annotation<TimeSeriesMedianAnnotationImpl<TypesT>>("TimeSeriesMedianEstimator"));
+        if(pTsMedianAnnotation == nullptr)
             throw std::runtime_error("Couldn't retrieve Median Annotation.");
-        Annotation const &                              medianAnnotation(*tsMedianIter->second[0]);
-        assert(dynamic_cast<TimeSeriesMedianAnnotation const *>(&medianAnnotation));
-        TimeSeriesMedianAnnotation const &              tsMedianAnnotation(static_cast<TimeSeriesMedianAnnotation const &>(medianAnnotation));
+        TimeSeriesMedianAnnotationImpl<TypesT> const &  tsMedianAnnotation(*pTsMedianAnnotation);
 
         return typename BaseType::TransformerUniquePtr(new Transformer(tsFreqAnnotation.Value, std::move(_colsToImputeDataTypes), std::move(_tsImputeStrategy), std::move(_supressError), tsMedianAnnotation.Value));
     }
 };
 
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       TimeSeriesImputerEstimator
+///  \brief         Imputes a time series whose grains and columns are strings.
+///
+using TimeSeriesImputerEstimator            = Details::TimeSeriesImputerEstimatorImpl<StringTimeSeriesTypes>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       NumericTimeSeriesImputerEstimator
+///  \brief         Imputes a time series whose grains are pre-hashed and whose
+///                 columns are numeric (NaN values are null).
+///
+using NumericTimeSeriesImputerEstimator     = Details::TimeSeriesImputerEstimatorImpl<NumericTimeSeriesTypes>;
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -201,10 +243,11 @@ private:
 
 // ----------------------------------------------------------------------
 // |
-// |  TimeSeriesImputerEstimator
+// |  Details::TimeSeriesImputerEstimatorImpl
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy,bool supressError) :
+template <typename TypesT>
+Details::TimeSeriesImputerEstimatorImpl<TypesT>::TimeSeriesImputerEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy,bool supressError) :
     BaseType("TimeSeriesImputerEstimator", std::move(pAllColumnAnnotations)),
     _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
     _tsImputeStrategy(
@@ -222,31 +265,36 @@ inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr
         if(_tsImputeStrategy == TimeSeriesImputeStrategy::Median && _supressError == false) {
             // Verify that all col types are double/float
             for(auto const & colType : _colsToImputeDataTypes) {
-                if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(colType) == false)
+                if(TypesT::SupportsMedian(colType) == false)
                     throw std::runtime_error("Only Numeric type columns are supported for ImputationStrategy median. (use suppressError flag to skip imputing non-numeric types)");
             }
         }
 
 }
 
-inline bool TimeSeriesImputerEstimator::begin_training_impl(void) /*override*/ {
+template <typename TypesT>
+bool Details::TimeSeriesImputerEstimatorImpl<TypesT>::begin_training_impl(void) /*override*/ {
     return false;
 }
 
-inline void TimeSeriesImputerEstimator::complete_training_impl(void) /*override */ {
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::complete_training_impl(void) /*override */ {
 }
 
 // ----------------------------------------------------------------------
 // |
-// |  TimeSeriesImputerEstimator::Transformer
+// |  Details::TimeSeriesImputerEstimatorImpl::Transformer
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEstimator::FrequencyType value, std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, std::map<KeyType,std::vector<double_t>> medianValues) :
+template <typename TypesT>
+Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::Transformer(FrequencyType value, std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, MedianMapType medianValues) :
     _frequency(std::move(value)),
     _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
     _tsImputeStrategy(std::move(tsImputeStrategy)),
     _medianValues(std::move(medianValues)),
-    _supressError(std::move(supressError)) {
+    _supressError(std::move(supressError)),
+    _maxBufferedRowsPerGrain(0),
+    _pSpillFile(std::make_shared<TimeSeriesSpillFile>()) {
 
     if(_colsToImputeDataTypes.size() == 0)
         throw std::runtime_error("Column metadata can't be empty.");
@@ -256,8 +304,9 @@ inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEst
 
 }
 
-inline TimeSeriesImputerEstimator::Transformer::Transformer(Archive & ar) :
-    TimeSeriesImputerEstimator::Transformer(
+template <typename TypesT>
+Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::Transformer(Archive & ar) :
+    Transformer(
         [&ar](void) {
             // Version
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
@@ -305,7 +354,7 @@ inline TimeSeriesImputerEstimator::Transformer::Transformer(Archive & ar) :
                 }()
             );
 
-            std::map<KeyType, std::vector<double_t>>    medianValues(Traits<std::map<KeyType, std::vector<double_t>>>::deserialize(ar));
+            MedianMapType                               medianValues(Traits<MedianMapType>::deserialize(ar));
             bool                                        suppressError(Traits<bool>::deserialize(ar));
 
             return Transformer(
@@ -319,7 +368,8 @@ inline TimeSeriesImputerEstimator::Transformer::Transformer(Archive & ar) :
     ) {
 }
 
-inline bool TimeSeriesImputerEstimator::Transformer::operator==(Transformer const &other) const {
+template <typename TypesT>
+bool Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::operator==(Transformer const &other) const {
     return _frequency == other._frequency
         && _colsToImputeDataTypes == other._colsToImputeDataTypes
         && _tsImputeStrategy == other._tsImputeStrategy
@@ -327,7 +377,8 @@ inline bool TimeSeriesImputerEstimator::Transformer::operator==(Transformer cons
         && _supressError == other._supressError;
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::save(Archive & ar) const {
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::save(Archive & ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
     Traits<std::uint16_t>::serialize(ar, 0); // Minor
@@ -338,75 +389,123 @@ inline void TimeSeriesImputerEstimator::Transformer::save(Archive & ar) const {
     Traits<std::chrono::system_clock::duration>::serialize(ar,_frequency);
 
     //_colsToImputeDataTypes
-    using TypeIdUnderlyingType = std::underlying_type<TypeId>::type;
+    using TypeIdUnderlyingType = typename std::underlying_type<TypeId>::type;
     std::vector<TypeIdUnderlyingType> _colsToImputeDataTypesUnWrapped;
     for (auto imputeStrategy : _colsToImputeDataTypes)
         _colsToImputeDataTypesUnWrapped.push_back(static_cast<TypeIdUnderlyingType>(imputeStrategy));
     Traits<std::vector<TypeIdUnderlyingType>>::serialize(ar,_colsToImputeDataTypesUnWrapped);
 
     //_tsImputeStrategy
-    Traits<uint8_t>::serialize(ar,static_cast<std::underlying_type<TimeSeriesImputeStrategy>::type>(_tsImputeStrategy));
+    Traits<uint8_t>::serialize(ar,static_cast<typename std::underlying_type<TimeSeriesImputeStrategy>::type>(_tsImputeStrategy));
 
     //_medianValues
-    Traits<
-        std::map<
-            KeyType,
-            std::vector<double_t>
-        >
-    >::serialize(ar,_medianValues);
+    Traits<MedianMapType>::serialize(ar,_medianValues);
 
     //_supressError
     Traits<bool>::serialize(ar,_supressError);
 }
 
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::set_max_buffered_rows_per_grain(std::uint64_t maxBufferedRowsPerGrain) {
+    _maxBufferedRowsPerGrain = maxBufferedRowsPerGrain;
+
+    for(auto &state : _grainStates) {
+        if(state.pBackwardFill)
+            state.pBackwardFill->set_max_in_memory_rows(static_cast<size_t>(_maxBufferedRowsPerGrain));
+    }
+}
+
+template <typename TypesT>
+std::uint64_t Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::get_max_buffered_rows_per_grain(void) const {
+    return _maxBufferedRowsPerGrain;
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline void TimeSeriesImputerEstimator::Transformer::execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
-    // Ensure that this row is in chronological order
+template <typename TypesT>
+Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::GrainState::GrainState(OutputRowType lastRow, typename MedianMapType::mapped_type const *pGrainMedians) :
+    LastRow(std::move(lastRow)),
+    pMedians(pGrainMedians) {
+}
+
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
     KeyType const &                                                         key(std::get<1>(input));
-    std::map<KeyType, OutputRowType>::const_iterator const                  iterLastRow(_lastRowtracker.find(key));
+    typename GrainDictionaryType::IdType const                              id(_grains.intern(key));
 
-    if(iterLastRow != _lastRowtracker.end()) {
-        std::chrono::system_clock::time_point const &   lastRowTimePoint(std::get<1>(iterLastRow->second));
-        std::chrono::system_clock::time_point const &   inputTimePoint(std::get<0>(input));
+    if(id == _grainStates.size()) {
+        // The first row of a grain is its own last row. Medians are looked up
+        // once per grain rather than once per imputed row.
+        typename MedianMapType::const_iterator const                        iterMedian(_medianValues.find(key));
 
-        if(inputTimePoint < lastRowTimePoint)
-            throw std::runtime_error("Input stream not in chronological order.");
+        _grainStates.emplace_back(
+            std::tuple_cat(std::make_tuple(false), input),
+            iterMedian != _medianValues.end() ? &iterMedian->second : nullptr
+        );
     }
 
+    GrainState &                                                            state(_grainStates[id]);
+
+    // Ensure that this row is in chronological order
+    std::chrono::system_clock::time_point const &                           lastRowTimePoint(std::get<1>(state.LastRow));
+    std::chrono::system_clock::time_point const &                           inputTimePoint(std::get<0>(input));
+
+    if(inputTimePoint < lastRowTimePoint)
+        throw std::runtime_error("Input stream not in chronological order.");
+
     // Invoke the specified impute strategy
     if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward || _tsImputeStrategy == TimeSeriesImputeStrategy::Median)
-        ffill_or_median(input, callback);
+        ffill_or_median(input, state, callback);
     else if(_tsImputeStrategy == TimeSeriesImputeStrategy::Backward)
-        bfill(input, callback);
+        bfill(input, state, callback);
     else
         throw std::runtime_error("Unsupported Impute Strategy");
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::flush_impl(typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
-    std::vector<typename TimeSeriesImputerEstimator::BaseType::TransformedType> output;
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::flush_impl(typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
+    // Buffered rows are flushed in grain order (rather than in the order in
+    // which grains were first seen) so that the output is deterministic.
+    std::vector<typename GrainDictionaryType::IdType>   ids;
+
+    for(typename GrainDictionaryType::IdType id = 0; id < _grainStates.size(); ++id) {
+        if(_grainStates[id].pBackwardFill && _grainStates[id].pBackwardFill->empty() == false)
+            ids.emplace_back(id);
+    }
 
-    for (auto it = _buffer.begin(); it != _buffer.end(); ++it)
-        output.insert(output.end(), it->second.begin(), it->second.end());
+    std::sort(
+        ids.begin(),
+        ids.end(),
+        [this](typename GrainDictionaryType::IdType a, typename GrainDictionaryType::IdType b) {
+            return _grains.key(a) < _grains.key(b);
+        }
+    );
 
-    // Clear the working state
-    _lastRowtracker.clear();
-    _buffer.clear();
+    for(auto const &id : ids) {
+        KeyType const &                                 key(_grains.key(id));
 
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : output)
-        callback(std::move(addedRow));
+        _grainStates[id].pBackwardFill->flush(
+            [&callback, &key](typename BackwardFillBufferType::RowType row) {
+                callback(std::make_tuple(std::get<0>(row), std::get<1>(row), key, std::move(std::get<2>(row))));
+            }
+        );
+    }
+
+    // Clear the working state
+    _grains.clear();
+    _grainStates.clear();
 }
 
-inline std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformedType> TimeSeriesImputerEstimator::Transformer::generate_rows(typename ThisBaseType::InputType const &input, typename TimeSeriesImputerEstimator::TimePointType const & lastObservedTP) {
+template <typename TypesT>
+std::vector<typename Details::TimeSeriesImputerEstimatorImpl<TypesT>::BaseType::TransformedType> Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::generate_rows(typename ThisBaseType::InputType const &input, TimePointType const & lastObservedTP) {
 
-    std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformedType> output;
-    typename TimeSeriesImputerEstimator::TimePointType tempTP = lastObservedTP + _frequency;
-    typename TimeSeriesImputerEstimator::TimePointType inputTP = std::get<0>(input);
+    std::vector<typename BaseType::TransformedType> output;
+    TimePointType tempTP = lastObservedTP + _frequency;
+    TimePointType inputTP = std::get<0>(input);
 
     while(tempTP < inputTP) {
-        output.push_back(std::make_tuple(true, tempTP, std::get<1>(input), ColsToImputeType(std::get<2>(input).size())));
+        output.push_back(std::make_tuple(true, tempTP, std::get<1>(input), ColsToImputeType(std::get<2>(input).size(), ValueTraits::CreateNullValue())));
         tempTP = tempTP + _frequency;
     }
 
@@ -415,88 +514,70 @@ inline std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseTyp
     return output;
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::impute(typename TimeSeriesImputerEstimator::ColsToImputeType & prev, typename TimeSeriesImputerEstimator::ColsToImputeType & current) {
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::impute(ColsToImputeType & prev, ColsToImputeType & current) {
 
     for(std::size_t i=0; i< current.size(); ++i)
-        if(StrTraits::IsNull(current[i]))
+        if(ValueTraits::IsNull(current[i]))
             current[i] = prev[i];
 }
 
-inline bool TimeSeriesImputerEstimator::Transformer::no_nulls(typename TimeSeriesImputerEstimator::ColsToImputeType const & input) {
+template <typename TypesT>
+bool Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::no_nulls(ColsToImputeType const & input) {
 
     for(std::size_t i=0; i< input.size(); ++i)
-        if(StrTraits::IsNull(input[i]))
+        if(ValueTraits::IsNull(input[i]))
             return false;
 
     return true;
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::bfill(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::bfill(typename ThisBaseType::InputType const &input, GrainState &state, typename ThisBaseType::CallbackFunction const &callback) {
+    KeyType const &                                 key(std::get<1>(input));
+    ColsToImputeType const &                        values(std::get<2>(input));
 
-    typename TimeSeriesImputerEstimator::KeyType const & key = std::get<1>(input);
+    if(!state.pBackwardFill)
+        state.pBackwardFill.reset(new BackwardFillBufferType(values.size(), static_cast<size_t>(_maxBufferedRowsPerGrain), _pSpillFile));
 
-    if ( _lastRowtracker.find(key) == _lastRowtracker.end() )
-            _lastRowtracker.insert(std::make_pair(key, std::tuple_cat(std::make_tuple(false), input)));
+    BackwardFillBufferType &                        buffer(*state.pBackwardFill);
+    auto const                                      bufferCallback(
+        [&callback, &key](typename BackwardFillBufferType::RowType row) {
+            callback(std::make_tuple(std::get<0>(row), std::get<1>(row), key, std::move(std::get<2>(row))));
+        }
+    );
 
-    typename TimeSeriesImputerEstimator::OutputRowType  & lastRow = _lastRowtracker[key];
-    std::vector<TimeSeriesImputerEstimator::BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
+    // Rows are added to the buffer without their grain
+    TimePointType const &                           inputTP(std::get<0>(input));
 
-    if ( _buffer.find(key) != _buffer.end() )
-            _buffer[key].insert(_buffer[key].end(), addedRowsResultset.begin(), addedRowsResultset.end());
-    else
-        _buffer.insert(std::make_pair(key, addedRowsResultset));
+    for(TimePointType tempTP = std::get<1>(state.LastRow) + _frequency; tempTP < inputTP; tempTP += _frequency)
+        buffer.push(std::make_tuple(true, tempTP, ColsToImputeType(values.size(), ValueTraits::CreateNullValue())), bufferCallback);
 
-    lastRow = _buffer[key].back();
+    buffer.push(std::make_tuple(false, inputTP, values), bufferCallback);
 
-    for (auto it = _buffer[key].rbegin(); it != _buffer[key].rend(); it++) {
-        impute(std::get<3>(lastRow), std::get<3>(*it));
-        lastRow = *it;
-    }
-    _lastRowtracker[key] = _buffer[key].back();
-
-    std::vector<typename TimeSeriesImputerEstimator::BaseType::TransformedType> results;
-    int count = 0;
-    for(std::size_t i=0; i< _buffer[key].size(); ++i)
-    {
-        if(no_nulls(std::get<3>(_buffer[key][i]))){
-            results.push_back(_buffer[key][i]);
-            count++;
-        }
-        else
-            break;
-    }
-
-    if(count > 0)
-        _buffer[key].erase(_buffer[key].begin(),_buffer[key].begin()+count);
-
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : results)
-        callback(std::move(addedRow));
+    // Only the time point of the last row is used when backward filling
+    std::get<1>(state.LastRow) = inputTP;
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::ffill_or_median(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
-
-    typename TimeSeriesImputerEstimator::KeyType const & key = std::get<1>(input);
-    if ( _lastRowtracker.find(key) == _lastRowtracker.end() )
-            _lastRowtracker.insert(std::make_pair(key, std::tuple_cat(std::make_tuple(false), input)));
+template <typename TypesT>
+void Details::TimeSeriesImputerEstimatorImpl<TypesT>::Transformer::ffill_or_median(typename ThisBaseType::InputType const &input, GrainState &state, typename ThisBaseType::CallbackFunction const &callback) {
 
-    typename TimeSeriesImputerEstimator::OutputRowType  & lastRow = _lastRowtracker[key];
-    std::vector<TimeSeriesImputerEstimator::BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
+    OutputRowType  & lastRow = state.LastRow;
+    std::vector<typename BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
 
     for(auto &addedRow : addedRowsResultset) {
         if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward)
             impute(std::get<3>(lastRow) , std::get<3>(addedRow));
         else {
-            std::map<KeyType,std::vector<double_t>>::const_iterator const   iterMedian(_medianValues.find(key));
-            typename TimeSeriesImputerEstimator::ColsToImputeType &         addedRowData(std::get<3>(addedRow));
+            ColsToImputeType &                                              addedRowData(std::get<3>(addedRow));
 
             for(std::size_t addedRowColIndex = 0; addedRowColIndex < addedRowData.size(); ++addedRowColIndex) {
 
-                if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(_colsToImputeDataTypes[addedRowColIndex]) == false)
+                if(TypesT::SupportsMedian(_colsToImputeDataTypes[addedRowColIndex]) == false)
                     continue;
 
-                if(StrTraits::IsNull(addedRowData[addedRowColIndex])) {
-                    if(iterMedian == _medianValues.end())
+                if(ValueTraits::IsNull(addedRowData[addedRowColIndex])) {
+                    if(state.pMedians == nullptr)
                     {
                         if(_supressError)
                             continue;
@@ -505,8 +586,8 @@ inline void TimeSeriesImputerEstimator::Transformer::ffill_or_median(typename Th
                     }
 
 					assert(addedRowColIndex < _colsToImputeDataTypes.size());
-                    assert(addedRowColIndex < iterMedian->second.size());
-                    addedRowData[addedRowColIndex] = Traits<std::double_t>::ToString(iterMedian->second[addedRowColIndex]);
+                    assert(addedRowColIndex < state.pMedians->size());
+                    addedRowData[addedRowColIndex] = TypesT::FromDouble((*state.pMedians)[addedRowColIndex]);
                 }
             }
 
@@ -515,8 +596,6 @@ inline void TimeSeriesImputerEstimator::Transformer::ffill_or_median(typename Th
         lastRow = addedRow;
     }
 
-    _lastRowtracker[key] = lastRow;
-
     // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
     for(auto & addedRow : addedRowsResultset)
         callback(std::move(addedRow));
@@ -0,0 +1,348 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <unordered_map>
+
+#include "../../Traits.h"
+#include "GrainDictionary.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         GrainKeyHash
+///  \brief         Hashes a grain (a vector of strings) so that it can be
+///                 used as the key of an unordered container.
+///
+struct GrainKeyHash {
+    size_t operator()(std::vector<std::string> const &key) const;
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         StringTimeSeriesTypes
+///  \brief         Types used by the time series imputer components when the
+///                 grain and the columns to impute are provided as strings.
+///
+///                 Numeric values are parsed and formatted when calculating
+///                 and imputing medians.
+///
+struct StringTimeSeriesTypes {
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using KeyType                           = std::vector<std::string>;
+    using KeyHashType                       = Details::GrainKeyHash;
+    using GrainDictionaryType               = GrainDictionary<KeyType, KeyHashType>;
+    using ValueType                         = nonstd::optional<std::string>;
+    using ColsToImputeType                  = std::vector<ValueType>;
+
+    using InputType                         = std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType>;
+    using TransformedType                   = std::tuple<bool, std::chrono::system_clock::time_point, KeyType, ColsToImputeType>;
+
+    // Ordered, as the grain order is visible in flushed output and in
+    // serialized transformers.
+    template <typename T>
+    using MapType                           = std::map<KeyType, T>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    static bool SupportsMedian(TypeId typeId);
+
+    static std::double_t ToDouble(ValueType const &value);
+    static ValueType FromDouble(std::double_t value);
+
+    template <typename ArchiveT>
+    static void SerializeRow(ArchiveT &ar, ColsToImputeType const &row);
+
+    template <typename ArchiveT>
+    static ColsToImputeType DeserializeRow(ArchiveT &ar);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         NumericTimeSeriesRow
+///  \brief         The values to impute for a single row of a numeric time
+///                 series. Values are stored inline, so creating, copying and
+///                 buffering rows never allocates; the number of columns is
+///                 limited to `MaxNumColumns`.
+///
+class NumericTimeSeriesRow {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using value_type                        = std::double_t;
+    using iterator                          = std::double_t *;
+    using const_iterator                    = std::double_t const *;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr size_t const           MaxNumColumns = 16;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    NumericTimeSeriesRow(void);
+    NumericTimeSeriesRow(size_t numColumns, std::double_t value);
+    NumericTimeSeriesRow(std::initializer_list<std::double_t> values);
+
+    size_t size(void) const;
+    bool empty(void) const;
+
+    iterator begin(void);
+    iterator end(void);
+    const_iterator begin(void) const;
+    const_iterator end(void) const;
+
+    std::double_t & operator[](size_t index);
+    std::double_t const & operator[](size_t index) const;
+
+    bool operator==(NumericTimeSeriesRow const &other) const;
+    bool operator!=(NumericTimeSeriesRow const &other) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t                                  _size;
+    std::array<std::double_t, MaxNumColumns>    _values;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         NumericTimeSeriesTypes
+///  \brief         Types used by the time series imputer components when the
+///                 grain is pre-hashed by the caller and the columns to impute
+///                 are numeric.
+///
+///                 NaN values are null (see `Traits<std::double_t>`), so a row
+///                 is imputed without any string formatting or parsing.
+///
+struct NumericTimeSeriesTypes {
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using KeyType                           = std::uint64_t;
+    using KeyHashType                       = std::hash<std::uint64_t>;
+    using GrainDictionaryType               = GrainDictionary<KeyType, KeyHashType>;
+    using ValueType                         = std::double_t;
+    using ColsToImputeType                  = NumericTimeSeriesRow;
+
+    using InputType                         = std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType>;
+    using TransformedType                   = std::tuple<bool, std::chrono::system_clock::time_point, KeyType, ColsToImputeType>;
+
+    template <typename T>
+    using MapType                           = std::unordered_map<KeyType, T, KeyHashType>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    static bool SupportsMedian(TypeId typeId);
+
+    static std::double_t ToDouble(ValueType const &value);
+    static ValueType FromDouble(std::double_t value);
+
+    template <typename ArchiveT>
+    static void SerializeRow(ArchiveT &ar, ColsToImputeType const &row);
+
+    template <typename ArchiveT>
+    static ColsToImputeType DeserializeRow(ArchiveT &ar);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  Details::GrainKeyHash
+// |
+// ----------------------------------------------------------------------
+inline size_t Details::GrainKeyHash::operator()(std::vector<std::string> const &key) const {
+    std::hash<std::string> const            hasher;
+    size_t                                  result(key.size());
+
+    for(auto const &value : key)
+        result ^= hasher(value) + 0x9e3779b9 + (result << 6) + (result >> 2);
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  StringTimeSeriesTypes
+// |
+// ----------------------------------------------------------------------
+inline /*static*/ bool StringTimeSeriesTypes::SupportsMedian(TypeId typeId) {
+    return typeId == TypeId::Float16
+        || typeId == TypeId::Float32
+        || typeId == TypeId::Float64
+        || typeId == TypeId::BFloat16;
+}
+
+inline /*static*/ std::double_t StringTimeSeriesTypes::ToDouble(ValueType const &value) {
+    return Traits<std::double_t>::FromString(Traits<ValueType>::GetNullableValue(value));
+}
+
+inline /*static*/ StringTimeSeriesTypes::ValueType StringTimeSeriesTypes::FromDouble(std::double_t value) {
+    return Traits<std::double_t>::ToString(value);
+}
+
+template <typename ArchiveT>
+/*static*/ void StringTimeSeriesTypes::SerializeRow(ArchiveT &ar, ColsToImputeType const &row) {
+    Traits<ColsToImputeType>::serialize(ar, row);
+}
+
+template <typename ArchiveT>
+/*static*/ StringTimeSeriesTypes::ColsToImputeType StringTimeSeriesTypes::DeserializeRow(ArchiveT &ar) {
+    return Traits<ColsToImputeType>::deserialize(ar);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  NumericTimeSeriesRow
+// |
+// ----------------------------------------------------------------------
+inline NumericTimeSeriesRow::NumericTimeSeriesRow(void) :
+    _size(0) {
+}
+
+inline NumericTimeSeriesRow::NumericTimeSeriesRow(size_t numColumns, std::double_t value) :
+    _size(
+        [&numColumns](void) {
+            if(numColumns > MaxNumColumns)
+                throw std::invalid_argument("numColumns");
+
+            return numColumns;
+        }()
+    ) {
+    std::fill(begin(), end(), value);
+}
+
+inline NumericTimeSeriesRow::NumericTimeSeriesRow(std::initializer_list<std::double_t> values) :
+    _size(
+        [&values](void) {
+            if(values.size() > MaxNumColumns)
+                throw std::invalid_argument("values");
+
+            return values.size();
+        }()
+    ) {
+    std::copy(values.begin(), values.end(), begin());
+}
+
+inline size_t NumericTimeSeriesRow::size(void) const {
+    return _size;
+}
+
+inline bool NumericTimeSeriesRow::empty(void) const {
+    return _size == 0;
+}
+
+inline NumericTimeSeriesRow::iterator NumericTimeSeriesRow::begin(void) {
+    return _values.data();
+}
+
+inline NumericTimeSeriesRow::iterator NumericTimeSeriesRow::end(void) {
+    return _values.data() + _size;
+}
+
+inline NumericTimeSeriesRow::const_iterator NumericTimeSeriesRow::begin(void) const {
+    return _values.data();
+}
+
+inline NumericTimeSeriesRow::const_iterator NumericTimeSeriesRow::end(void) const {
+    return _values.data() + _size;
+}
+
+inline std::double_t & NumericTimeSeriesRow::operator[](size_t index) {
+    assert(index < _size);
+    return _values[index];
+}
+
+inline std::double_t const & NumericTimeSeriesRow::operator[](size_t index) const {
+    assert(index < _size);
+    return _values[index];
+}
+
+inline bool NumericTimeSeriesRow::operator==(NumericTimeSeriesRow const &other) const {
+    return _size == other._size && std::equal(begin(), end(), other.begin());
+}
+
+inline bool NumericTimeSeriesRow::operator!=(NumericTimeSeriesRow const &other) const {
+    return !(*this == other);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  NumericTimeSeriesTypes
+// |
+// ----------------------------------------------------------------------
+inline /*static*/ bool NumericTimeSeriesTypes::SupportsMedian(TypeId) {
+    return true;
+}
+
+inline /*static*/ std::double_t NumericTimeSeriesTypes::ToDouble(ValueType const &value) {
+    return value;
+}
+
+inline /*static*/ NumericTimeSeriesTypes::ValueType NumericTimeSeriesTypes::FromDouble(std::double_t value) {
+    return value;
+}
+
+template <typename ArchiveT>
+/*static*/ void NumericTimeSeriesTypes::SerializeRow(ArchiveT &ar, ColsToImputeType const &row) {
+    ar.serialize(static_cast<std::uint32_t>(row.size()));
+
+    for(auto const &value : row)
+        Traits<ValueType>::serialize(ar, value);
+}
+
+template <typename ArchiveT>
+/*static*/ NumericTimeSeriesTypes::ColsToImputeType NumericTimeSeriesTypes::DeserializeRow(ArchiveT &ar) {
+    ColsToImputeType                        result(ar.template deserialize<std::uint32_t>(), ValueType());
+
+    for(auto &value : result)
+        value = Traits<ValueType>::deserialize(ar);
+
+    return result;
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -8,27 +8,32 @@
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 #include "../Components/PipelineExecutionEstimatorImpl.h"
+#include "QuantileSketch.h"
+#include "TimeSeriesImputerTypes.h"
 
 namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
 namespace Components {
 
+namespace Details {
+
 /////////////////////////////////////////////////////////////////////////
-///  \class         TimeSeriesMedianAnnotation
+///  \class         TimeSeriesMedianAnnotationImpl
 ///  \brief         This is an annotation class which holds the Median
 ///                 per grain for TimeSeries
 ///
-class TimeSeriesMedianAnnotation : public Annotation {
+template <typename TypesT>
+class TimeSeriesMedianAnnotationImpl : public Annotation {
 public:
     // ----------------------------------------------------------------------
     // |
     // |  Public Types
     // |
     // ----------------------------------------------------------------------
-    using KeyType                           = std::vector<std::string>;
+    using KeyType                           = typename TypesT::KeyType;
     using ValueType                         = std::vector<double_t>;
-    using MedianMapType                     = std::map<KeyType,ValueType>;
+    using MedianMapType                     = typename TypesT::template MapType<ValueType>;
 
     // ----------------------------------------------------------------------
     // |
@@ -42,28 +47,55 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesMedianAnnotation(std::map<KeyType,ValueType> value);
-    ~TimeSeriesMedianAnnotation(void) override = default;
+    TimeSeriesMedianAnnotationImpl(MedianMapType value);
+    ~TimeSeriesMedianAnnotationImpl(void) override = default;
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesMedianAnnotation);
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesMedianAnnotationImpl);
 };
 
 /////////////////////////////////////////////////////////////////////////
-///  \class         TimeSeriesMedianEstimator
-///  \brief         This class computes the median per grain.
-///                 .
+///  \class         TimeSeriesMedianEstimatorImpl
+///  \brief         This class computes the median per grain and column.
+///
+///                 The values for each grain and column are summarized by a
+///                 `QuantileSketch`, so memory is bounded regardless of the
+///                 number of rows in a grain. The rank of the calculated
+///                 median is within `maxRankError * <number of values>` of
+///                 the exact rank (with 99% confidence); grains with fewer
+///                 than roughly 1 / `maxRankError` values have exact medians.
 ///
-class TimeSeriesMedianEstimator : public FitEstimator<std::tuple<std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> {
+///                 Grains are interned in a `GrainDictionary`, which may be
+///                 shared with other estimators trained on the same data, and
+///                 the sketches of each grain are stored by grain id.
+///
+template <typename TypesT>
+class TimeSeriesMedianEstimatorImpl : public FitEstimator<typename TypesT::InputType> {
 public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using AnnotationType                    = TimeSeriesMedianAnnotationImpl<TypesT>;
+    using GrainDictionaryType               = typename TypesT::GrainDictionaryType;
+    using GrainDictionaryPtr                = std::shared_ptr<GrainDictionaryType>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::float_t const     DefaultMaxRankError = 0.01f;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TimeSeriesMedianEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes);
-    ~TimeSeriesMedianEstimator(void) override = default;
+    TimeSeriesMedianEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, std::float_t maxRankError=DefaultMaxRankError, GrainDictionaryPtr pGrains=GrainDictionaryPtr());
+    ~TimeSeriesMedianEstimatorImpl(void) override = default;
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesMedianEstimator);
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesMedianEstimatorImpl);
 
     static bool DoesColTypeSupportMedian(TypeId typeId);
 
@@ -73,22 +105,28 @@ private:
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using KeyType                           = std::vector<std::string>;
-    using ColsToImputeType                  = std::vector<nonstd::optional<std::string>>;
-    using BaseType                          = FitEstimator<std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType>>;
+    using KeyType                           = typename TypesT::KeyType;
+    using ColsToImputeType                  = typename TypesT::ColsToImputeType;
+    using BaseType                          = FitEstimator<typename TypesT::InputType>;
+
+    using SketchType                        = QuantileSketch<std::double_t>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-	std::vector<TypeId> const               _colsToImputeDataTypes;
-    // _aggregateTracker is used to track sum in fit, while countTracker tracks count.
-    // However, in complete_training_impl, we divide values(sum) in _aggregateTracker
-    // by corresponding counts and after that it tracks median.
-    // Annotation is created using _aggregateTracker.
-    std::map<KeyType,std::vector<double_t>>  _aggregateTracker;
-    std::map<KeyType,std::vector<int64_t>>   _countTracker;
+    std::vector<TypeId> const               _colsToImputeDataTypes;
+    std::uint16_t const                     _k;
+    GrainDictionaryPtr const                _pGrains;
+
+    // Indexes of the columns that support median
+    std::vector<size_t> const               _medianCols;
+
+    // The sketches of each grain, by grain id, with one sketch for each of
+    // `_medianCols`. Grains interned by other estimators that share the
+    // dictionary have an empty vector until they are seen.
+    std::vector<std::vector<SketchType>>    _sketches;
 
     // ----------------------------------------------------------------------
     // |
@@ -101,6 +139,36 @@ private:
     void complete_training_impl(void) override;
 };
 
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       TimeSeriesMedianAnnotation
+///  \brief         Medians per grain of a time series whose grains and
+///                 columns are strings.
+///
+using TimeSeriesMedianAnnotation            = Details::TimeSeriesMedianAnnotationImpl<StringTimeSeriesTypes>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       TimeSeriesMedianEstimator
+///  \brief         Computes the medians per grain of a time series whose
+///                 grains and columns are strings.
+///
+using TimeSeriesMedianEstimator             = Details::TimeSeriesMedianEstimatorImpl<StringTimeSeriesTypes>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       NumericTimeSeriesMedianAnnotation
+///  \brief         Medians per grain of a time series whose grains are
+///                 pre-hashed and whose columns are numeric.
+///
+using NumericTimeSeriesMedianAnnotation     = Details::TimeSeriesMedianAnnotationImpl<NumericTimeSeriesTypes>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       NumericTimeSeriesMedianEstimator
+///  \brief         Computes the medians per grain of a time series whose
+///                 grains are pre-hashed and whose columns are numeric.
+///
+using NumericTimeSeriesMedianEstimator      = Details::TimeSeriesMedianEstimatorImpl<NumericTimeSeriesTypes>;
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -113,76 +181,120 @@ private:
 
 // ----------------------------------------------------------------------
 // |
-// |  TimeSeriesMedianAnnotation
+// |  Details::TimeSeriesMedianAnnotationImpl
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesMedianAnnotation::TimeSeriesMedianAnnotation(TimeSeriesMedianAnnotation::MedianMapType value) :
+template <typename TypesT>
+Details::TimeSeriesMedianAnnotationImpl<TypesT>::TimeSeriesMedianAnnotationImpl(MedianMapType value) :
     Value(std::move(value)) {
 }
 
 // ----------------------------------------------------------------------
 // |
-// |  TimeSeriesMedianEstimator
+// |  Details::TimeSeriesMedianEstimatorImpl
 // |
 // ----------------------------------------------------------------------
-inline TimeSeriesMedianEstimator::TimeSeriesMedianEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes) :
+template <typename TypesT>
+constexpr std::float_t const Details::TimeSeriesMedianEstimatorImpl<TypesT>::DefaultMaxRankError;
+
+template <typename TypesT>
+Details::TimeSeriesMedianEstimatorImpl<TypesT>::TimeSeriesMedianEstimatorImpl(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, std::float_t maxRankError, GrainDictionaryPtr pGrains) :
     BaseType("TimeSeriesMedianEstimator", std::move(pAllColumnAnnotations)),
-    _colsToImputeDataTypes(std::move(colsToImputeDataTypes)) {
+    _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
+    _k(SketchType::GetK(maxRankError)),
+    _pGrains(pGrains ? std::move(pGrains) : std::make_shared<GrainDictionaryType>()),
+    _medianCols(
+        [this](void) {
+            std::vector<size_t>             result;
+
+            for(size_t i = 0; i < _colsToImputeDataTypes.size(); ++i) {
+                if(DoesColTypeSupportMedian(_colsToImputeDataTypes[i]))
+                    result.emplace_back(i);
+            }
+
+            return result;
+        }()
+    ) {
 }
 
-inline /*static*/ bool TimeSeriesMedianEstimator::DoesColTypeSupportMedian(TypeId typeId) {
-    return typeId == TypeId::Float16
-        || typeId == TypeId::Float32
-        || typeId == TypeId::Float64
-        || typeId == TypeId::BFloat16;
+template <typename TypesT>
+/*static*/ bool Details::TimeSeriesMedianEstimatorImpl<TypesT>::DoesColTypeSupportMedian(TypeId typeId) {
+    return TypesT::SupportsMedian(typeId);
 }
 
-inline bool TimeSeriesMedianEstimator::begin_training_impl(void) /*override*/ {
+template <typename TypesT>
+bool Details::TimeSeriesMedianEstimatorImpl<TypesT>::begin_training_impl(void) /*override*/ {
     return true;
 }
 
-inline FitResult TimeSeriesMedianEstimator::fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) {
+template <typename TypesT>
+FitResult Details::TimeSeriesMedianEstimatorImpl<TypesT>::fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) /*override*/ {
+    // ----------------------------------------------------------------------
+    using ValueTraits                                                   = Traits<typename TypesT::ValueType>;
+    // ----------------------------------------------------------------------
+
     typename BaseType::InputType const * const          pEndBuffer(pBuffer + cBuffer);
 
     while(pBuffer != pEndBuffer) {
-        std::tuple<std::chrono::system_clock::time_point, KeyType, ColsToImputeType> const &        input(*pBuffer++);
+        typename BaseType::InputType const &                            input(*pBuffer++);
         KeyType const &                                                 key (std::get<1>(input));
         ColsToImputeType const &                                        colValues (std::get<2>(input));
 
-        if(_aggregateTracker.find(key) == _aggregateTracker.end()) {
-            _aggregateTracker.insert(std::make_pair(key, std::vector<double_t>(colValues.size(), 0.0)));
-            _countTracker.insert(std::make_pair(key, std::vector<int64_t>(colValues.size(), 0)));
+        if(colValues.size() != _colsToImputeDataTypes.size())
+            throw std::invalid_argument("Input data does not match the number of columns to impute.");
+
+        typename GrainDictionaryType::IdType const                      id(_pGrains->intern(key));
+
+        if(id >= _sketches.size())
+            _sketches.resize(_pGrains->size());
+
+        std::vector<SketchType> &                                       sketches(_sketches[id]);
+
+        if(sketches.empty()) {
+            sketches.reserve(_medianCols.size());
+
+            for(std::size_t i=0; i< _medianCols.size(); ++i)
+                sketches.emplace_back(_k);
         }
 
-        for(std::size_t i=0; i< colValues.size(); ++i) {
-            if(Traits<nonstd::optional<std::string>>::IsNull(colValues[i]) || DoesColTypeSupportMedian(_colsToImputeDataTypes[i]) == false)
+        for(std::size_t i=0; i< _medianCols.size(); ++i) {
+            typename TypesT::ValueType const &                          value(colValues[_medianCols[i]]);
+
+            if(ValueTraits::IsNull(value))
                 continue;
 
-            _aggregateTracker[key][i] += Traits<std::double_t>::FromString(Traits<nonstd::optional<std::string>>::GetNullableValue(colValues[i]));
-            _countTracker[key][i] += 1;
+            sketches[i].update(TypesT::ToDouble(value));
         }
     }
 
     return FitResult::Continue;
 }
 
-inline void TimeSeriesMedianEstimator::complete_training_impl(void) {
-    // Note that this class reuses _aggregateTracker to calculate median values before
-    // moving it to the annotation.
-    for(auto & kvp: _aggregateTracker) {
-        KeyType const & key = kvp.first;
-        for(std::size_t i=0; i< kvp.second.size(); ++i) {
-            auto count = _countTracker[key][i];
-            if(DoesColTypeSupportMedian(_colsToImputeDataTypes[i]) == false)
-                continue;
-            if(count == 0)
+template <typename TypesT>
+void Details::TimeSeriesMedianEstimatorImpl<TypesT>::complete_training_impl(void) /*override*/ {
+    typename AnnotationType::MedianMapType              medians;
+
+    for(typename GrainDictionaryType::IdType id = 0; id < _sketches.size(); ++id) {
+        std::vector<SketchType> const &                 sketches(_sketches[id]);
+
+        if(sketches.empty())
+            continue;
+
+        std::vector<std::double_t>                      values(_colsToImputeDataTypes.size(), 0.0);
+
+        for(std::size_t i=0; i< sketches.size(); ++i) {
+            if(sketches[i].empty())
                 throw std::runtime_error("No valid value found for median computation.");
-            kvp.second[i] /= count;
+
+            values[_medianCols[i]] = sketches[i].interpolated_quantile(0.5);
         }
+
+        medians.emplace(_pGrains->key(id), std::move(values));
     }
-    _countTracker.clear();
 
-    BaseType::add_annotation(std::make_shared<TimeSeriesMedianAnnotation>(std::move(_aggregateTracker)), 0);
+    _sketches.clear();
+
+    BaseType::add_annotation(std::make_shared<AnnotationType>(std::move(medians)), 0);
 }
 
 } // namespace Components
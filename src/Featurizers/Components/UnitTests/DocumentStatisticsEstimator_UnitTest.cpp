@@ -5,6 +5,10 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <chrono>
+#include <iostream>
+#include <map>
+
 #include "../../../3rdParty/optional.h"
 #include "../DocumentStatisticsEstimator.h"
 #include "../../TestHelpers.h"
@@ -112,6 +116,72 @@ TEST_CASE("TestGeneratingParseFunc") {
     TestGeneratingParseFunc("jumpy fox", {"jumpy", "fox", "jumpy fox"}, AnalyzerMethod::Word, "", 1, 2);
     TestGeneratingParseFunc("jumpy fox", {"jumpy", "umpy ", "mpy f", "py fo", "y fox"}, AnalyzerMethod::Char, "", 5, 5);
     TestGeneratingParseFunc(" jumpy fox ", {" jump", "jumpy", "umpy ", " fox "}, AnalyzerMethod::Charwb, "", 5, 5);
+    TestGeneratingParseFunc("jumpy, fox_1 a 42", {"jumpy", "fox_1", "a", "42"}, AnalyzerMethod::Word, "\\w+", 1, 1);
+    TestGeneratingParseFunc("jumpy, fox_1 a 42", {"jumpy", "fox_1", "42"}, AnalyzerMethod::Word, "\\b\\w\\w+\\b", 1, 1);
+    TestGeneratingParseFunc("jumpy, fox_1 a 42", {"1", "42"}, AnalyzerMethod::Word, "\\d+", 1, 1);
+    TestGeneratingParseFunc("jumpy fox", {"jumpy fox"}, AnalyzerMethod::Word, "[a-z]+ [a-z]+", 1, 1);
+}
+
+TEST_CASE("TestGeneratingParseFunc - character class patterns match std::regex") {
+    std::string const                       input(" The quick,brown\tfox_9 -- jumps 42x over\nthe  l\xe4zy dog! a b2 _ ");
+
+    for(std::string const pattern : { "\\w+", "\\b\\w\\w+\\b", "\\w\\w+", "\\d+", "[a-zA-Z]+", "[A-Za-z]+", "\\S+", "[^\\s]+" }) {
+        std::vector<std::string>            expected;
+
+        NS::Strings::ParseRegex<StringIterator, std::regex>(
+            input,
+            std::regex(pattern),
+            [&expected] (StringIterator begin, StringIterator end) {
+                expected.emplace_back(std::string(begin, end));
+            }
+        );
+
+        TestGeneratingParseFunc(input, expected, AnalyzerMethod::Word, pattern, 1, 1);
+    }
+}
+
+TEST_CASE("TestGeneratingParseFunc - invalid regex") {
+    ParseFunctionType                       parseFunc;
+
+    CHECK_THROWS_AS(NS::Featurizers::Components::DocumentParseFuncGenerator(parseFunc, AnalyzerMethod::Word, "[a-z", 1, 1), std::regex_error);
+}
+
+TEST_CASE("TestGeneratingParseFunc - Benchmark", "[.][benchmark]") {
+    std::vector<std::string>                documents;
+
+    for(int i = 0; i < 2000; ++i)
+        documents.emplace_back("the quick brown fox " + std::to_string(i) + " jumps over the lazy dog and runs away");
+
+    for(std::string const pattern : { "\\w+", "[a-z]+|[0-9]+" }) {
+        size_t                              numTokens(0);
+        auto const                          callback(
+            [&numTokens] (StringIterator, StringIterator) {
+                ++numTokens;
+            }
+        );
+
+        // Compiling the regex for each document (the previous behavior)
+        auto                                start(std::chrono::steady_clock::now());
+
+        for(auto const &document : documents)
+            NS::Strings::ParseRegex<StringIterator, std::regex>(document, std::regex(pattern), callback);
+
+        std::chrono::duration<double, std::micro> const     perDocumentBefore((std::chrono::steady_clock::now() - start) / documents.size());
+
+        ParseFunctionType                   parseFunc;
+
+        NS::Featurizers::Components::DocumentParseFuncGenerator(parseFunc, AnalyzerMethod::Word, pattern, 1, 1);
+
+        start = std::chrono::steady_clock::now();
+
+        for(auto const &document : documents)
+            parseFunc(document, callback);
+
+        std::chrono::duration<double, std::micro> const     perDocumentAfter((std::chrono::steady_clock::now() - start) / documents.size());
+
+        std::cout << "'" << pattern << "': " << perDocumentBefore.count() << " us/document before, " << perDocumentAfter.count() << " us/document after\n";
+        CHECK(numTokens != 0);
+    }
 }
 
 TEST_CASE("DocumentDecorator functionality") {
@@ -794,3 +864,52 @@ TEST_CASE("string_idf_custom_over_existingVocabulary") {
                    ngramRangeMin,
                    ngramRangeMax);
 }
+
+TEST_CASE("string_idf_multiple_threads") {
+    std::vector<std::string>                documents;
+
+    for(std::uint32_t i = 0; i < 5000; ++i) {
+        documents.emplace_back(
+            "term" + std::to_string(i % 7) +
+            " term" + std::to_string(i % 113) +
+            " term" + std::to_string(i % 1009) +
+            " common"
+        );
+    }
+
+    auto const                              trainFunc(
+        [&documents](std::uint32_t numThreads, nonstd::optional<std::uint32_t> maxFeatures, std::float_t minDf, std::float_t maxDf) {
+            NS::AnnotationMapsPtr           pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+            NS::Featurizers::Components::DocumentStatisticsEstimator<std::numeric_limits<size_t>::max()>
+                                            estimator(pAllColumnAnnotations, 0, StringDecorator(), AnalyzerMethod::Word, "", nonstd::optional<IndexMap>(), maxFeatures, minDf, maxDf, 1, 2, numThreads);
+
+            NS::TestHelpers::Train(estimator, std::vector<std::vector<std::string>>({documents}));
+
+            NS::Featurizers::Components::DocumentStatisticsAnnotationData const &
+                                            annotation(estimator.get_annotation_data());
+
+            std::map<std::string, std::pair<std::uint32_t, std::uint32_t>>  results;
+
+            for(auto const &kvp : annotation.TermFrequencyAndIndex)
+                results.emplace(kvp.first, std::make_pair(kvp.second.TermFrequency, kvp.second.Index));
+
+            return std::make_pair(std::move(results), annotation.TotalNumDocuments);
+        }
+    );
+
+    auto const                              checkFunc(
+        [&trainFunc](nonstd::optional<std::uint32_t> maxFeatures, std::float_t minDf, std::float_t maxDf) {
+            auto const                      expected(trainFunc(1, maxFeatures, minDf, maxDf));
+
+            CHECK(expected.second == 5000);
+            CHECK(trainFunc(4, maxFeatures, minDf, maxDf) == expected);
+            CHECK(trainFunc(7, maxFeatures, minDf, maxDf) == expected);
+        }
+    );
+
+    checkFunc(nonstd::optional<std::uint32_t>(), 0.0f, 1.0f);
+    checkFunc(nonstd::optional<std::uint32_t>(static_cast<std::uint32_t>(50)), 0.0f, 1.0f);
+    checkFunc(nonstd::optional<std::uint32_t>(), 0.01f, 0.5f);
+
+    CHECK_THROWS_WITH(NS::Featurizers::Components::Details::DocumentStatisticsTrainingOnlyPolicy(StringDecorator(), AnalyzerMethod::Word, "", nonstd::optional<IndexMap>(), nonstd::optional<std::uint32_t>(), 0.0f, 1.0f, 1, 1, 0), "numThreads");
+}
@@ -0,0 +1,217 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <atomic>
+
+#include "../EstimatorDagScheduler.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using Scheduler                             = NS::Featurizers::Components::EstimatorDagScheduler;
+using AnnotationKey                         = Scheduler::AnnotationKey;
+
+class SumAnnotation : public NS::Annotation {
+public:
+    std::int64_t const                      Sum;
+
+    SumAnnotation(std::int64_t sum) : Sum(sum) {}
+    ~SumAnnotation(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(SumAnnotation);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SumEstimator
+///  \brief         Sums its input, starting with the sum produced by the
+///                 `Estimator` that it depends upon (if any).
+///
+class SumEstimator : public NS::FitEstimator<int> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    SumEstimator(char const *name, NS::AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, char const *dependency=nullptr, bool resetOnce=false) :
+        NS::FitEstimator<int>(name, std::move(pAllColumnAnnotations)),
+        _colIndex(colIndex),
+        _dependency(dependency),
+        _resetOnce(resetOnce),
+        _sum(0) {
+    }
+
+    ~SumEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(SumEstimator);
+
+    SumAnnotation * get_annotation(void) const {
+        return get_annotation_impl<SumAnnotation>(get_column_annotations(), _colIndex, Name);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    size_t const                            _colIndex;
+    char const * const                      _dependency;
+    bool                                    _resetOnce;
+    std::int64_t                            _sum;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    bool begin_training_impl(void) override {
+        if(_dependency) {
+            SumAnnotation const * const     pAnnotation(get_annotation_impl<SumAnnotation>(get_column_annotations(), _colIndex, _dependency));
+
+            if(pAnnotation == nullptr)
+                throw std::runtime_error("Missing dependency");
+
+            _sum = pAnnotation->Sum;
+        }
+
+        return true;
+    }
+
+    NS::FitResult fit_impl(InputType const *pBuffer, size_t cBuffer) override {
+        if(_resetOnce) {
+            _resetOnce = false;
+            return NS::FitResult::Reset;
+        }
+
+        for(size_t i = 0; i < cBuffer; ++i) {
+            if(pBuffer[i] < 0)
+                throw std::runtime_error("Negative value");
+
+            _sum += pBuffer[i];
+        }
+
+        return NS::FitResult::Continue;
+    }
+
+    void complete_training_impl(void) override {
+        add_annotation(std::make_shared<SumAnnotation>(_sum), _colIndex);
+    }
+};
+
+TEST_CASE("Dependencies") {
+    std::vector<int> const                  items{1, 2, 3, 4};
+
+    for(std::uint32_t numThreads : {1u, 2u, 4u}) {
+        for(int iteration = 0; iteration < 20; ++iteration) {
+            NS::AnnotationMapsPtr const     pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(2));
+
+            SumEstimator                    a("A", pAllColumnAnnotations, 0);
+            SumEstimator                    b("B", pAllColumnAnnotations, 0, "A", true);
+            SumEstimator                    c("C", pAllColumnAnnotations, 0, "B");
+            SumEstimator                    d("D", pAllColumnAnnotations, 1);
+            SumEstimator                    e("E", pAllColumnAnnotations, 1, "D");
+            SumEstimator                    f("F", pAllColumnAnnotations, 1);
+
+            Scheduler                       scheduler(numThreads);
+
+            // Consumers are added before their producers
+            scheduler.add(c, items.data(), items.size(), {AnnotationKey(0, "C")}, {AnnotationKey(0, "B")});
+            scheduler.add(e, items.data(), items.size(), {AnnotationKey(1, "E")}, {AnnotationKey(1, "D")});
+            scheduler.add(b, items.data(), items.size(), {AnnotationKey(0, "B")}, {AnnotationKey(0, "A")});
+            scheduler.add(a, items.data(), items.size(), {AnnotationKey(0, "A")}, {});
+            scheduler.add(d, items.data(), items.size(), {AnnotationKey(1, "D")}, {});
+            scheduler.add(f, items.data(), items.size(), {AnnotationKey(1, "F")}, {AnnotationKey(1, "Unknown")});
+
+            scheduler.execute();
+
+            CHECK(a.get_annotation()->Sum == 10);
+            CHECK(b.get_annotation()->Sum == 20);
+            CHECK(c.get_annotation()->Sum == 30);
+            CHECK(d.get_annotation()->Sum == 10);
+            CHECK(e.get_annotation()->Sum == 20);
+            CHECK(f.get_annotation()->Sum == 10);
+
+            CHECK((*pAllColumnAnnotations)[0].size() == 3);
+            CHECK((*pAllColumnAnnotations)[1].size() == 3);
+        }
+    }
+}
+
+TEST_CASE("Independent Estimators sharing a column") {
+    std::vector<int> const                  items{1, 2, 3};
+    std::vector<std::string>                names;
+
+    for(int i = 0; i < 32; ++i)
+        names.emplace_back("Estimator" + std::to_string(i));
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    std::vector<SumEstimator>               estimators;
+    Scheduler                               scheduler(8);
+
+    estimators.reserve(names.size());
+
+    for(auto const &name : names) {
+        estimators.emplace_back(name.c_str(), pAllColumnAnnotations, 0);
+        scheduler.add(estimators.back(), items.data(), items.size(), {AnnotationKey(0, name)}, {});
+    }
+
+    scheduler.execute();
+
+    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+
+    CHECK(annotations.size() == names.size());
+
+    for(auto const &name : names) {
+        CHECK(annotations.get_annotations(name.c_str()).size() == 1);
+    }
+
+    // The keys are interned, so they outlive the names provided by the Estimators
+    names.clear();
+
+    CHECK(annotations.get_annotations("Estimator7").size() == 1);
+}
+
+TEST_CASE("Exceptions") {
+    std::vector<int> const                  items{1, 2, 3};
+    std::vector<int> const                  invalidItems{1, -2, 3};
+
+    for(std::uint32_t numThreads : {1u, 4u}) {
+        NS::AnnotationMapsPtr const         pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+        SumEstimator                        a("A", pAllColumnAnnotations, 0);
+        SumEstimator                        b("B", pAllColumnAnnotations, 0, "A");
+        std::atomic<int>                    numCompleted(0);
+
+        Scheduler                           scheduler(numThreads);
+
+        scheduler.add(a, invalidItems.data(), invalidItems.size(), {AnnotationKey(0, "A")}, {});
+        scheduler.add(b, items.data(), items.size(), {AnnotationKey(0, "B")}, {AnnotationKey(0, "A")});
+        scheduler.add([](void) {}, [&numCompleted](void) { ++numCompleted; }, {}, {});
+
+        CHECK_THROWS_WITH(scheduler.execute(), "Negative value");
+
+        // The dependent Estimator is never started
+        CHECK(b.get_state() == NS::TrainingState::Pending);
+        CHECK(numCompleted <= 1);
+    }
+}
+
+TEST_CASE("Errors") {
+    CHECK_THROWS_WITH(Scheduler(0), "numThreads");
+    CHECK_THROWS_WITH(AnnotationKey(0, ""), "name");
+
+    Scheduler                               scheduler(2);
+    int                                     numInvoked(0);
+    auto const                              func([&numInvoked](void) { ++numInvoked; });
+
+    CHECK_THROWS_WITH(scheduler.add(Scheduler::NodeFunction(), func, {}, {}), "fitFunc");
+    CHECK_THROWS_WITH(scheduler.add(func, Scheduler::NodeFunction(), {}, {}), "completeFunc");
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    SumEstimator                            estimator("A", pAllColumnAnnotations, 0);
+
+    CHECK_THROWS_WITH(scheduler.add(estimator, nullptr, 1, {}, {}), "pItems");
+
+    scheduler.add(func, func, {AnnotationKey(0, "First")}, {AnnotationKey(0, "Third")});
+    scheduler.add(func, func, {AnnotationKey(0, "Second")}, {AnnotationKey(0, "First")});
+    scheduler.add(func, func, {AnnotationKey(0, "Third")}, {AnnotationKey(0, "Second")});
+    scheduler.add(func, func, {AnnotationKey(0, "Independent")}, {});
+
+    CHECK_THROWS_WITH(scheduler.execute(), "The dependencies contain a cycle");
+    CHECK(numInvoked == 0);
+}
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <string>
+
+#include "../GrainDictionary.h"
+
+namespace NS = Microsoft::Featurizer;
+
+TEST_CASE("Multi-column grains") {
+    using KeyType                           = std::vector<std::string>;
+
+    struct KeyHash {
+        size_t operator()(KeyType const &key) const {
+            std::hash<std::string> const    hasher;
+            size_t                          result(key.size());
+
+            for(auto const &value : key)
+                result = result * 31 + hasher(value);
+
+            return result;
+        }
+    };
+
+    NS::Featurizers::Components::GrainDictionary<KeyType, KeyHash>      grains;
+
+    CHECK(grains.size() == 0);
+    CHECK(grains.find({"a", "b"}) == NS::Featurizers::Components::InvalidGrainId);
+
+    CHECK(grains.intern({"a", "b"}) == 0);
+    CHECK(grains.intern({"b", "a"}) == 1);
+    CHECK(grains.intern({"a"}) == 2);
+    CHECK(grains.intern({"a", "b"}) == 0);
+    CHECK(grains.size() == 3);
+
+    CHECK(grains.find({"b", "a"}) == 1);
+    CHECK(grains.find({"a", "c"}) == NS::Featurizers::Components::InvalidGrainId);
+    CHECK(grains.key(2) == KeyType({"a"}));
+    CHECK_THROWS_WITH(grains.key(3), "id");
+
+    grains.clear();
+
+    CHECK(grains.size() == 0);
+    CHECK(grains.find({"a", "b"}) == NS::Featurizers::Components::InvalidGrainId);
+    CHECK(grains.intern({"b", "a"}) == 0);
+}
+
+TEST_CASE("Growth") {
+    NS::Featurizers::Components::GrainDictionary<std::uint64_t>         grains;
+
+    bool                                    allInterned(true);
+
+    // Sequential keys with an identity hash would otherwise collide
+    for(std::uint64_t i = 0; i < 10000; ++i) {
+        if(grains.intern(i * 1024) != i)
+            allInterned = false;
+    }
+
+    CHECK(allInterned);
+    CHECK(grains.size() == 10000);
+
+    bool                                    allFound(true);
+
+    for(std::uint64_t i = 0; i < 10000; ++i) {
+        if(grains.find(i * 1024) != i || grains.key(static_cast<std::uint32_t>(i)) != i * 1024)
+            allFound = false;
+    }
+
+    CHECK(allFound);
+    CHECK(grains.find(1) == NS::Featurizers::Components::InvalidGrainId);
+}
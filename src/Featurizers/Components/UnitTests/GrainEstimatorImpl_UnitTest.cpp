@@ -217,13 +217,12 @@ Test(GrainEstimatorT &estimator, std::vector<InputT> const &inputs, bool creates
     REQUIRE(allAnnotations[0].empty() == false);
 
     NS::AnnotationMap const &                           annotations(allAnnotations[0]);
-    NS::AnnotationMap::const_iterator const             iter(annotations.find(estimator.Name));
+    NS::AnnotationPtrs const                            estimatorAnnotations(annotations.get_annotations(estimator.Name));
 
-    REQUIRE(iter != annotations.end());
-    REQUIRE(iter->second.size() == 1);
-    REQUIRE(dynamic_cast<GrainEstimatorAnnotation const *>(iter->second[0].get()));
+    REQUIRE(estimatorAnnotations.size() == 1);
+    REQUIRE(dynamic_cast<GrainEstimatorAnnotation const *>(estimatorAnnotations[0].get()));
 
-    GrainEstimatorAnnotation const &        thisAnnotation(static_cast<GrainEstimatorAnnotation const &>(*iter->second[0]));
+    GrainEstimatorAnnotation const &        thisAnnotation(static_cast<GrainEstimatorAnnotation const &>(*estimatorAnnotations[0]));
 
     return thisAnnotation.Annotations;
 }
@@ -709,6 +708,178 @@ TEST_CASE("Transformer") {
     }
 }
 
+TEST_CASE("Transformer - batch") {
+    // ----------------------------------------------------------------------
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
+    using OutputType                        = std::tuple<std::string, std::uint64_t>;
+    // ----------------------------------------------------------------------
+
+    Estimator                               estimator("Test", NS::CreateTestAnnotationMapsPtr(1));
+
+    Test(
+        estimator,
+        NS::TestHelpers::make_vector<typename Estimator::InputType>(
+            std::make_tuple("one", 10),
+            std::make_tuple("two", 100),
+            std::make_tuple("two", 200),
+            std::make_tuple("one", 20)
+        ),
+        false
+    );
+
+    typename Estimator::TransformerUniquePtr const  pTransformer(estimator.create_transformer());
+    auto &                                          transformer(static_cast<Components::GrainTransformer<std::string, DeltaEstimator> &>(*pTransformer));
+    std::vector<OutputType>                         results;
+    auto const                                      callback(
+        [&results](OutputType value) {
+            results.emplace_back(std::move(value));
+        }
+    );
+
+    SECTION("Rows are grouped by grain") {
+        std::vector<typename Estimator::InputType> const    inputs(
+            NS::TestHelpers::make_vector<typename Estimator::InputType>(
+                std::make_tuple("two", 1),
+                std::make_tuple("one", 1),
+                std::make_tuple("two", 2),
+                std::make_tuple("one", 2)
+            )
+        );
+
+        transformer.execute_batch(inputs.data(), inputs.size(), callback);
+
+        CHECK(
+            results == NS::TestHelpers::make_vector<OutputType>(
+                std::make_tuple("two", 301),
+                std::make_tuple("two", 302),
+                std::make_tuple("one", 31),
+                std::make_tuple("one", 32)
+            )
+        );
+    }
+
+    SECTION("New grain") {
+        std::vector<typename Estimator::InputType> const    inputs(
+            NS::TestHelpers::make_vector<typename Estimator::InputType>(
+                std::make_tuple("one", 1),
+                std::make_tuple("A New Grain!!", 1)
+            )
+        );
+
+        CHECK_THROWS_WITH(transformer.execute_batch(inputs.data(), inputs.size(), callback), "Grain not found");
+        CHECK(results.empty());
+    }
+}
+
+TEST_CASE("Estimator - multiple threads") {
+    // ----------------------------------------------------------------------
+    using ThisSumTrainingOnlyEstimator      = SumTrainingOnlyEstimator<>;
+    using SumEstimator                      = Components::GrainEstimatorImpl<std::string, ThisSumTrainingOnlyEstimator>;
+    using DeltaGrainEstimator               = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
+    using GrainEstimatorAnnotation          = Components::GrainEstimatorAnnotation<std::string>;
+    // ----------------------------------------------------------------------
+
+    std::vector<typename SumEstimator::InputType>           sumInputs;
+    std::vector<typename DeltaGrainEstimator::InputType>    deltaInputs;
+    std::map<std::string, std::uint64_t>                    expected;
+
+    for(std::uint32_t i = 0; i < 5000; ++i) {
+        // Grain sizes are skewed so that some workers process many more rows than others
+        std::string                         grain(std::to_string(i % 7 == 0 ? 0 : i % 97));
+
+        sumInputs.emplace_back(grain, i);
+        deltaInputs.emplace_back(grain, i);
+        expected[grain] += i;
+    }
+
+    SECTION("Annotations") {
+        SumEstimator                        estimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return ThisSumTrainingOnlyEstimator(std::move(pAllColumnAnnotationsParam), 0);
+            },
+            4
+        );
+
+        GrainEstimatorAnnotation::AnnotationMap const   annotations(Test(estimator, sumInputs));
+
+        REQUIRE(annotations.size() == expected.size());
+
+        bool                                allMatch(true);
+
+        for(auto const &kvp : expected) {
+            auto const                      iter(annotations.find(kvp.first));
+
+            if(iter == annotations.end() || ThisSumTrainingOnlyEstimator::get_annotation_data(*iter->second).Value != kvp.second)
+                allMatch = false;
+        }
+
+        CHECK(allMatch);
+    }
+
+    SECTION("Transformer") {
+        DeltaGrainEstimator                 estimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+            },
+            4
+        );
+
+        Test(estimator, deltaInputs, false);
+
+        typename DeltaGrainEstimator::TransformerUniquePtr const    pTransformer(estimator.create_transformer());
+        bool                                                        allMatch(true);
+
+        for(auto const &kvp : expected) {
+            pTransformer->execute(
+                std::make_tuple(kvp.first, static_cast<std::uint64_t>(0)),
+                [&kvp, &allMatch](std::tuple<std::string, std::uint64_t> value) {
+                    if(std::get<0>(value) != kvp.first || std::get<1>(value) != kvp.second)
+                        allMatch = false;
+                }
+            );
+        }
+
+        CHECK(allMatch);
+    }
+
+    SECTION("Limited total training items") {
+        Components::GrainEstimatorImpl<std::string, DeltaEstimator, 1000>  estimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+            },
+            4
+        );
+
+        Test(estimator, deltaInputs, false);
+
+        std::uint64_t                       expectedTotal(0);
+
+        for(std::uint64_t i = 0; i < 1000; ++i)
+            expectedTotal += i;
+
+        typename DeltaGrainEstimator::TransformerUniquePtr const    pTransformer(estimator.create_transformer());
+        std::uint64_t                                               total(0);
+
+        // Every grain is seen within the first 1000 rows
+        for(auto const &kvp : expected) {
+            pTransformer->execute(
+                std::make_tuple(kvp.first, static_cast<std::uint64_t>(0)),
+                [&total](std::tuple<std::string, std::uint64_t> value) {
+                    total += std::get<1>(value);
+                }
+            );
+        }
+
+        CHECK(total == expectedTotal);
+    }
+}
+
 TEST_CASE("GrainTransformer - deserialization errors") {
     // ----------------------------------------------------------------------
     using GrainTransformer                  = Components::GrainTransformer<int, DeltaEstimator>;
@@ -781,4 +952,16 @@ TEST_CASE("GrainEstimatorImpl - construct errors") {
         GrainEstimator("Test", NS::CreateTestAnnotationMapsPtr(1), typename GrainEstimator::CreateEstimatorFunc()),
         "createFunc"
     );
+
+    CHECK_THROWS_WITH(
+        GrainEstimator(
+            "Test",
+            NS::CreateTestAnnotationMapsPtr(1),
+            [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                return DeltaEstimator(std::move(pAllColumnAnnotationsParam));
+            },
+            0
+        ),
+        "numThreads"
+    );
 }
@@ -19,6 +19,24 @@ TEST_CASE("Imputation") {
     CHECK(transformer.execute(nonstd::optional<int>()) == 10);
 }
 
+TEST_CASE("Imputation - batch") {
+    Components::ImputerTransformer<nonstd::optional<int>, int>              transformer(10);
+
+    std::vector<nonstd::optional<int>> const                                inputs{ 1, nonstd::optional<int>(), 3, nonstd::optional<int>() };
+    std::vector<int>                                                        outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<int>{ 1, 10, 3, 10 });
+
+    Components::ImputerTransformer<float, float>                            floatTransformer(2.5f);
+
+    std::vector<float> const                                                floatInputs{ 1.0f, NS::Traits<float>::CreateNullValue(), 3.0f };
+    std::vector<float>                                                      floatOutputs(floatInputs.size());
+
+    floatTransformer.execute_batch(floatInputs.data(), floatInputs.size(), floatOutputs.data());
+    CHECK(floatOutputs == std::vector<float>{ 1.0f, 2.5f, 3.0f });
+}
+
 TEST_CASE("Comparison") {
     CHECK(Components::ImputerTransformer<nonstd::optional<int>, int>(10) == Components::ImputerTransformer<nonstd::optional<int>, int>(10));
     CHECK(Components::ImputerTransformer<nonstd::optional<int>, int>(10) != Components::ImputerTransformer<nonstd::optional<int>, int>(20));
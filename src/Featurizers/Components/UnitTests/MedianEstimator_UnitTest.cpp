@@ -11,14 +11,14 @@
 namespace NS = Microsoft::Featurizer;
 
 template <bool InterpolateValuesV, typename InputT, typename TransformedT>
-void Test(std::vector<InputT> inputs, TransformedT median) {
+void Test(std::vector<InputT> inputs, TransformedT median, std::float_t maxRankError=0.0f) {
     // ----------------------------------------------------------------------
     using MedianEstimator                   = NS::Featurizers::Components::MedianEstimator<InputT, TransformedT, InterpolateValuesV>;
     using MedianAnnotationData              = NS::Featurizers::Components::MedianAnnotationData<TransformedT>;
     // ----------------------------------------------------------------------
 
     NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
-    MedianEstimator                         estimator(pAllColumnAnnotations, 0);
+    MedianEstimator                         estimator(pAllColumnAnnotations, 0, true, maxRankError);
     std::vector<std::vector<InputT>>        inputBatches{std::move(inputs)};
 
     NS::TestHelpers::Train(estimator, inputBatches);
@@ -73,3 +73,81 @@ TEST_CASE("No valid elements during training") {
         "No elements were provided during training"
     );
 }
+
+TEST_CASE("Approximate - small inputs are exact") {
+    Test<true, int>({1, 2, 3, 4, 5}, 3, 0.01f);
+    Test<true, int>({1, 2, 3, 4}, 2.5, 0.01f);
+    Test<false, int>({1, 2, 3, 4}, 2, 0.01f);
+    Test<true, nonstd::optional<int>>({1, 2, nonstd::optional<int>(), 3, nonstd::optional<int>(), 4}, 2.5, 0.01f);
+    Test<false, std::string, std::string>({"1", "2", "3", "4"}, "2", 0.01f);
+    Test<false, nonstd::optional<std::string>, std::string>({"1", nonstd::optional<std::string>(), "2", "3", nonstd::optional<std::string>(), "4", "5"}, "3", 0.01f);
+
+    CHECK_THROWS_WITH(
+        (Test<true, nonstd::optional<int>>({nonstd::optional<int>(), nonstd::optional<int>()}, 0, 0.01f)),
+        "No elements were provided during training"
+    );
+}
+
+TEST_CASE("Approximate - large inputs") {
+    using MedianEstimator                   = NS::Featurizers::Components::MedianEstimator<std::int64_t, std::double_t>;
+
+    std::vector<std::int64_t>               values;
+
+    // 0, 1, 2, ..., 199999 in a scrambled order
+    for(std::int64_t i = 0; i < 200000; ++i)
+        values.emplace_back(i * 7919 % 200000);
+
+    MedianEstimator                         estimator(NS::CreateTestAnnotationMapsPtr(1), 0, true, 0.01f);
+
+    CHECK(estimator.is_approximate());
+
+    NS::TestHelpers::Train(estimator, std::vector<std::vector<std::int64_t>>{values});
+
+    CHECK(estimator.get_annotation_data().Median == Approx(100000.0).margin(0.01 * 200000));
+
+    CHECK_THROWS_WITH(MedianEstimator(NS::CreateTestAnnotationMapsPtr(1), 0, true, -0.1f), "maxRankError");
+    CHECK_THROWS_WITH(MedianEstimator(NS::CreateTestAnnotationMapsPtr(1), 0, true, 1.0f), "maxRankError");
+}
+
+TEST_CASE("Approximate - merge") {
+    using MedianEstimator                   = NS::Featurizers::Components::MedianEstimator<std::double_t>;
+
+    // Train on 4 partitions of the data and combine the results
+    std::vector<MedianEstimator>            estimators;
+
+    for(int partition = 0; partition < 4; ++partition) {
+        estimators.emplace_back(NS::CreateTestAnnotationMapsPtr(1), 0, true, 0.005f);
+
+        MedianEstimator &                   estimator(estimators.back());
+
+        estimator.begin_training();
+
+        // Each partition has a different range of values
+        for(int i = 0; i < 50000; ++i)
+            estimator.fit(static_cast<std::double_t>(partition * 50000 + i));
+    }
+
+    MedianEstimator &                       combined(estimators.front());
+
+    for(size_t index = 1; index < estimators.size(); ++index) {
+        // Serialize the state to simulate training on different machines
+        NS::Archive                         out;
+
+        estimators[index].get_sketch().save(out);
+
+        NS::Archive                         in(out.commit());
+
+        combined.merge(MedianEstimator::SketchType(in));
+    }
+
+    combined.complete_training();
+
+    CHECK(combined.get_annotation_data().Median == Approx(100000.0).margin(0.005 * 200000));
+
+    // Exact estimators can't be merged
+    MedianEstimator                         exact(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    CHECK(exact.is_approximate() == false);
+    CHECK_THROWS_WITH(exact.get_sketch(), "The exact median is being calculated");
+    CHECK_THROWS_WITH(exact.merge(MedianEstimator::SketchType()), "The exact median is being calculated");
+}
@@ -225,12 +225,11 @@ TEST_CASE("Annotation, Transformer") {
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
 
-    REQUIRE(iterAnnotations != annotations.end());
-    REQUIRE(iterAnnotations->second.size() == 1);
+    REQUIRE(estimatorAnnotations.size() == 1);
 
-    NS::Annotation const &                  annotation(*iterAnnotations->second[0]);
+    NS::Annotation const &                  annotation(*estimatorAnnotations[0]);
 
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(&annotation));
 
@@ -267,18 +266,17 @@ TEST_CASE("Annotation, Annotation, Annotation, Transformer") {
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iter(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
 
-    REQUIRE(iter != annotations.end());
 
     // There are 2 annotation instances. The first is configured to look at all the
     // training data while the second is only looking at the first 3 times. They
     // will get different results because of this.
-    REQUIRE(iter->second.size() == 3);
+    REQUIRE(estimatorAnnotations.size() == 3);
 
-    NS::Annotation const &                  annotation1(*iter->second[0]);
-    NS::Annotation const &                  annotation2(*iter->second[1]);
-    NS::Annotation const &                  annotation3(*iter->second[2]);
+    NS::Annotation const &                  annotation1(*estimatorAnnotations[0]);
+    NS::Annotation const &                  annotation2(*estimatorAnnotations[1]);
+    NS::Annotation const &                  annotation3(*estimatorAnnotations[2]);
 
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(&annotation1));
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(&annotation2));
@@ -336,12 +334,11 @@ TEST_CASE("Transformer, Annotation, Transformer") {
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
 
-    REQUIRE(iterAnnotations != annotations.end());
-    REQUIRE(iterAnnotations->second.size() == 1);
+    REQUIRE(estimatorAnnotations.size() == 1);
 
-    NS::Annotation const &                  annotation(*iterAnnotations->second[0]);
+    NS::Annotation const &                  annotation(*estimatorAnnotations[0]);
 
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(&annotation));
 
@@ -373,12 +370,11 @@ TEST_CASE("Transformer, Annotation") {
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
 
-    REQUIRE(iterAnnotations != annotations.end());
-    REQUIRE(iterAnnotations->second.size() == 1);
+    REQUIRE(estimatorAnnotations.size() == 1);
 
-    NS::Annotation const &                  annotation(*iterAnnotations->second[0]);
+    NS::Annotation const &                  annotation(*estimatorAnnotations[0]);
 
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(&annotation));
 
@@ -412,16 +408,15 @@ TEST_CASE("Annotation, Annotation, Transformer, Annotation") {
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
 
-    REQUIRE(iterAnnotations != annotations.end());
 
     // There are 3 annotation instances.
-    REQUIRE(iterAnnotations->second.size() == 3);
+    REQUIRE(estimatorAnnotations.size() == 3);
 
-    NS::Annotation const &                  annotation1(*iterAnnotations->second[0]);
-    NS::Annotation const &                  annotation2(*iterAnnotations->second[1]);
-    NS::Annotation const &                  annotation3(*iterAnnotations->second[2]);
+    NS::Annotation const &                  annotation1(*estimatorAnnotations[0]);
+    NS::Annotation const &                  annotation2(*estimatorAnnotations[1]);
+    NS::Annotation const &                  annotation3(*estimatorAnnotations[2]);
 
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<size_t>> const *>(&annotation1));
     REQUIRE(dynamic_cast<MyAnnotation<NonCopyable<size_t>> const *>(&annotation2));
@@ -528,17 +523,16 @@ TEST_CASE("Transformer with Training") {
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iter(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
 
-    REQUIRE(iter != annotations.end());
 
     // There are 2 annotation instances. The first is configured to look at all the
     // training data while the second is only looking at the first 3 times. They
     // will get different results because of this.
-    REQUIRE(iter->second.size() == 2);
+    REQUIRE(estimatorAnnotations.size() == 2);
 
-    NS::Annotation const &                  annotation1(*iter->second[0]);
-    NS::Annotation const &                  annotation2(*iter->second[1]);
+    NS::Annotation const &                  annotation1(*estimatorAnnotations[0]);
+    NS::Annotation const &                  annotation2(*estimatorAnnotations[1]);
 
     REQUIRE(dynamic_cast<MyAnnotation<int> const *>(&annotation1));
     REQUIRE(dynamic_cast<MyAnnotation<double> const *>(&annotation2));
@@ -563,6 +557,211 @@ TEST_CASE("Transformer with Training") {
 #endif
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  Pipelined Training Tests
+// |
+// ----------------------------------------------------------------------
+template <typename EstimatorT, typename InputT>
+size_t TrainAndCountPasses(EstimatorT &estimator, std::vector<InputT> const &items, size_t batchSize) {
+    size_t                                  numPasses(1);
+    size_t                                  offset(0);
+
+    estimator.begin_training();
+
+    while(estimator.get_state() == NS::TrainingState::Training) {
+        size_t const                        cItems(std::min(batchSize, items.size() - offset));
+
+        if(estimator.fit(items.data() + offset, cItems) == NS::FitResult::Reset) {
+            offset = 0;
+            ++numPasses;
+            continue;
+        }
+
+        offset += cItems;
+
+        if(offset == items.size()) {
+            estimator.on_data_completed();
+
+            if(estimator.get_state() == NS::TrainingState::Training)
+                ++numPasses;
+
+            offset = 0;
+        }
+    }
+
+    estimator.complete_training();
+    return numPasses;
+}
+
+TEST_CASE("Pipelined training") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        MyAnnotationEstimator<int, 0>,
+        MyAnnotationEstimator<int, 0, 1500>,
+        SimpleEstimator,
+        MyAnnotationEstimator<double, 0>
+    >;
+
+    std::vector<int>                        items;
+
+    for(int i = 0; i < 5000; ++i)
+        items.emplace_back((i * 7919) % 101);
+
+    auto const                              train(
+        [&items](Estimator estimator, NS::AnnotationMapsPtr const &pAllColumnAnnotations, size_t &numPasses) {
+            numPasses = TrainAndCountPasses(estimator, items, 1000);
+
+            NS::AnnotationMap const &       annotations((*pAllColumnAnnotations)[0]);
+
+            REQUIRE(annotations.size() == 1);
+
+            NS::AnnotationPtrs const        estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
+
+            REQUIRE(estimatorAnnotations.size() == 3);
+
+            std::vector<double>             results;
+
+            for(auto const &pAnnotation : estimatorAnnotations) {
+                if(dynamic_cast<MyAnnotation<int> const *>(pAnnotation.get()))
+                    results.emplace_back(static_cast<MyAnnotation<int> const &>(*pAnnotation).Value);
+                else
+                    results.emplace_back(static_cast<MyAnnotation<double> const &>(*pAnnotation).Value);
+            }
+
+            typename Estimator::TransformerUniquePtr    pTransformer(estimator.create_transformer());
+
+            pTransformer->execute(
+                10,
+                [&results](double value) {
+                    results.emplace_back(value);
+                }
+            );
+
+            return results;
+        }
+    );
+
+    NS::AnnotationMapsPtr const             pExpectedAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    size_t                                  expectedNumPasses(0);
+    std::vector<double> const               expected(train(Estimator("Estimator", pExpectedAnnotations), pExpectedAnnotations, expectedNumPasses));
+
+    CHECK(expectedNumPasses == 4);
+
+    for(size_t chunkSize : {1, 64, 5000}) {
+        for(size_t maxQueuedChunks : {1, 3}) {
+            NS::AnnotationMapsPtr const     pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+            size_t                          numPasses(0);
+
+            CHECK(
+                train(
+                    Estimator("Estimator", pAllColumnAnnotations, NS::Featurizers::Components::PipelinedTraining(chunkSize, maxQueuedChunks)),
+                    pAllColumnAnnotations,
+                    numPasses
+                ) == expected
+            );
+
+            // Passes are replayed internally
+            CHECK(numPasses == 1);
+        }
+    }
+
+    // The caller replays the data once more items than allowed would be retained
+    for(size_t maxReplayItems : {0, 2500}) {
+        NS::AnnotationMapsPtr const         pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+        size_t                              numPasses(0);
+
+        CHECK(
+            train(
+                Estimator("Estimator", pAllColumnAnnotations, NS::Featurizers::Components::PipelinedTraining(64, 3, maxReplayItems)),
+                pAllColumnAnnotations,
+                numPasses
+            ) == expected
+        );
+
+        CHECK(numPasses > 1);
+        CHECK(numPasses <= expectedNumPasses);
+    }
+}
+
+TEST_CASE("Pipelined training - not copyable") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        MyAnnotationEstimator<NonCopyable<std::string>, 0>,
+        MyAnnotationEstimator<NonCopyable<std::string>, 0, 4>,
+        MyAnnotationEstimator<NonCopyable<std::string>, 0>,
+        StringToIntEstimator
+    >;
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    // The caller replays the data, as the input can't be retained
+    CHECK(
+        NS::TestHelpers::TransformerEstimatorTest(
+            Estimator("Estimator", pAllColumnAnnotations, NS::Featurizers::Components::PipelinedTraining(2, 1)),
+            NS::TestHelpers::make_vector<std::vector<NonCopyable<std::string>>>(
+                NS::TestHelpers::make_vector<NonCopyable<std::string>>("three", "one", "two", "one", "three", "three", "three"),
+                NS::TestHelpers::make_vector<NonCopyable<std::string>>("two", "two")
+            ),
+            NS::TestHelpers::make_vector<NonCopyable<std::string>>("one", "two", "three")
+        ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(3, 3, 5)
+    );
+
+    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+
+    REQUIRE(annotations.size() == 1);
+
+    NS::AnnotationPtrs const                estimatorAnnotations(annotations.get_annotations("MyAnnotationEstimator"));
+
+    REQUIRE(estimatorAnnotations.size() == 3);
+
+    CHECK(static_cast<MyAnnotation<NonCopyable<std::string>> const &>(*estimatorAnnotations[0]).Value.Value == "three");
+    CHECK(static_cast<MyAnnotation<NonCopyable<std::string>> const &>(*estimatorAnnotations[1]).Value.Value == "one");
+    CHECK(static_cast<MyAnnotation<NonCopyable<std::string>> const &>(*estimatorAnnotations[2]).Value.Value == "three");
+}
+
+TEST_CASE("Pipelined training - bool") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        MyAnnotationEstimator<bool, 0>,
+        MyAnnotationEstimator<bool, 0>
+    >;
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator                               estimator("Estimator", pAllColumnAnnotations, NS::Featurizers::Components::PipelinedTraining(2, 1));
+    std::vector<bool> const                 items{true, false, true, true, false};
+
+    // The caller replays the data, as std::vector<bool> can't be used to retain the input
+    std::unique_ptr<bool []>                pItems(new bool[items.size()]);
+
+    std::copy(items.begin(), items.end(), pItems.get());
+
+    size_t                                  numPasses(0);
+
+    estimator.begin_training();
+
+    while(estimator.get_state() == NS::TrainingState::Training) {
+        ++numPasses;
+
+        if(estimator.fit(pItems.get(), items.size()) == NS::FitResult::Reset)
+            continue;
+
+        estimator.on_data_completed();
+    }
+
+    estimator.complete_training();
+
+    CHECK(numPasses == 2);
+
+    NS::AnnotationPtrs const                estimatorAnnotations((*pAllColumnAnnotations)[0].get_annotations("MyAnnotationEstimator"));
+
+    REQUIRE(estimatorAnnotations.size() == 2);
+    CHECK(static_cast<MyAnnotation<bool> const &>(*estimatorAnnotations[0]).Value == true);
+    CHECK(static_cast<MyAnnotation<bool> const &>(*estimatorAnnotations[1]).Value == true);
+}
+
+TEST_CASE("Pipelined training - errors") {
+    CHECK_THROWS_WITH(NS::Featurizers::Components::PipelinedTraining(0), "chunkSize");
+    CHECK_THROWS_WITH(NS::Featurizers::Components::PipelinedTraining(10, 0), "maxQueuedChunks");
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Custom Constructor Tests
@@ -728,3 +927,157 @@ TEST_CASE("Custom Constructor") {
     pTransformer->execute(4, callback);
     CHECK(result == 14);
 }
+
+// ----------------------------------------------------------------------
+// |
+// |  Fused Execution Tests
+// |
+// ----------------------------------------------------------------------
+TEST_CASE("Fused execution") {
+    static_assert(CustomEstimator::TransformerType::PipelineTraits::IsFused, "");
+    static_assert(
+        NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            MyAnnotationEstimator<NonCopyable<std::string>, 0>,
+            StringToIntEstimator
+        >::TransformerType::PipelineTraits::IsFused,
+        ""
+    );
+    static_assert(
+        NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            MyAnnotationEstimator<int, 0>,
+            SimpleEstimator
+        >::TransformerType::PipelineTraits::IsFused == false,
+        ""
+    );
+
+    using TransformerType                   = CustomEstimator::TransformerType;
+
+    // Each Transformer maintains state, so use a different instance for each
+    // execution method.
+    CustomEstimator::TransformerUniquePtr const         pChained(CustomEstimator(NS::CreateTestAnnotationMapsPtr(1), 10, 200).create_transformer());
+    CustomEstimator::TransformerUniquePtr const         pFused(CustomEstimator(NS::CreateTestAnnotationMapsPtr(1), 10, 200).create_transformer());
+    CustomEstimator::TransformerUniquePtr const         pBatched(CustomEstimator(NS::CreateTestAnnotationMapsPtr(1), 10, 200).create_transformer());
+
+    // Cross several batch blocks and end with a partial one
+    std::vector<int>                        inputs;
+
+    for(int i = 0; i < 1000; ++i)
+        inputs.emplace_back(i);
+
+    std::vector<int>                        expected;
+
+    for(int input : inputs)
+        pChained->execute(input, [&expected](int output) { expected.emplace_back(output); });
+
+    std::vector<int>                        fused;
+
+    for(int input : inputs)
+        fused.emplace_back(static_cast<TransformerType &>(*pFused).execute(input));
+
+    std::vector<int>                        batched(inputs.size());
+
+    static_cast<TransformerType &>(*pBatched).execute_batch(inputs.data(), inputs.size(), batched.data());
+
+    CHECK(expected.size() == inputs.size());
+    CHECK(fused == expected);
+    CHECK(batched == expected);
+
+    // Nothing is done when there aren't any inputs
+    static_cast<TransformerType &>(*pBatched).execute_batch(nullptr, 0, nullptr);
+
+    CHECK_THROWS_WITH(static_cast<TransformerType &>(*pBatched).execute_batch(nullptr, 1, batched.data()), "pInputs");
+    CHECK_THROWS_WITH(static_cast<TransformerType &>(*pBatched).execute_batch(inputs.data(), 1, nullptr), "pOutputs");
+}
+
+TEST_CASE("Fused execution - not copyable") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        MyAnnotationEstimator<NonCopyable<std::string>, 0>,
+        StringToIntEstimator,
+        IntToStringEstimator
+    >;
+
+    Estimator                               estimator("Estimator", NS::CreateTestAnnotationMapsPtr(1));
+
+    estimator.begin_training();
+    estimator.fit(make_noncopyable<std::string>("one"));
+    estimator.complete_training();
+
+    Estimator::TransformerUniquePtr const   pTransformer(estimator.create_transformer());
+    Estimator::TransformerType &            transformer(static_cast<Estimator::TransformerType &>(*pTransformer));
+
+    NonCopyable<std::string>                input("three");
+
+    CHECK(transformer.execute(input).Value == "5");
+}
+
+// Provides `transform`; `execute_impl` is counted so that the test can verify
+// that the fused paths don't use it.
+class DoublingTransformer : public NS::Featurizers::Components::InferenceOnlyTransformerImpl<int, int> {
+public:
+    static size_t                           NumExecuteCalls;
+
+    int transform(int const &input) const {
+        return input * 2;
+    }
+
+private:
+    void execute_impl(InputType const &input, CallbackFunction const &callback) override {
+        ++NumExecuteCalls;
+        callback(transform(input));
+    }
+
+    void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) override {
+        BaseType::execute_batch_transform(*this, pInputs, cInputs, pOutputs);
+    }
+};
+
+size_t DoublingTransformer::NumExecuteCalls = 0;
+
+class DoublingEstimator : public NS::Featurizers::Components::InferenceOnlyEstimatorImpl<DoublingTransformer> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    DoublingEstimator(NS::AnnotationMapsPtr pAllColumnAnnotations) :
+        NS::Featurizers::Components::InferenceOnlyEstimatorImpl<DoublingTransformer>("DoublingEstimator", std::move(pAllColumnAnnotations)) {
+    }
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(DoublingEstimator);
+};
+
+TEST_CASE("Fused execution - transform") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        DoublingEstimator,
+        MyAnnotationEstimator<int, 0>,
+        DoublingEstimator
+    >;
+
+    static_assert(NS::Featurizers::Components::Details::Impl::HasTransformMethod<DoublingTransformer>::value, "");
+    static_assert(NS::Featurizers::Components::Details::Impl::HasTransformMethod<StringToIntTransformer>::value == false, "");
+
+    Estimator                               estimator("Estimator", NS::CreateTestAnnotationMapsPtr(1));
+
+    estimator.begin_training();
+    estimator.fit(1);
+    estimator.complete_training();
+
+    Estimator::TransformerUniquePtr const   pTransformer(estimator.create_transformer());
+    Estimator::TransformerType &            transformer(static_cast<Estimator::TransformerType &>(*pTransformer));
+
+    DoublingTransformer::NumExecuteCalls = 0;
+
+    CHECK(transformer.execute(3) == 12);
+
+    std::vector<int>                        inputs;
+
+    for(int i = 0; i < 1000; ++i)
+        inputs.emplace_back(i);
+
+    std::vector<int>                        outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+
+    for(size_t i = 0; i < inputs.size(); ++i)
+        CHECK(outputs[i] == inputs[i] * 4);
+
+    CHECK(DoublingTransformer::NumExecuteCalls == 0);
+}
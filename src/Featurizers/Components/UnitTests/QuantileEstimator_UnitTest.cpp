@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../QuantileEstimator.h"
+#include "../../TestHelpers.h"
+
+namespace NS = Microsoft::Featurizer;
+
+template <typename InputT, typename TransformedT>
+NS::Featurizers::Components::QuantileSketch<TransformedT> Test(std::vector<InputT> inputs, std::float_t maxRankError=NS::Featurizers::Components::Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::DefaultMaxRankError) {
+    // ----------------------------------------------------------------------
+    using QuantileEstimator                 = NS::Featurizers::Components::QuantileEstimator<InputT, TransformedT>;
+    using QuantileAnnotationData            = NS::Featurizers::Components::QuantileAnnotationData<TransformedT>;
+    // ----------------------------------------------------------------------
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    QuantileEstimator                       estimator(pAllColumnAnnotations, 0, true, maxRankError);
+    std::vector<std::vector<InputT>>        inputBatches{std::move(inputs)};
+
+    NS::TestHelpers::Train(estimator, inputBatches);
+
+    QuantileAnnotationData const &          annotation(estimator.get_annotation_data());
+
+    return annotation.Sketch;
+}
+
+TEST_CASE("ints") {
+    auto const                              sketch(Test<int, int>({5, 1, 4, 2, 3}));
+
+    CHECK(sketch.count() == 5);
+    CHECK(sketch.quantile(0.5) == 3);
+    CHECK(sketch.interpolated_quantile(0.25) == 2.0);
+    CHECK(sketch.interpolated_quantile(0.75) == 4.0);
+}
+
+TEST_CASE("nullable floats") {
+    auto const                              sketch(
+        Test<nonstd::optional<float>, float>(
+            {1.0f, nonstd::optional<float>(), 2.0f, 3.0f, nonstd::optional<float>(), 4.0f}
+        )
+    );
+
+    CHECK(sketch.count() == 4);
+    CHECK(sketch.interpolated_quantile(0.5) == 2.5);
+}
+
+TEST_CASE("native nullable floats") {
+    auto const                              sketch(
+        Test<float, float>(
+            {1.0f, NS::Traits<float>::CreateNullValue(), 2.0f, 3.0f}
+        )
+    );
+
+    CHECK(sketch.count() == 3);
+    CHECK(sketch.interpolated_quantile(0.5) == 2.0);
+}
+
+TEST_CASE("Bounded memory") {
+    std::vector<std::int64_t>               inputs;
+
+    for(std::int64_t i = 0; i < 1000000; ++i)
+        inputs.emplace_back(i * 7919 % 1000000);
+
+    auto const                              sketch(Test<std::int64_t, std::int64_t>(std::move(inputs), 0.01f));
+
+    CHECK(sketch.count() == 1000000);
+    CHECK(sketch.size() < 1000);
+    CHECK(static_cast<double>(sketch.quantile(0.5)) == Approx(500000.0).margin(0.01 * 1000000.0));
+}
+
+TEST_CASE("No elements during training") {
+    NS::AnnotationMapsPtr const                         pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NS::Featurizers::Components::QuantileEstimator<int> estimator(pAllColumnAnnotations, 0);
+
+    estimator.begin_training();
+    CHECK_THROWS_WITH(estimator.complete_training(), "No elements were provided during training");
+
+    CHECK_THROWS_WITH(
+        (Test<nonstd::optional<int>, int>({nonstd::optional<int>(), nonstd::optional<int>()})),
+        "No elements were provided during training"
+    );
+}
+
+TEST_CASE("Errors") {
+    CHECK_THROWS_WITH(
+        (NS::Featurizers::Components::QuantileEstimator<int>(NS::CreateTestAnnotationMapsPtr(1), 0, true, 1.5f)),
+        "maxRankError"
+    );
+}
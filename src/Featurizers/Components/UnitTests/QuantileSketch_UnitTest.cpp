@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <random>
+
+#include "../QuantileSketch.h"
+
+namespace NS = Microsoft::Featurizer;
+
+template <typename T>
+using QuantileSketch                        = NS::Featurizers::Components::QuantileSketch<T>;
+
+// Returns the range of ranks that the value occupies in the sorted values
+template <typename T>
+std::pair<size_t, size_t> GetRanks(std::vector<T> const &sorted, T const &value) {
+    return std::make_pair(
+        static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin()),
+        static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin())
+    );
+}
+
+template <typename T>
+void CheckRankError(QuantileSketch<T> const &sketch, std::vector<T> sorted) {
+    std::sort(sorted.begin(), sorted.end());
+
+    REQUIRE(sketch.count() == sorted.size());
+
+    double const                            maxError(static_cast<double>(QuantileSketch<T>::GetMaxRankError(sketch.k())) * static_cast<double>(sorted.size()));
+
+    for(double rank : {0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0}) {
+        double const                        expectedRank(rank * static_cast<double>(sorted.size() - 1));
+        std::pair<size_t, size_t> const     ranks(GetRanks(sorted, sketch.quantile(rank)));
+
+        CHECK(static_cast<double>(ranks.first) <= expectedRank + maxError);
+        CHECK(static_cast<double>(ranks.second) >= expectedRank - maxError);
+    }
+
+    CHECK(sketch.min() == sorted.front());
+    CHECK(sketch.max() == sorted.back());
+}
+
+TEST_CASE("GetK") {
+    CHECK(QuantileSketch<int>::GetK(0.5f) == QuantileSketch<int>::MinK);
+    CHECK(QuantileSketch<int>::GetMaxRankError(QuantileSketch<int>::GetK(0.01f)) <= 0.01f);
+    CHECK(QuantileSketch<int>::GetMaxRankError(static_cast<std::uint16_t>(QuantileSketch<int>::GetK(0.01f) - 1)) > 0.01f);
+    CHECK(QuantileSketch<int>::GetMaxRankError(200) == Approx(0.0133).epsilon(0.01));
+
+    CHECK_THROWS_WITH(QuantileSketch<int>::GetK(0.0f), "maxRankError");
+    CHECK_THROWS_WITH(QuantileSketch<int>::GetK(1.0f), "maxRankError");
+    CHECK_THROWS_WITH(QuantileSketch<int>::GetK(0.00001f), "maxRankError");
+    CHECK_THROWS_WITH(QuantileSketch<int>::GetMaxRankError(7), "k");
+    CHECK_THROWS_WITH(QuantileSketch<int>(7), "k");
+}
+
+TEST_CASE("Exact for small inputs") {
+    QuantileSketch<int>                     sketch;
+
+    CHECK(sketch.empty());
+    CHECK_THROWS_WITH(sketch.quantile(0.5), "The sketch is empty");
+    CHECK_THROWS_WITH(sketch.min(), "The sketch is empty");
+
+    for(int value : {5, 1, 4, 2, 3, 6})
+        sketch.update(value);
+
+    CHECK(sketch.count() == 6);
+    CHECK(sketch.size() == 6);
+    CHECK(sketch.min() == 1);
+    CHECK(sketch.max() == 6);
+
+    CHECK(sketch.quantile(0.0) == 1);
+    CHECK(sketch.quantile(0.5) == 3);
+    CHECK(sketch.quantile(1.0) == 6);
+    CHECK(sketch.interpolated_quantile(0.5) == 3.5);
+    CHECK(sketch.interpolated_quantile(0.25) == 2.25);
+    CHECK(sketch.interpolated_quantile(1.0) == 6.0);
+
+    CHECK_THROWS_WITH(sketch.quantile(1.5), "rank");
+    CHECK_THROWS_WITH(sketch.quantile(-0.5), "rank");
+}
+
+TEST_CASE("Bounded memory") {
+    std::mt19937                            generator(42);
+    std::uniform_real_distribution<double>  distribution(-1000.0, 1000.0);
+
+    QuantileSketch<double>                  sketch(100);
+    std::vector<double>                     values;
+
+    values.reserve(1000000);
+
+    for(size_t i = 0; i < 1000000; ++i) {
+        values.emplace_back(distribution(generator));
+        sketch.update(values.back());
+    }
+
+    CHECK(sketch.size() < 400);
+    CheckRankError(sketch, values);
+}
+
+TEST_CASE("Sorted and duplicated values") {
+    QuantileSketch<std::int64_t>            sketch;
+    std::vector<std::int64_t>               values;
+
+    for(std::int64_t i = 0; i < 100000; ++i) {
+        values.emplace_back(i);
+        values.emplace_back(i % 10);
+    }
+
+    for(auto value : values)
+        sketch.update(value);
+
+    CheckRankError(sketch, values);
+}
+
+TEST_CASE("Strings") {
+    QuantileSketch<std::string>             sketch(16);
+    std::vector<std::string>                values;
+
+    for(int i = 0; i < 1000; ++i) {
+        values.emplace_back(std::to_string(i * 7919 % 1000));
+        sketch.update(values.back());
+    }
+
+    CheckRankError(sketch, values);
+    CHECK_THROWS_WITH(sketch.interpolated_quantile(0.5), "Interpolated quantiles are only available for arithmetic types");
+}
+
+TEST_CASE("Merge") {
+    std::mt19937                            generator(42);
+    std::normal_distribution<double>        distribution(10.0, 3.0);
+
+    std::vector<QuantileSketch<double>>     sketches(8);
+    std::vector<double>                     values;
+
+    for(size_t i = 0; i < 200000; ++i) {
+        values.emplace_back(distribution(generator));
+
+        // Sketches have very different sizes
+        sketches[i % 3 == 0 ? 0 : i % sketches.size()].update(values.back());
+    }
+
+    QuantileSketch<double>                  merged;
+
+    for(auto const &sketch : sketches)
+        merged.merge(sketch);
+
+    merged.merge(QuantileSketch<double>());
+
+    CHECK(merged.size() < 1000);
+    CheckRankError(merged, values);
+
+    // Merge into an empty sketch
+    QuantileSketch<double>                  other;
+
+    other.merge(sketches[1]);
+    CHECK(other == sketches[1]);
+
+    CHECK_THROWS_WITH(other.merge(QuantileSketch<double>(100)), "other");
+}
+
+TEST_CASE("Serialization") {
+    QuantileSketch<float>                   sketch(32);
+
+    for(int i = 0; i < 10000; ++i)
+        sketch.update(static_cast<float>(i % 1000) / 10.0f);
+
+    NS::Archive                             out;
+
+    sketch.save(out);
+
+    NS::Archive::ByteArray const            bytes(out.commit());
+    NS::Archive                             in(bytes);
+    QuantileSketch<float>                   other(in);
+
+    CHECK(in.AtEnd());
+    CHECK(other == sketch);
+    CHECK(other.quantile(0.5) == sketch.quantile(0.5));
+
+    // Training continues where it left off
+    other.update(5.0f);
+    sketch.update(5.0f);
+    CHECK(other == sketch);
+
+    // Empty
+    {
+        NS::Archive                         emptyOut;
+
+        QuantileSketch<float>().save(emptyOut);
+
+        NS::Archive                         emptyIn(emptyOut.commit());
+
+        CHECK(QuantileSketch<float>(emptyIn) == QuantileSketch<float>());
+    }
+
+    // Invalid data
+    {
+        NS::Archive                         invalidOut;
+
+        NS::Traits<std::uint16_t>::serialize(invalidOut, 1);
+        NS::Traits<std::uint16_t>::serialize(invalidOut, 0);
+        NS::Traits<std::uint16_t>::serialize(invalidOut, 200);
+        NS::Traits<std::uint64_t>::serialize(invalidOut, 3);
+        NS::Traits<std::uint32_t>::serialize(invalidOut, 1);
+        NS::Traits<float>::serialize(invalidOut, 1.0f);
+        NS::Traits<float>::serialize(invalidOut, 2.0f);
+        NS::Traits<std::vector<std::vector<float>>>::serialize(invalidOut, std::vector<std::vector<float>>{{1.0f, 2.0f}});
+
+        NS::Archive                         invalidIn(invalidOut.commit());
+
+        CHECK_THROWS_WITH(QuantileSketch<float>(invalidIn), "Invalid quantile sketch");
+    }
+    {
+        NS::Archive                         invalidOut;
+
+        NS::Traits<std::uint16_t>::serialize(invalidOut, 2);
+        NS::Traits<std::uint16_t>::serialize(invalidOut, 0);
+
+        NS::Archive                         invalidIn(invalidOut.commit());
+
+        CHECK_THROWS_WITH(QuantileSketch<float>(invalidIn), "Unsupported archive version");
+    }
+}
@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "../ScaleKernels.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace Components = NS::Featurizers::Components;
+
+namespace {
+
+std::vector<Components::SimdLevel> GetSupportedLevels(void) {
+    std::vector<Components::SimdLevel>      result;
+
+    for(auto level : { Components::SimdLevel::Scalar, Components::SimdLevel::Sse2, Components::SimdLevel::Avx2, Components::SimdLevel::Avx512 }) {
+        if(level <= Components::GetSimdLevel())
+            result.push_back(level);
+    }
+
+    return result;
+}
+
+template <typename T>
+bool IsSame(T a, T b) {
+    // Compare the bits so that NaNs (and the sign of zero) are compared correctly
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename InputT, typename TransformedT, typename ComputeT>
+void Test(ComputeT offset, ComputeT divisor) {
+    // Sizes that exercise the vectorized loops and the remaining items for each instruction set
+    for(size_t cItems : { 0, 1, 3, 7, 8, 15, 16, 17, 33, 1000, 1500 }) {
+        std::vector<InputT>                 inputs;
+
+        for(size_t i = 0; i < cItems; ++i)
+            inputs.push_back(static_cast<InputT>(static_cast<InputT>(i * 37 % 101) - static_cast<InputT>(std::is_signed<InputT>::value ? 50 : 0)));
+
+        std::vector<TransformedT>           expected;
+
+        for(auto const &input : inputs)
+            expected.push_back(static_cast<TransformedT>((static_cast<ComputeT>(static_cast<TransformedT>(input)) - offset) / divisor));
+
+        for(auto level : GetSupportedLevels()) {
+            std::vector<TransformedT>       outputs(cItems);
+
+            Components::ShiftAndScale(inputs.data(), inputs.size(), outputs.data(), offset, divisor, level);
+
+            for(size_t i = 0; i < cItems; ++i)
+                CHECK(IsSame(outputs[i], expected[i]));
+        }
+    }
+}
+
+template <typename InputT>
+void TestAllOutputs(void) {
+    Test<InputT, float, typename std::common_type<float, InputT>::type>(static_cast<typename std::common_type<float, InputT>::type>(3), static_cast<typename std::common_type<float, InputT>::type>(7));
+    Test<InputT, double, typename std::common_type<double, InputT>::type>(3.0, 7.0);
+    Test<InputT, float, double>(-2.5, 0.1);
+}
+
+} // anonymous namespace
+
+TEST_CASE("Levels") {
+    CHECK(Components::GetSimdLevel() == Components::GetSimdLevel());
+    CHECK(GetSupportedLevels().front() == Components::SimdLevel::Scalar);
+}
+
+TEST_CASE("Integer inputs") {
+    TestAllOutputs<std::int8_t>();
+    TestAllOutputs<std::int16_t>();
+    TestAllOutputs<std::int32_t>();
+    TestAllOutputs<std::int64_t>();
+    TestAllOutputs<std::uint8_t>();
+    TestAllOutputs<std::uint16_t>();
+    TestAllOutputs<std::uint32_t>();
+    TestAllOutputs<std::uint64_t>();
+}
+
+TEST_CASE("Floating point inputs") {
+    TestAllOutputs<float>();
+    TestAllOutputs<double>();
+}
+
+TEST_CASE("NaN propagation") {
+    for(auto level : GetSupportedLevels()) {
+        std::vector<float>                  floatInputs(37, 1.0f);
+        std::vector<double>                 doubleInputs(37, 1.0);
+
+        floatInputs[0] = floatInputs[17] = floatInputs[36] = std::numeric_limits<float>::quiet_NaN();
+        doubleInputs[0] = doubleInputs[17] = doubleInputs[36] = std::numeric_limits<double>::quiet_NaN();
+
+        std::vector<float>                  floatOutputs(floatInputs.size());
+        std::vector<double>                 doubleOutputs(doubleInputs.size());
+
+        Components::ShiftAndScale(floatInputs.data(), floatInputs.size(), floatOutputs.data(), 0.5f, 2.0f, level);
+        Components::ShiftAndScale(doubleInputs.data(), doubleInputs.size(), doubleOutputs.data(), 0.5, 2.0, level);
+
+        for(size_t i = 0; i < floatInputs.size(); ++i) {
+            bool const                      isNaN(i == 0 || i == 17 || i == 36);
+
+            CHECK(std::isnan(floatOutputs[i]) == isNaN);
+            CHECK(std::isnan(doubleOutputs[i]) == isNaN);
+
+            if(isNaN == false) {
+                CHECK(floatOutputs[i] == 0.25f);
+                CHECK(doubleOutputs[i] == 0.25);
+            }
+        }
+    }
+}
+
+TEST_CASE("In place") {
+    for(auto level : GetSupportedLevels()) {
+        std::vector<double>                 values{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0 };
+
+        Components::ShiftAndScale(values.data(), values.size(), values.data(), 1.0, 2.0, level);
+        CHECK(values == std::vector<double>{ 0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0 });
+    }
+}
+
+TEST_CASE("Benchmark", "[.][benchmark]") {
+    std::vector<double>                     inputs(1 << 22, 3.0);
+    std::vector<double>                     outputs(inputs.size());
+
+    for(auto level : GetSupportedLevels()) {
+        auto const                          start(std::chrono::steady_clock::now());
+
+        for(int i = 0; i < 20; ++i)
+            Components::ShiftAndScale(inputs.data(), inputs.size(), outputs.data(), 1.0, 2.0, level);
+
+        std::chrono::duration<double> const elapsed(std::chrono::steady_clock::now() - start);
+
+        std::cout << "Level " << static_cast<int>(level) << ": " << (static_cast<double>(inputs.size()) * 20 * sizeof(double) * 2) / elapsed.count() / 1e9 << " GB/s\n";
+        CHECK(outputs.back() == 1.0);
+    }
+}
@@ -0,0 +1,231 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <random>
+
+#include "../TimeSeriesBackwardFillBuffer.h"
+#include "../TimeSeriesImputerTypes.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using BufferType                            = NS::Featurizers::Components::TimeSeriesBackwardFillBuffer<NS::Featurizers::Components::NumericTimeSeriesTypes>;
+using RowType                               = BufferType::RowType;
+using ColsType                              = BufferType::ColsToImputeType;
+
+std::vector<RowType> Process(std::vector<RowType> const &rows, size_t maxInMemoryRows, size_t *pMaxBufferedRows=nullptr) {
+    BufferType                              buffer(std::get<2>(rows.front()).size(), maxInMemoryRows);
+    std::vector<RowType>                    results;
+    auto const                              callback(
+        [&results](RowType row) {
+            results.emplace_back(std::move(row));
+        }
+    );
+
+    size_t                                  maxInMemorySize(0);
+
+    for(auto const &row : rows) {
+        buffer.push(row, callback);
+
+        maxInMemorySize = std::max(maxInMemorySize, buffer.in_memory_size());
+
+        if(pMaxBufferedRows)
+            *pMaxBufferedRows = std::max(*pMaxBufferedRows, buffer.size());
+    }
+
+    if(maxInMemoryRows != 0)
+        CHECK(maxInMemorySize <= maxInMemoryRows);
+
+    buffer.flush(callback);
+    CHECK(buffer.empty());
+
+    return results;
+}
+
+std::vector<RowType> Reference(std::vector<RowType> rows) {
+    // Fill every null value with the next non-null value of the column
+    for(size_t col = 0; col < std::get<2>(rows.front()).size(); ++col) {
+        std::double_t                       next(NS::Traits<std::double_t>::CreateNullValue());
+
+        for(auto it = rows.rbegin(); it != rows.rend(); ++it) {
+            std::double_t &                 value(std::get<2>(*it)[col]);
+
+            if(NS::Traits<std::double_t>::IsNull(value))
+                value = next;
+            else
+                next = value;
+        }
+    }
+
+    return rows;
+}
+
+bool AreEqual(std::vector<RowType> const &a, std::vector<RowType> const &b) {
+    if(a.size() != b.size())
+        return false;
+
+    for(size_t i = 0; i < a.size(); ++i) {
+        if(std::get<0>(a[i]) != std::get<0>(b[i]) || std::get<1>(a[i]) != std::get<1>(b[i]))
+            return false;
+
+        ColsType const &                    aValues(std::get<2>(a[i]));
+        ColsType const &                    bValues(std::get<2>(b[i]));
+
+        for(size_t col = 0; col < aValues.size(); ++col) {
+            bool const                      aIsNull(NS::Traits<std::double_t>::IsNull(aValues[col]));
+
+            if(aIsNull != NS::Traits<std::double_t>::IsNull(bValues[col]) || (aIsNull == false && aValues[col] != bValues[col]))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+TEST_CASE("Rows are emitted when filled") {
+    std::double_t const                     null(NS::Traits<std::double_t>::CreateNullValue());
+    std::chrono::system_clock::time_point   now(std::chrono::system_clock::now());
+    BufferType                              buffer(2);
+    std::vector<RowType>                    results;
+    auto const                              callback(
+        [&results](RowType row) {
+            results.emplace_back(std::move(row));
+        }
+    );
+
+    buffer.push(std::make_tuple(false, now, ColsType{1.0, 2.0}), callback);
+    CHECK(results.size() == 1);
+
+    buffer.push(std::make_tuple(false, now + std::chrono::hours(1), ColsType{null, 3.0}), callback);
+    buffer.push(std::make_tuple(true, now + std::chrono::hours(2), ColsType{null, null}), callback);
+    CHECK(results.size() == 1);
+    CHECK(buffer.size() == 2);
+
+    // The second column is still pending for the last row
+    buffer.push(std::make_tuple(false, now + std::chrono::hours(3), ColsType{4.0, null}), callback);
+    CHECK(results.size() == 2);
+    CHECK(std::get<2>(results[1]) == ColsType{4.0, 3.0});
+    CHECK(buffer.size() == 2);
+
+    buffer.flush(callback);
+    REQUIRE(results.size() == 4);
+    CHECK(std::get<0>(results[2]));
+    CHECK(std::get<1>(results[2]) == now + std::chrono::hours(2));
+    CHECK(std::get<2>(results[2])[0] == 4.0);
+    CHECK(NS::Traits<std::double_t>::IsNull(std::get<2>(results[2])[1]));
+    CHECK(NS::Traits<std::double_t>::IsNull(std::get<2>(results[3])[1]));
+    CHECK(buffer.empty());
+}
+
+TEST_CASE("Random data, with and without spilling") {
+    std::mt19937                            generator(42);
+    std::bernoulli_distribution             isNull(0.7);
+    std::chrono::system_clock::time_point   now(std::chrono::system_clock::now());
+    std::vector<RowType>                    rows;
+
+    for(int i = 0; i < 2000; ++i) {
+        ColsType                            values(3, 0.0);
+
+        for(int col = 0; col < 3; ++col)
+            values[static_cast<size_t>(col)] = isNull(generator) ? NS::Traits<std::double_t>::CreateNullValue() : static_cast<std::double_t>(i * 10 + col);
+
+        rows.emplace_back(i % 5 == 0, now + std::chrono::nanoseconds(i), std::move(values));
+    }
+
+    std::vector<RowType> const              expected(Reference(rows));
+    size_t                                  maxBufferedRows(0);
+
+    CHECK(AreEqual(Process(rows, 0, &maxBufferedRows), expected));
+    CHECK(maxBufferedRows < 100);
+
+    CHECK(AreEqual(Process(rows, 1), expected));
+    CHECK(AreEqual(Process(rows, 7), expected));
+}
+
+TEST_CASE("Shared spill file") {
+    std::mt19937                            generator(42);
+    std::bernoulli_distribution             isNull(0.7);
+    std::chrono::system_clock::time_point   now(std::chrono::system_clock::now());
+    std::vector<std::vector<RowType>>       rows(3);
+
+    for(int i = 0; i < 1000; ++i) {
+        for(auto &grainRows : rows) {
+            ColsType                        values(2, 0.0);
+
+            for(int col = 0; col < 2; ++col)
+                values[static_cast<size_t>(col)] = isNull(generator) ? NS::Traits<std::double_t>::CreateNullValue() : static_cast<std::double_t>(i * 10 + col);
+
+            grainRows.emplace_back(false, now + std::chrono::nanoseconds(i), std::move(values));
+        }
+    }
+
+    // Rows of every grain are spilled to the same file, in interleaved order
+    NS::Featurizers::Components::TimeSeriesSpillFilePtr const  pSpillFile(std::make_shared<NS::Featurizers::Components::TimeSeriesSpillFile>());
+    std::vector<BufferType>                 buffers;
+    std::vector<std::vector<RowType>>       results(rows.size());
+
+    for(size_t grain = 0; grain < rows.size(); ++grain)
+        buffers.emplace_back(2, 1, pSpillFile);
+
+    for(size_t i = 0; i < rows.front().size(); ++i) {
+        for(size_t grain = 0; grain < rows.size(); ++grain) {
+            std::vector<RowType> &          grainResults(results[grain]);
+
+            buffers[grain].push(
+                rows[grain][i],
+                [&grainResults](RowType row) {
+                    grainResults.emplace_back(std::move(row));
+                }
+            );
+        }
+
+        // The limit is a runtime setting
+        if(i == rows.front().size() / 2)
+            buffers.back().set_max_in_memory_rows(0);
+    }
+
+    for(size_t grain = 0; grain < rows.size(); ++grain) {
+        std::vector<RowType> &              grainResults(results[grain]);
+
+        buffers[grain].flush(
+            [&grainResults](RowType row) {
+                grainResults.emplace_back(std::move(row));
+            }
+        );
+
+        CHECK(AreEqual(grainResults, Reference(rows[grain])));
+    }
+
+    CHECK(pSpillFile->size() == 0);
+}
+
+TEST_CASE("Long gap") {
+    std::chrono::system_clock::time_point   now(std::chrono::system_clock::now());
+    std::vector<RowType>                    rows;
+
+    rows.emplace_back(false, now, ColsType{1.0});
+
+    for(int i = 1; i < 10000; ++i)
+        rows.emplace_back(true, now + std::chrono::hours(i), ColsType{NS::Traits<std::double_t>::CreateNullValue()});
+
+    rows.emplace_back(false, now + std::chrono::hours(10000), ColsType{2.0});
+
+    std::vector<RowType> const              results(Process(rows, 10));
+
+    REQUIRE(results.size() == rows.size());
+    CHECK(AreEqual(results, Reference(rows)));
+}
+
+TEST_CASE("Errors") {
+    CHECK_THROWS_WITH(BufferType(0), "numCols");
+
+    BufferType                              buffer(2);
+
+    CHECK_THROWS_WITH(
+        buffer.push(std::make_tuple(false, std::chrono::system_clock::now(), ColsType{1.0}), [](RowType) {}),
+        "Input data does not match the number of columns to impute."
+    );
+}
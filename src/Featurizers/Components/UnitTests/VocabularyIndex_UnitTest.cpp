@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <memory>
+#include <thread>
+
+#include "../VocabularyIndex.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using VocabularyIndex                       = NS::Featurizers::Components::VocabularyIndex;
+using TermCounts                            = NS::Featurizers::Components::TermCounts;
+
+TEST_CASE("VocabularyIndex") {
+    VocabularyIndex const                   index(VocabularyIndex::IndexMap({{"orange", 3}, {"apple", 0}, {"peach", 7}, {"", 1}, {"grape", 2}}));
+
+    CHECK(index.size() == 5);
+
+    // Ids are ordered by value
+    CHECK(index.term(0) == "apple");
+    CHECK(index.term(1) == "");
+    CHECK(index.term(2) == "grape");
+    CHECK(index.term(3) == "orange");
+    CHECK(index.term(4) == "peach");
+
+    for(std::uint32_t id = 0; id < index.size(); ++id) {
+        std::string const                   term(index.term(id));
+
+        CHECK(index.find(term.begin(), term.end()) == id);
+    }
+
+    CHECK(index.value(0) == 0);
+    CHECK(index.value(4) == 7);
+
+    std::string const                       document("pineapple grapes peach");
+
+    CHECK(index.find(document.begin(), document.begin() + 9) == NS::Featurizers::Components::InvalidVocabularyId);
+    CHECK(index.find(document.begin() + 4, document.begin() + 9) == 0);
+    CHECK(index.find(document.begin() + 10, document.begin() + 15) == 2);
+    CHECK(index.find(document.begin() + 10, document.begin() + 16) == NS::Featurizers::Components::InvalidVocabularyId);
+    CHECK(index.find(document.begin() + 17, document.end()) == 4);
+}
+
+TEST_CASE("VocabularyIndex - many terms") {
+    VocabularyIndex::IndexMap               vocabulary;
+
+    for(std::uint32_t i = 0; i < 10000; ++i)
+        vocabulary.emplace("term" + std::to_string(i), i * 2);
+
+    VocabularyIndex const                   index(vocabulary);
+
+    CHECK(index.size() == vocabulary.size());
+
+    for(auto const &kvp : vocabulary) {
+        std::uint32_t const                 id(index.find(kvp.first.begin(), kvp.first.end()));
+
+        REQUIRE(id != NS::Featurizers::Components::InvalidVocabularyId);
+        CHECK(index.value(id) == kvp.second);
+        CHECK(id == kvp.second / 2);
+    }
+
+    std::string const                       missing("term10000");
+
+    CHECK(index.find(missing.begin(), missing.end()) == NS::Featurizers::Components::InvalidVocabularyId);
+}
+
+TEST_CASE("VocabularyIndex - empty") {
+    VocabularyIndex const                   index((VocabularyIndex::IndexMap()));
+    std::string const                       term("term");
+
+    CHECK(index.size() == 0);
+    CHECK(index.find(term.begin(), term.end()) == NS::Featurizers::Components::InvalidVocabularyId);
+    CHECK(index.find(term.begin(), term.begin()) == NS::Featurizers::Components::InvalidVocabularyId);
+}
+
+TEST_CASE("VocabularyIndex - to_map") {
+    VocabularyIndex::IndexMap const         vocabulary({{"orange", 3}, {"apple", 0}, {"peach", 7}, {"", 1}, {"grape", 2}});
+
+    CHECK(VocabularyIndex(vocabulary).to_map() == vocabulary);
+}
+
+TEST_CASE("VocabularyIndex - serialization") {
+    VocabularyIndex::IndexMap               vocabulary;
+
+    for(std::uint32_t i = 0; i < 1000; ++i)
+        vocabulary.emplace("term" + std::to_string(i), i);
+
+    VocabularyIndex const                   original(vocabulary);
+    NS::Archive                             out;
+
+    original.save(out);
+
+    std::shared_ptr<NS::Archive::ByteArray const> const     pBytes(std::make_shared<NS::Archive::ByteArray>(out.commit()));
+
+    auto const                              verify(
+        [&vocabulary, &original](NS::Archive &in, VocabularyIndex const &other) {
+            CHECK(in.AtEnd());
+            CHECK(other == original);
+
+            for(auto const &kvp : vocabulary)
+                CHECK(other.find(kvp.first.begin(), kvp.first.end()) == original.find(kvp.first.begin(), kvp.first.end()));
+        }
+    );
+
+    SECTION("Copied") {
+        NS::Archive                         in(*pBytes);
+        VocabularyIndex const               other(in);
+
+        verify(in, other);
+    }
+
+    SECTION("In place") {
+        NS::Archive                         in(pBytes, pBytes->data(), pBytes->size());
+        VocabularyIndex const               other(in);
+
+        // The index references (and keeps alive) the buffer
+        CHECK(pBytes.use_count() > 2);
+
+        verify(in, other);
+    }
+}
+
+TEST_CASE("VocabularyIndex - invalid data") {
+    // ----------------------------------------------------------------------
+    using Ids                               = std::vector<std::uint32_t>;
+    // ----------------------------------------------------------------------
+
+    std::string const                       chars("ab");
+
+    auto const                              createArchiveBytes(
+        [&chars](Ids const &offsets, Ids const &slots) {
+            NS::Archive                     ar;
+            Ids const                       values{0, 1};
+            Ids const                       displacements{0};
+
+            ar.serialize_array(chars.data(), chars.size());
+            ar.serialize_array(offsets.data(), offsets.size());
+            ar.serialize_array(values.data(), values.size());
+            NS::Traits<std::uint64_t>::serialize(ar, 0);
+            ar.serialize_array(displacements.data(), displacements.size());
+            ar.serialize_array(slots.data(), slots.size());
+
+            return std::make_shared<NS::Archive::ByteArray>(ar.commit());
+        }
+    );
+
+    auto const                              check(
+        [&createArchiveBytes](Ids const &offsets, Ids const &slots, bool isDetectedInPlace) {
+            std::shared_ptr<NS::Archive::ByteArray const> const     pBytes(createArchiveBytes(offsets, slots));
+
+            {
+                NS::Archive                 ar(*pBytes);
+
+                CHECK_THROWS_WITH(VocabularyIndex(ar), "Invalid vocabulary index");
+            }
+
+            if(isDetectedInPlace) {
+                NS::Archive                 ar(pBytes, pBytes->data(), pBytes->size());
+
+                CHECK_THROWS_WITH(VocabularyIndex(ar), "Invalid vocabulary index");
+            }
+        }
+    );
+
+    check({0, 1}, {0, 1}, true);
+    check({0, 2, 1}, {0, 1}, true);
+    check({0, 1, 2}, {0, 2}, true);
+
+    // Hashes aren't verified when the data is used in place; an invalid slot
+    // results in a term not being found rather than an invalid read.
+    check({0, 1, 2}, {0, 0}, false);
+}
+
+TEST_CASE("TermCounts") {
+    TermCounts                              counts(10);
+
+    for(std::uint32_t id : {7, 2, 7, 9, 2, 7})
+        counts.increment(id);
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>>    results;
+    auto const                              func(
+        [&results](std::uint32_t id, std::uint32_t count) {
+            results.emplace_back(id, count);
+        }
+    );
+
+    counts.flush(func);
+    CHECK(results == std::vector<std::pair<std::uint32_t, std::uint32_t>>{{2, 2}, {7, 3}, {9, 1}});
+
+    // The counts are reset by flush
+    results.clear();
+    counts.increment(9);
+    counts.flush(func);
+    CHECK(results == std::vector<std::pair<std::uint32_t, std::uint32_t>>{{9, 1}});
+
+    // ...even when func throws
+    counts.increment(1);
+    CHECK_THROWS_AS(counts.flush([](std::uint32_t, std::uint32_t) { throw std::runtime_error("error"); }), std::runtime_error);
+
+    results.clear();
+    counts.increment(1);
+    counts.flush(func);
+    CHECK(results == std::vector<std::pair<std::uint32_t, std::uint32_t>>{{1, 1}});
+}
+
+TEST_CASE("TermCounts - GetThreadLocal") {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>>    results;
+    auto const                              func(
+        [&results](std::uint32_t id, std::uint32_t count) {
+            results.emplace_back(id, count);
+        }
+    );
+
+    TermCounts &                            counts(TermCounts::GetThreadLocal(3));
+
+    // Ids that were counted but not flushed are discarded
+    counts.increment(2);
+    CHECK(&TermCounts::GetThreadLocal(20) == &counts);
+
+    counts.increment(19);
+    counts.increment(0);
+    counts.increment(19);
+    counts.flush(func);
+    CHECK(results == std::vector<std::pair<std::uint32_t, std::uint32_t>>{{0, 1}, {19, 2}});
+
+    // Each thread has its own instance
+    TermCounts *                            pOtherCounts(nullptr);
+
+    std::thread([&pOtherCounts](void) { pOtherCounts = &TermCounts::GetThreadLocal(3); }).join();
+    CHECK(pOtherCounts != &counts);
+}
@@ -0,0 +1,653 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Featurizer.h"
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/// Returned by `VocabularyIndex::find` when a term isn't in the vocabulary
+static constexpr std::uint32_t const        InvalidVocabularyId = std::numeric_limits<std::uint32_t>::max();
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         VocabularyIndex
+///  \brief         Compact, immutable index of the terms in a vocabulary that
+///                 can be queried with a character range, so that terms found
+///                 within a document can be looked up without creating a
+///                 `std::string`.
+///
+///                 Terms are stored in a single string pool and located with a
+///                 minimal perfect hash (hash and displace), so the index uses
+///                 roughly 13 bytes per term in addition to the characters
+///                 themselves; this is a fraction of the memory used by a
+///                 `std::unordered_map<std::string, std::uint32_t>`. The
+///                 structure is serialized as-is, so it isn't rebuilt when
+///                 a transformer is loaded; when loaded from a memory-mapped
+///                 `Archive`, the structure is used in place rather than
+///                 copied (see `Archive::deserialize_array`).
+///
+///                 Each term is assigned an id in [0, size()); ids are ordered
+///                 by the term's value, so sorting ids also sorts values.
+///
+class VocabularyIndex {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using IndexMap                          = std::unordered_map<std::string, std::uint32_t>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    VocabularyIndex(IndexMap const &vocabulary);
+    VocabularyIndex(Archive &ar);
+
+    ~VocabularyIndex(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(VocabularyIndex);
+
+    bool operator==(VocabularyIndex const &other) const;
+
+    void save(Archive &ar) const;
+
+    size_t size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns the id of the term or `InvalidVocabularyId` if
+    ///                 the term isn't in the vocabulary.
+    ///
+    std::uint32_t find(char const *pTerm, size_t cTerm) const;
+    std::uint32_t find(std::string::const_iterator begin, std::string::const_iterator end) const;
+
+    std::uint32_t value(std::uint32_t id) const;
+    std::string term(std::uint32_t id) const;
+
+    IndexMap to_map(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using Ids                               = ArchiveArray<std::uint32_t>;
+
+    struct Data {
+        ArchiveArray<char>                  Chars;
+        Ids                                 Offsets;            // size() + 1 items
+        Ids                                 Values;
+        std::uint64_t                       Seed;
+        Ids                                 Displacements;      // One item per bucket
+        Ids                                 Slots;              // Slot -> id
+
+        Data(void);
+        Data(ArchiveArray<char> chars, Ids offsets, Ids values, std::uint64_t seed, Ids displacements, Ids slots);
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // Displacements with this bit set contain the slot directly
+    static constexpr std::uint32_t const    DirectSlotFlag = 0x80000000u;
+
+    Data                                    _data;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    VocabularyIndex(Data data);
+
+    static Data Create(IndexMap const &vocabulary);
+    static bool CreateSlots(Data &data, std::vector<std::uint64_t> const &hashes);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Validate
+    ///  \brief         Ensures that the data can be used without reading
+    ///                 out of bounds. When `verifyHashes` is true, also ensures
+    ///                 that every term is found in the slot that its hash
+    ///                 references; this requires reading every term, so it is
+    ///                 skipped for data used in place.
+    ///
+    static Data Validate(Data data, bool verifyHashes);
+
+    static std::uint64_t Hash(char const *pTerm, size_t cTerm);
+    static std::uint64_t Mix(std::uint64_t value);
+    static std::uint32_t Reduce(std::uint64_t value, size_t range);
+
+    static size_t GetBucket(std::uint64_t hash, std::uint64_t seed, size_t numBuckets);
+    static size_t GetSlot(std::uint64_t hash, std::uint64_t seed, std::uint32_t displacement, size_t numSlots);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TermCounts
+///  \brief         Reusable scratch storage used to count the `VocabularyIndex`
+///                 ids found within a document. Storage is allocated once,
+///                 so counting doesn't allocate.
+///
+///                 Transformers use the instance returned by `GetThreadLocal`
+///                 rather than a member so that a single transformer can be
+///                 executed on multiple threads at the same time.
+///
+class TermCounts {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TermCounts(size_t numIds);
+    ~TermCounts(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TermCounts);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetThreadLocal
+    ///  \brief         Returns the calling thread's instance, able to count ids
+    ///                 in the range [0, numIds).
+    ///
+    static TermCounts & GetThreadLocal(size_t numIds);
+
+    void increment(std::uint32_t id);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            flush
+    ///  \brief         Invokes `func(id, count)` for each counted id in increasing
+    ///                 id order and resets the counts.
+    ///
+    template <typename FuncT>
+    void flush(FuncT const &func);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<std::uint32_t>              _counts;
+    std::vector<std::uint32_t>              _ids;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void reset(void);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  VocabularyIndex
+// |
+// ----------------------------------------------------------------------
+inline VocabularyIndex::VocabularyIndex(IndexMap const &vocabulary) :
+    VocabularyIndex(Create(vocabulary)) {
+}
+
+inline VocabularyIndex::VocabularyIndex(Archive &ar) :
+    VocabularyIndex(
+        [&ar](void) {
+            ArchiveArray<char>              chars(ar.deserialize_array<char>());
+            Ids                             offsets(ar.deserialize_array<std::uint32_t>());
+            Ids                             values(ar.deserialize_array<std::uint32_t>());
+            std::uint64_t                   seed(Traits<std::uint64_t>::deserialize(ar));
+            Ids                             displacements(ar.deserialize_array<std::uint32_t>());
+            Ids                             slots(ar.deserialize_array<std::uint32_t>());
+            bool const                      verifyHashes(chars.is_in_place() == false);
+
+            return Validate(Data(std::move(chars), std::move(offsets), std::move(values), std::move(seed), std::move(displacements), std::move(slots)), verifyHashes);
+        }()
+    ) {
+}
+
+inline VocabularyIndex::VocabularyIndex(Data data) :
+    _data(std::move(data)) {
+}
+
+inline bool VocabularyIndex::operator==(VocabularyIndex const &other) const {
+    // The hash structure is derived from the terms and values, so there is no
+    // need to compare it.
+    return _data.Chars == other._data.Chars
+        && _data.Offsets == other._data.Offsets
+        && _data.Values == other._data.Values;
+}
+
+inline void VocabularyIndex::save(Archive &ar) const {
+    ar.serialize_array(_data.Chars.data(), _data.Chars.size());
+    ar.serialize_array(_data.Offsets.data(), _data.Offsets.size());
+    ar.serialize_array(_data.Values.data(), _data.Values.size());
+    Traits<decltype(_data.Seed)>::serialize(ar, _data.Seed);
+    ar.serialize_array(_data.Displacements.data(), _data.Displacements.size());
+    ar.serialize_array(_data.Slots.data(), _data.Slots.size());
+}
+
+inline size_t VocabularyIndex::size(void) const {
+    return _data.Values.size();
+}
+
+inline std::uint32_t VocabularyIndex::find(char const *pTerm, size_t cTerm) const {
+    if(_data.Slots.empty())
+        return InvalidVocabularyId;
+
+    std::uint64_t const                     hash(Hash(pTerm, cTerm));
+    std::uint32_t const                     displacement(_data.Displacements[GetBucket(hash, _data.Seed, _data.Displacements.size())]);
+    std::uint32_t const                     id(_data.Slots[GetSlot(hash, _data.Seed, displacement, _data.Slots.size())]);
+
+    // Terms that aren't in the vocabulary map to an arbitrary slot, so the term
+    // must be compared.
+    std::uint32_t const                     offset(_data.Offsets[id]);
+
+    if(_data.Offsets[id + 1] - offset != cTerm || std::equal(pTerm, pTerm + cTerm, _data.Chars.data() + offset) == false)
+        return InvalidVocabularyId;
+
+    return id;
+}
+
+inline std::uint32_t VocabularyIndex::find(std::string::const_iterator begin, std::string::const_iterator end) const {
+    if(begin == end)
+        return find(nullptr, 0);
+
+    return find(&*begin, static_cast<size_t>(end - begin));
+}
+
+inline std::uint32_t VocabularyIndex::value(std::uint32_t id) const {
+    return _data.Values[id];
+}
+
+inline std::string VocabularyIndex::term(std::uint32_t id) const {
+    return std::string(_data.Chars.data() + _data.Offsets[id], _data.Offsets[id + 1] - _data.Offsets[id]);
+}
+
+inline VocabularyIndex::IndexMap VocabularyIndex::to_map(void) const {
+    IndexMap                                result;
+
+    result.reserve(size());
+
+    for(std::uint32_t id = 0; id < size(); ++id)
+        result.emplace(term(id), value(id));
+
+    return result;
+}
+
+inline VocabularyIndex::Data::Data(void) :
+    Seed(0) {
+}
+
+inline VocabularyIndex::Data::Data(ArchiveArray<char> chars, Ids offsets, Ids values, std::uint64_t seed, Ids displacements, Ids slots) :
+    Chars(std::move(chars)),
+    Offsets(std::move(offsets)),
+    Values(std::move(values)),
+    Seed(std::move(seed)),
+    Displacements(std::move(displacements)),
+    Slots(std::move(slots)) {
+}
+
+// static
+inline VocabularyIndex::Data VocabularyIndex::Create(IndexMap const &vocabulary) {
+    if(vocabulary.size() >= DirectSlotFlag)
+        throw std::invalid_argument("vocabulary");
+
+    // Order the terms by value (and then by term, so that the order is deterministic)
+    std::vector<IndexMap::value_type const *>           items;
+
+    items.reserve(vocabulary.size());
+
+    for(auto const &kvp : vocabulary)
+        items.emplace_back(&kvp);
+
+    std::sort(
+        items.begin(),
+        items.end(),
+        [](IndexMap::value_type const *pA, IndexMap::value_type const *pB) {
+            if(pA->second != pB->second)
+                return pA->second < pB->second;
+
+            return pA->first < pB->first;
+        }
+    );
+
+    size_t                                  numChars(0);
+
+    for(auto const *pItem : items)
+        numChars += pItem->first.size();
+
+    if(numChars > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("vocabulary");
+
+    std::vector<char>                       chars;
+    std::vector<std::uint32_t>              offsets;
+    std::vector<std::uint32_t>              values;
+    std::vector<std::uint64_t>              hashes;
+
+    chars.reserve(numChars);
+    offsets.reserve(items.size() + 1);
+    values.reserve(items.size());
+    hashes.reserve(items.size());
+
+    for(auto const *pItem : items) {
+        offsets.emplace_back(static_cast<std::uint32_t>(chars.size()));
+        chars.insert(chars.end(), pItem->first.begin(), pItem->first.end());
+        values.emplace_back(pItem->second);
+
+        hashes.emplace_back(Hash(pItem->first.data(), pItem->first.size()));
+    }
+
+    offsets.emplace_back(static_cast<std::uint32_t>(chars.size()));
+
+    Data                                    result;
+
+    result.Chars = ArchiveArray<char>(std::move(chars));
+    result.Offsets = Ids(std::move(offsets));
+    result.Values = Ids(std::move(values));
+
+    if(items.empty() == false) {
+        // The structure can almost always be created with the first seed; a new
+        // seed is only needed in the (very unlikely) case where the hashes of
+        // the terms in a bucket can't be placed.
+        static constexpr std::uint64_t const    MaxSeeds = 32;
+
+        while(CreateSlots(result, hashes) == false) {
+            if(++result.Seed == MaxSeeds)
+                throw std::runtime_error("The vocabulary index could not be created");
+        }
+    }
+
+    return result;
+}
+
+// static
+inline bool VocabularyIndex::CreateSlots(Data &data, std::vector<std::uint64_t> const &hashes) {
+    // ----------------------------------------------------------------------
+    using Ids                               = std::vector<std::uint32_t>;
+    // ----------------------------------------------------------------------
+
+    // An average of 4 terms per bucket keeps the displacements small while
+    // ensuring that the structure can be created quickly.
+    static constexpr size_t const           AverageBucketSize = 4;
+    static constexpr std::uint32_t const    MaxDisplacement = 1 << 20;
+
+    size_t const                            numIds(hashes.size());
+    size_t const                            numBuckets((numIds + AverageBucketSize - 1) / AverageBucketSize);
+
+    // Group the ids by bucket (counting sort)
+    Ids                                     bucketOffsets(numBuckets + 1, 0);
+    Ids                                     bucketIds(numIds);
+
+    for(size_t id = 0; id < numIds; ++id)
+        ++bucketOffsets[GetBucket(hashes[id], data.Seed, numBuckets) + 1];
+
+    for(size_t bucket = 0; bucket < numBuckets; ++bucket)
+        bucketOffsets[bucket + 1] += bucketOffsets[bucket];
+
+    {
+        Ids                                 insertOffsets(bucketOffsets.begin(), bucketOffsets.end() - 1);
+
+        for(size_t id = 0; id < numIds; ++id)
+            bucketIds[insertOffsets[GetBucket(hashes[id], data.Seed, numBuckets)]++] = static_cast<std::uint32_t>(id);
+    }
+
+    // Place the largest buckets first, as they are the most difficult to place
+    Ids                                     buckets(numBuckets);
+
+    for(size_t bucket = 0; bucket < numBuckets; ++bucket)
+        buckets[bucket] = static_cast<std::uint32_t>(bucket);
+
+    std::stable_sort(
+        buckets.begin(),
+        buckets.end(),
+        [&bucketOffsets](std::uint32_t a, std::uint32_t b) {
+            return bucketOffsets[a + 1] - bucketOffsets[a] > bucketOffsets[b + 1] - bucketOffsets[b];
+        }
+    );
+
+    Ids                                     displacements(numBuckets, 0);
+    Ids                                     slots(numIds, InvalidVocabularyId);
+    Ids                                     candidateSlots;
+    size_t                                  nextFreeSlot(0);
+
+    for(std::uint32_t bucket : buckets) {
+        std::uint32_t const * const         pBegin(bucketIds.data() + bucketOffsets[bucket]);
+        std::uint32_t const * const         pEnd(bucketIds.data() + bucketOffsets[bucket + 1]);
+
+        if(pBegin == pEnd)
+            break;
+
+        if(pEnd - pBegin == 1) {
+            // Buckets with a single term are stored in the first free slot
+            while(slots[nextFreeSlot] != InvalidVocabularyId)
+                ++nextFreeSlot;
+
+            slots[nextFreeSlot] = *pBegin;
+            displacements[bucket] = static_cast<std::uint32_t>(nextFreeSlot) | DirectSlotFlag;
+
+            continue;
+        }
+
+        std::uint32_t                       displacement(0);
+
+        while(true) {
+            if(displacement == MaxDisplacement)
+                return false;
+
+            candidateSlots.clear();
+
+            std::uint32_t const *           pId(pBegin);
+
+            while(pId != pEnd) {
+                std::uint32_t const         slot(static_cast<std::uint32_t>(GetSlot(hashes[*pId], data.Seed, displacement, numIds)));
+
+                if(slots[slot] != InvalidVocabularyId || std::find(candidateSlots.begin(), candidateSlots.end(), slot) != candidateSlots.end())
+                    break;
+
+                candidateSlots.emplace_back(slot);
+                ++pId;
+            }
+
+            if(pId == pEnd)
+                break;
+
+            ++displacement;
+        }
+
+        for(size_t index = 0; index < candidateSlots.size(); ++index)
+            slots[candidateSlots[index]] = pBegin[index];
+
+        displacements[bucket] = displacement;
+    }
+
+    data.Displacements = VocabularyIndex::Ids(std::move(displacements));
+    data.Slots = VocabularyIndex::Ids(std::move(slots));
+
+    return true;
+}
+
+// static
+inline VocabularyIndex::Data VocabularyIndex::Validate(Data data, bool verifyHashes) {
+    size_t const                            numIds(data.Values.size());
+
+    if(numIds >= DirectSlotFlag || data.Offsets.size() != numIds + 1 || data.Slots.size() != numIds)
+        throw std::invalid_argument("Invalid vocabulary index");
+
+    if(data.Offsets.front() != 0 || data.Offsets.back() != data.Chars.size())
+        throw std::invalid_argument("Invalid vocabulary index");
+
+    for(size_t id = 0; id < numIds; ++id) {
+        if(data.Offsets[id] > data.Offsets[id + 1])
+            throw std::invalid_argument("Invalid vocabulary index");
+    }
+
+    if(numIds == 0) {
+        if(data.Displacements.empty() == false)
+            throw std::invalid_argument("Invalid vocabulary index");
+
+        return data;
+    }
+
+    if(data.Displacements.empty())
+        throw std::invalid_argument("Invalid vocabulary index");
+
+    for(std::uint32_t displacement : data.Displacements) {
+        if((displacement & DirectSlotFlag) && (displacement & ~DirectSlotFlag) >= numIds)
+            throw std::invalid_argument("Invalid vocabulary index");
+    }
+
+    if(verifyHashes == false) {
+        for(std::uint32_t id : data.Slots) {
+            if(id >= numIds)
+                throw std::invalid_argument("Invalid vocabulary index");
+        }
+
+        return data;
+    }
+
+    // Every term must be found in the slot that its hash references
+    std::vector<bool>                       found(numIds, false);
+
+    for(std::uint32_t slot = 0; slot < numIds; ++slot) {
+        std::uint32_t const                 id(data.Slots[slot]);
+
+        if(id >= numIds || found[id])
+            throw std::invalid_argument("Invalid vocabulary index");
+
+        found[id] = true;
+
+        std::uint64_t const                 hash(Hash(data.Chars.data() + data.Offsets[id], data.Offsets[id + 1] - data.Offsets[id]));
+        std::uint32_t const                 displacement(data.Displacements[GetBucket(hash, data.Seed, data.Displacements.size())]);
+
+        if(GetSlot(hash, data.Seed, displacement, numIds) != slot)
+            throw std::invalid_argument("Invalid vocabulary index");
+    }
+
+    return data;
+}
+
+// static
+inline std::uint64_t VocabularyIndex::Hash(char const *pTerm, size_t cTerm) {
+    // FNV-1a
+    std::uint64_t                           result(14695981039346656037ull);
+    char const * const                      pEnd(pTerm + cTerm);
+
+    while(pTerm != pEnd) {
+        result ^= static_cast<unsigned char>(*pTerm++);
+        result *= 1099511628211ull;
+    }
+
+    return result;
+}
+
+// static
+inline std::uint64_t VocabularyIndex::Mix(std::uint64_t value) {
+    // SplitMix64 finalizer
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+// static
+inline std::uint32_t VocabularyIndex::Reduce(std::uint64_t value, size_t range) {
+    // Maps the upper 32 bits of the value to [0, range) without a division
+    return static_cast<std::uint32_t>(((value >> 32) * static_cast<std::uint64_t>(range)) >> 32);
+}
+
+// static
+inline size_t VocabularyIndex::GetBucket(std::uint64_t hash, std::uint64_t seed, size_t numBuckets) {
+    return Reduce(Mix(hash ^ Mix(seed)), numBuckets);
+}
+
+// static
+inline size_t VocabularyIndex::GetSlot(std::uint64_t hash, std::uint64_t seed, std::uint32_t displacement, size_t numSlots) {
+    if(displacement & DirectSlotFlag)
+        return displacement & ~DirectSlotFlag;
+
+    return Reduce(Mix(hash + Mix(seed + 1) + (static_cast<std::uint64_t>(displacement) + 1) * 0x9e3779b97f4a7c15ull), numSlots);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TermCounts
+// |
+// ----------------------------------------------------------------------
+inline TermCounts::TermCounts(size_t numIds) :
+    _counts(numIds, 0) {
+}
+
+inline TermCounts & TermCounts::GetThreadLocal(size_t numIds) {
+    static thread_local TermCounts          counts(0);
+
+    // Discard ids counted by a call that threw before `flush`
+    counts.reset();
+
+    if(counts._counts.size() < numIds)
+        counts._counts.resize(numIds, 0);
+
+    return counts;
+}
+
+inline void TermCounts::increment(std::uint32_t id) {
+    assert(id < _counts.size());
+
+    if(_counts[id]++ == 0)
+        _ids.emplace_back(id);
+}
+
+template <typename FuncT>
+void TermCounts::flush(FuncT const &func) {
+    std::sort(_ids.begin(), _ids.end());
+
+    try {
+        for(std::uint32_t id : _ids)
+            func(id, _counts[id]);
+    }
+    catch(...) {
+        reset();
+        throw;
+    }
+
+    reset();
+}
+
+inline void TermCounts::reset(void) {
+    for(std::uint32_t id : _ids)
+        _counts[id] = 0;
+
+    _ids.clear();
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
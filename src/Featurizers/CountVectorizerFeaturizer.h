@@ -6,6 +6,7 @@
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
 #include "Components/DocumentStatisticsEstimator.h"
+#include "Components/VocabularyIndex.h"
 #include "../Traits.h"
 #include "../Strings.h"
 #include "Structs.h"
@@ -52,8 +53,6 @@ private:
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using IterRangeType                      = std::tuple<std::string::const_iterator, std::string::const_iterator>;
-    using AppearanceMapType                  = typename std::map<IterRangeType, std::uint32_t, Components::IterRangeComp>;
     using StringIterator                     = std::string::const_iterator;
     using ParseFunctionType                  = std::function<
                                                    void (std::string const &,
@@ -64,7 +63,7 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    IndexMapType const                       _labels;
+    Components::VocabularyIndex              _vocabulary;
     bool const                               _binary;
 
     //data for execute same parse function as in documentstatisticestimator
@@ -82,51 +81,35 @@ private:
     // |  Private Methodsa
     // |
     // ----------------------------------------------------------------------
+    CountVectorizerTransformer(Components::VocabularyIndex vocabulary, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max);
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
 
-        AppearanceMapType appearanceMap;
-
         std::string processedInput(Components::DocumentDecorator(input, _lower, _analyzer, _regex, _ngram_min, _ngram_max));
+        Components::TermCounts & termCounts(Components::TermCounts::GetThreadLocal(_vocabulary.size()));
 
         _parse_func(
             processedInput,
-            [&appearanceMap] (std::string::const_iterator iter_start, std::string::const_iterator iter_end) {
-
-                AppearanceMapType::iterator iter_apperance(appearanceMap.find(std::make_tuple(iter_start, iter_end)));
+            [this, &termCounts] (std::string::const_iterator iter_start, std::string::const_iterator iter_end) {
+                std::uint32_t const id(_vocabulary.find(iter_start, iter_end));
 
-                if (iter_apperance != appearanceMap.end()) {
-                    ++iter_apperance->second;
-                } else {
-                    appearanceMap.insert(std::make_pair(std::make_tuple(iter_start, iter_end), 1));
-                }
+                if (id != Components::InvalidVocabularyId)
+                    termCounts.increment(id);
             }
         );
 
         std::vector<SparseVectorEncoding<std::uint32_t>::ValueEncoding> result;
 
-        for (auto const & wordAppearance : appearanceMap) {
-            std::string const word = std::string(std::get<0>(wordAppearance.first), std::get<1>(wordAppearance.first));
-
-            typename IndexMapType::const_iterator const      iter_label(_labels.find(word));
-
-            if (iter_label != _labels.end()) {
-                if (_binary) {
-                    result.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(1, iter_label->second));
-                } else {
-                    result.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(wordAppearance.second, iter_label->second));
-                }
-            }
-        }
-        // SparseVectorEncoding requires ValueEncoding to be in order
-        // so we sort result before creating SparseVectorEncoding
-        std::sort(result.begin(), result.end(),
-            [](SparseVectorEncoding<std::uint32_t>::ValueEncoding const &a, SparseVectorEncoding<std::uint32_t>::ValueEncoding const &b) {
-                return a.Index < b.Index;
+        // Ids are ordered by label index, so the results are already in the order
+        // required by SparseVectorEncoding
+        termCounts.flush(
+            [this, &result] (std::uint32_t id, std::uint32_t count) {
+                result.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(_binary ? 1 : count, _vocabulary.value(id)));
             }
         );
-        callback(SparseVectorEncoding<std::uint32_t>(_labels.size(), std::move(result)));
+
+        callback(SparseVectorEncoding<std::uint32_t>(_vocabulary.size(), std::move(result)));
 
     }
 };
@@ -248,7 +231,8 @@ public:
                                                                       AnalyzerMethod analyzer, std::string regex, std::float_t max_df,
                                                                       std::float_t min_df, nonstd::optional<std::uint32_t> top_k_terms,
                                                                       std::uint32_t ngram_min, std::uint32_t ngram_max, bool binary,
-                                                                      nonstd::optional<IndexMapType> vocabulary=nonstd::optional<IndexMapType>());
+                                                                      nonstd::optional<IndexMapType> vocabulary=nonstd::optional<IndexMapType>(),
+                                                                      std::uint32_t num_threads=1);
     ~CountVectorizerEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(CountVectorizerEstimator);
@@ -270,13 +254,33 @@ public:
 // |
 // ----------------------------------------------------------------------
 CountVectorizerTransformer::CountVectorizerTransformer(IndexMapType map, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max) :
-    _labels(
-        std::move([&map](void) ->  IndexMapType & {
-            if (map.size() == 0) {
-                throw std::invalid_argument("Index map is empty!");
-            }
-            return map;
-        }()
+    CountVectorizerTransformer(
+        Components::VocabularyIndex(
+            [&map](void) -> IndexMapType & {
+                if (map.size() == 0) {
+                    throw std::invalid_argument("Index map is empty!");
+                }
+                return map;
+            }()
+        ),
+        std::move(binary),
+        std::move(lower),
+        std::move(analyzer),
+        std::move(regex),
+        std::move(ngram_min),
+        std::move(ngram_max)
+    ) {
+}
+
+CountVectorizerTransformer::CountVectorizerTransformer(Components::VocabularyIndex vocabulary, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max) :
+    _vocabulary(
+        std::move(
+            [&vocabulary](void) -> Components::VocabularyIndex & {
+                if (vocabulary.size() == 0) {
+                    throw std::invalid_argument("Index map is empty!");
+                }
+                return vocabulary;
+            }()
         )),
     _binary(std::move(binary)),
     _lower(std::move(lower)),
@@ -316,11 +320,20 @@ CountVectorizerTransformer::CountVectorizerTransformer(Archive &ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 1)
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMapType           labels(Traits<IndexMapType>::deserialize(ar));
+
+            // Version 1.0 archives contain the vocabulary as a map; starting with
+            // 1.1, the index is serialized directly so that it doesn't have to be
+            // rebuilt and can be used in place from a memory-mapped archive.
+            Components::VocabularyIndex
+                                   vocabulary(
+                                       minorVersion == 0
+                                           ? Components::VocabularyIndex(Traits<IndexMapType>::deserialize(ar))
+                                           : Components::VocabularyIndex(ar)
+                                   );
             bool                   binary(Traits<bool>::deserialize(ar));
 
             bool                   lower(Traits<bool>::deserialize(ar));
@@ -329,7 +342,7 @@ CountVectorizerTransformer::CountVectorizerTransformer(Archive &ar) :
             std::uint32_t          ngram_min(Traits<std::uint32_t>::deserialize(ar));
             std::uint32_t          ngram_max(Traits<std::uint32_t>::deserialize(ar));
 
-            return CountVectorizerTransformer(std::move(labels), std::move(binary), std::move(lower), std::move(analyzer), std::move(regex), std::move(ngram_min), std::move(ngram_max));
+            return CountVectorizerTransformer(std::move(vocabulary), std::move(binary), std::move(lower), std::move(analyzer), std::move(regex), std::move(ngram_min), std::move(ngram_max));
         }()
     ) {
 }
@@ -337,10 +350,10 @@ CountVectorizerTransformer::CountVectorizerTransformer(Archive &ar) :
 void CountVectorizerTransformer::save(Archive &ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, 1); // Minor
 
     // Data
-    Traits<decltype(_labels)>::serialize(ar, _labels);
+    _vocabulary.save(ar);
     Traits<decltype(_binary)>::serialize(ar, _binary);
     Traits<decltype(_lower)>::serialize(ar, _lower);
     Traits<std::underlying_type<AnalyzerMethod>::type>::serialize(ar, static_cast<std::underlying_type<AnalyzerMethod>::type>(_analyzer));
@@ -350,7 +363,7 @@ void CountVectorizerTransformer::save(Archive &ar) const /*override*/ {
 }
 
 bool CountVectorizerTransformer::operator==(CountVectorizerTransformer const &other) const {
-    return _labels == other._labels
+    return _vocabulary == other._vocabulary
         && _binary == other._binary
         && _lower == other._lower
         && _analyzer == other._analyzer
@@ -370,11 +383,12 @@ CountVectorizerEstimator<MaxNumTrainingItemsV>::CountVectorizerEstimator(Annotat
                                                                                            AnalyzerMethod analyzer, std::string regex, std::float_t max_df,
                                                                                            std::float_t min_df, nonstd::optional<std::uint32_t> top_k_terms,
                                                                                            std::uint32_t ngram_min, std::uint32_t ngram_max, bool binary,
-                                                                                           nonstd::optional<IndexMapType> vocabulary) :
+                                                                                           nonstd::optional<IndexMapType> vocabulary,
+                                                                                           std::uint32_t num_threads) :
     BaseType(
         "CountVectorizerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex, lower, analyzer, regex, &vocabulary, &top_k_terms, &min_df, &max_df, ngram_min, ngram_max](void) {
+        [pAllColumnAnnotations, colIndex, lower, analyzer, regex, &vocabulary, &top_k_terms, &min_df, &max_df, ngram_min, ngram_max, num_threads](void) {
             StringDecorator decorator = lower ? Microsoft::Featurizer::Strings::ToLower : StringDecorator();
             return Components::DocumentStatisticsEstimator<MaxNumTrainingItemsV>(
                 std::move(pAllColumnAnnotations),
@@ -387,7 +401,8 @@ CountVectorizerEstimator<MaxNumTrainingItemsV>::CountVectorizerEstimator(Annotat
                 std::move(min_df),
                 std::move(max_df),
                 std::move(ngram_min),
-                std::move(ngram_max)
+                std::move(ngram_max),
+                std::move(num_threads)
                 );
         },
         [pAllColumnAnnotations, colIndex, &binary, &lower, &analyzer, &regex, &ngram_min, &ngram_max](void) {
@@ -3,6 +3,13 @@
 // Licensed under the MIT License
 // ----------------------------------------------------------------------
 #include "DateTimeFeaturizer.h"
+#include "../MemoryMappedFile.h"
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+
 #ifdef _WIN32
     #include <direct.h>
     #include <Windows.h>
@@ -26,11 +33,97 @@ namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
 
+// ----------------------------------------------------------------------
+// |
+// |  TimePointLabel
+// |
+// ----------------------------------------------------------------------
+TimePointLabel::TimePointLabel(void) :
+    TimePointLabel("") {
+}
+
+TimePointLabel::TimePointLabel(std::string const &value) :
+    _value(value.c_str()),
+    _size(value.size()) {
+}
+
+TimePointLabel::TimePointLabel(char const *value, size_t size) :
+    _value(value),
+    _size(size) {
+    assert(_value[_size] == 0);
+}
+
+char const * TimePointLabel::c_str(void) const {
+    return _value;
+}
+
+size_t TimePointLabel::size(void) const {
+    return _size;
+}
+
+bool TimePointLabel::empty(void) const {
+    return _size == 0;
+}
+
+TimePointLabel::const_iterator TimePointLabel::begin(void) const {
+    return _value;
+}
+
+TimePointLabel::const_iterator TimePointLabel::end(void) const {
+    return _value + _size;
+}
+
+std::string TimePointLabel::str(void) const {
+    return std::string(_value, _size);
+}
+
+bool TimePointLabel::operator==(TimePointLabel const &other) const {
+    return _size == other._size && std::equal(begin(), end(), other.begin());
+}
+
+bool TimePointLabel::operator==(std::string const &other) const {
+    return _size == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+bool TimePointLabel::operator==(char const *other) const {
+    return std::strncmp(_value, other, _size) == 0 && other[_size] == 0;
+}
+
+bool TimePointLabel::operator!=(TimePointLabel const &other) const {
+    return (*this == other) == false;
+}
+
+bool TimePointLabel::operator!=(std::string const &other) const {
+    return (*this == other) == false;
+}
+
+bool TimePointLabel::operator!=(char const *other) const {
+    return (*this == other) == false;
+}
+
+std::ostream & operator <<(std::ostream &os, TimePointLabel const &label) {
+    return os.write(label._value, static_cast<std::streamsize>(label._size));
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  TimePoint
 // |
 // ----------------------------------------------------------------------
+/*static*/ TimePointLabel const TimePoint::MonthLabels[12] = {
+    "January", "February", "March", "April", "May", "June",
+    "July", "August", "September", "October", "November", "December"
+};
+
+/*static*/ TimePointLabel const TimePoint::DayOfWeekLabels[7] = {
+    "Sunday", "Monday", "Tuesday", "Wednesday",
+    "Thursday", "Friday", "Saturday"
+};
+
+/*static*/ TimePointLabel const TimePoint::AmPmLabels[2] = {
+    "am", "pm"
+};
+
 TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
     // Get to a tm to get what we need.
     // Eventually C++202x will have expanded chrono support that might
@@ -77,10 +170,9 @@ TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
 
         weekIso = static_cast<std::uint8_t>(iso_date.weeknum().operator unsigned());
         yearIso = iso_date.year().operator int();
-        monthLabel = _months[month - 1];
-        amPmLabel = amPm ? "pm" : "am";
-        dayOfWeekLabel = _weekDays[dayOfWeek];
-        holidayName = "";
+        monthLabel = MonthLabels[month - 1];
+        amPmLabel = AmPmLabels[amPm];
+        dayOfWeekLabel = DayOfWeekLabels[dayOfWeek];
         isPaidTimeOff = 0;               // TODO
     }
     else
@@ -94,11 +186,185 @@ TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
     }
 }
 
+TimePoint::TimePoint(CalendarDay const &calendarDay, std::uint32_t secondsSinceMidnight) {
+    assert(secondsSinceMidnight < 60 * 60 * 24);
+
+    year = calendarDay.year;
+    month = calendarDay.month;
+    day = calendarDay.day;
+    hour = static_cast<std::uint8_t>(secondsSinceMidnight / (60 * 60));
+    minute = static_cast<std::uint8_t>(secondsSinceMidnight / 60 % 60);
+    second = static_cast<std::uint8_t>(secondsSinceMidnight % 60);
+    amPm = hour < 12 ? 0 : 1;
+    hour12 = hour <= 12 ? hour : hour - 12;
+    dayOfWeek = calendarDay.dayOfWeek;
+    dayOfQuarter = calendarDay.dayOfQuarter;
+    dayOfYear = calendarDay.dayOfYear;
+    weekOfMonth = calendarDay.weekOfMonth;
+    quarterOfYear = (month + 2) / 3;
+    halfOfYear = month <= 6 ? 1 : 2;
+    weekIso = calendarDay.weekIso;
+    yearIso = calendarDay.yearIso;
+    monthLabel = MonthLabels[month - 1];
+    amPmLabel = AmPmLabels[amPm];
+    dayOfWeekLabel = DayOfWeekLabels[dayOfWeek];
+    isPaidTimeOff = 0;               // TODO
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimePointColumns
+// |
+// ----------------------------------------------------------------------
+void TimePointColumns::resize(size_t numItems) {
+    year.resize(numItems);
+    month.resize(numItems);
+    day.resize(numItems);
+    hour.resize(numItems);
+    minute.resize(numItems);
+    second.resize(numItems);
+    amPm.resize(numItems);
+    hour12.resize(numItems);
+    dayOfWeek.resize(numItems);
+    dayOfQuarter.resize(numItems);
+    dayOfYear.resize(numItems);
+    weekOfMonth.resize(numItems);
+    quarterOfYear.resize(numItems);
+    halfOfYear.resize(numItems);
+    weekIso.resize(numItems);
+    yearIso.resize(numItems);
+    holidayId.resize(numItems);
+    isPaidTimeOff.resize(numItems);
+}
+
+size_t TimePointColumns::size(void) const {
+    return year.size();
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  CalendarTable
+// |
+// ----------------------------------------------------------------------
+constexpr std::uint32_t const               CalendarDay::NoHolidayId;
+constexpr std::int32_t const                CalendarTable::DefaultFirstYear;
+constexpr std::int32_t const                CalendarTable::DefaultLastYear;
+
+namespace {
+
+static constexpr std::int64_t const         SecondsPerDay = 60 * 60 * 24;
+
+} // anonymous namespace
+
+CalendarTable::CalendarTable(std::int32_t firstYear, std::int32_t lastYear, GetHolidayIdFunc const &getHolidayIdFunc) :
+    _firstDay(
+        [&firstYear, &lastYear](void) -> std::int64_t {
+            // Years (and ISO years) must fit within the CalendarDay fields
+            if(firstYear <= std::numeric_limits<std::int16_t>::min() || firstYear >= std::numeric_limits<std::int16_t>::max())
+                throw std::invalid_argument("firstYear");
+
+            if(lastYear < firstYear || lastYear >= std::numeric_limits<std::int16_t>::max())
+                throw std::invalid_argument("lastYear");
+
+            return date::sys_days(date::year(firstYear) / 1 / 1).time_since_epoch().count();
+        }()
+    ),
+    _days(
+        [&lastYear, &getHolidayIdFunc, this](void) {
+            date::sys_days const            end(date::year(lastYear + 1) / 1 / 1);
+            std::vector<CalendarDay>        days;
+
+            days.reserve(static_cast<size_t>(end.time_since_epoch().count() - _firstDay));
+
+            for(date::sys_days current((date::days(static_cast<date::days::rep>(_firstDay)))); current < end; current += date::days(1)) {
+                date::year_month_day const              ymd(current);
+                iso_week::year_weeknum_weekday const    isoDate(current);
+                unsigned const                          month(static_cast<unsigned>(ymd.month()));
+                unsigned const                          quarter((month + 2) / 3);
+                date::sys_days const                    startOfYear(ymd.year() / 1 / 1);
+                date::sys_days const                    startOfQuarter(ymd.year() / date::month((quarter - 1) * 3 + 1) / 1);
+                std::int64_t const                      daysSinceEpoch(current.time_since_epoch().count());
+
+                days.emplace_back(
+                    CalendarDay{
+                        static_cast<std::int16_t>(static_cast<int>(ymd.year())),
+                        static_cast<std::int16_t>(static_cast<int>(isoDate.year())),
+                        static_cast<std::uint16_t>((current - startOfYear).count()),
+                        static_cast<std::uint8_t>(month),
+                        static_cast<std::uint8_t>(static_cast<unsigned>(ymd.day())),
+                        static_cast<std::uint8_t>(static_cast<unsigned>(date::weekday(current))),
+                        static_cast<std::uint8_t>((current - startOfQuarter).count() + 1),
+                        static_cast<std::uint8_t>((static_cast<unsigned>(ymd.day()) - 1) / 7),
+                        static_cast<std::uint8_t>(static_cast<unsigned>(isoDate.weeknum())),
+                        getHolidayIdFunc ? getHolidayIdFunc(daysSinceEpoch * SecondsPerDay) : CalendarDay::NoHolidayId
+                    }
+                );
+            }
+
+            return days;
+        }()
+    ) {
+}
+
+size_t CalendarTable::size(void) const {
+    return _days.size();
+}
+
+CalendarDay const * CalendarTable::find(std::int64_t secondsSinceEpoch, std::uint32_t &secondsSinceMidnight) const {
+    std::int64_t                            daysSinceEpoch(secondsSinceEpoch / SecondsPerDay);
+
+    if(secondsSinceEpoch % SecondsPerDay < 0)
+        --daysSinceEpoch;
+
+    if(daysSinceEpoch < _firstDay || static_cast<std::uint64_t>(daysSinceEpoch - _firstDay) >= _days.size())
+        return nullptr;
+
+    secondsSinceMidnight = static_cast<std::uint32_t>(secondsSinceEpoch - daysSinceEpoch * SecondsPerDay);
+    return &_days[static_cast<size_t>(daysSinceEpoch - _firstDay)];
+}
+
+void CalendarTable::transform(std::int64_t const *pSecondsSinceEpoch, size_t cItems, TimePointColumns &columns, OutOfRangeFunc const &outOfRangeFunc) const {
+    assert(columns.size() >= cItems);
+
+    for(size_t index = 0; index < cItems; ++index) {
+        std::uint32_t                       secondsSinceMidnight;
+        CalendarDay const * const           pDay(find(pSecondsSinceEpoch[index], secondsSinceMidnight));
+
+        if(pDay == nullptr) {
+            outOfRangeFunc(index);
+            continue;
+        }
+
+        std::uint8_t const                  hour(static_cast<std::uint8_t>(secondsSinceMidnight / (60 * 60)));
+
+        columns.year[index] = pDay->year;
+        columns.month[index] = pDay->month;
+        columns.day[index] = pDay->day;
+        columns.hour[index] = hour;
+        columns.minute[index] = static_cast<std::uint8_t>(secondsSinceMidnight / 60 % 60);
+        columns.second[index] = static_cast<std::uint8_t>(secondsSinceMidnight % 60);
+        columns.amPm[index] = hour < 12 ? 0 : 1;
+        columns.hour12[index] = hour <= 12 ? hour : static_cast<std::uint8_t>(hour - 12);
+        columns.dayOfWeek[index] = pDay->dayOfWeek;
+        columns.dayOfQuarter[index] = pDay->dayOfQuarter;
+        columns.dayOfYear[index] = pDay->dayOfYear;
+        columns.weekOfMonth[index] = pDay->weekOfMonth;
+        columns.quarterOfYear[index] = static_cast<std::uint8_t>((pDay->month + 2) / 3);
+        columns.halfOfYear[index] = pDay->month <= 6 ? 1 : 2;
+        columns.weekIso[index] = pDay->weekIso;
+        columns.yearIso[index] = pDay->yearIso;
+        columns.holidayId[index] = pDay->holidayId;
+        columns.isPaidTimeOff[index] = 0;
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  DateTimeTransformer
 // |
 // ----------------------------------------------------------------------
+constexpr std::uint32_t const               DateTimeTransformer::NoHolidayId;
+
 namespace {
 
 #if (defined _WIN32)
@@ -139,36 +405,6 @@ namespace {
         return binaryPath + "\\Data\\DateTimeFeaturizer\\";
     }
 
-    bool EnumCountries(
-        std::function<bool (std::string)> const &callback,
-        std::string const &optionalDataRootDir
-    ) {
-        // Note that this code is not exception safe!
-        std::string                         dataDir(GetDataDirectory(optionalDataRootDir) + "*");
-        WIN32_FIND_DATA                     data;
-        HANDLE                              handle;
-        bool                                result(true);
-
-        handle = FindFirstFile(dataDir.c_str(), &data);
-        if(handle == INVALID_HANDLE_VALUE)
-            return result;
-
-        while(true) {
-            if((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0) {
-                if(callback(data.cFileName) == false) {
-                    result = false;
-                    break;
-                }
-            }
-
-            if(FindNextFile(handle, &data) == false)
-                break;
-        }
-
-        FindClose(handle);
-        return result;
-    }
-
 #else
 #   if (defined __APPLE__)
     std::string GetBinaryPath(void) {
@@ -220,55 +456,23 @@ namespace {
 
         return binaryPath + "/Data/DateTimeFeaturizer/";
     }
-
-    bool EnumCountries(
-        std::function<bool (std::string)> const &callback,
-        std::string const &optionalDataRootDir
-    ) {
-        // Note that this code is not exception safe
-        bool                                result(true);
-        DIR *                               dir(opendir(GetDataDirectory(optionalDataRootDir).c_str()));
-
-        if(dir == nullptr)
-            return result;
-
-        dirent *                            info(nullptr);
-
-        while((info = readdir(dir)) != nullptr) {
-            // Skip directories
-            if(info->d_type == DT_DIR)
-                continue;
-
-            if(callback(info->d_name) == false)
-                return false;
-        }
-
-        closedir(dir);
-
-        return result;
-    }
-
 #endif
 
-nlohmann::json GetJsonStream(std::string const & jsonFilename) {
-    nlohmann::json                          holidaysByCountry;
-    std::ifstream                           file(jsonFilename);
-
-    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+std::shared_ptr<CalendarTable const> const & GetDefaultCalendarTable(void) {
+    static std::shared_ptr<CalendarTable const> const       table(std::make_shared<CalendarTable>());
 
-    if(file)
-        holidaysByCountry = nlohmann::json::parse(file);
-
-    return holidaysByCountry;
+    return table;
 }
 
 std::string RemoveCountryExtension(std::string const &country) {
-    std::string::size_type const            dot(country.find_last_of('.'));
+    // Country names were originally the names of json files
+    static char const * const               extension(".json");
+    static size_t const                     extensionLength(5);
 
-    if(dot == std::string::npos)
-        return country;
+    if(country.size() > extensionLength && country.compare(country.size() - extensionLength, extensionLength, extension) == 0)
+        return country.substr(0, country.size() - extensionLength);
 
-    return country.substr(0, dot);
+    return country;
 }
 
 bool DoesCountryMatch(std::string const &country, std::string query) {
@@ -295,6 +499,357 @@ bool DoesCountryMatch(std::string const &country, std::string query) {
 
 } // anonymous namespace
 
+// ----------------------------------------------------------------------
+// |
+// |  Details::HolidayBlob
+// |
+// ----------------------------------------------------------------------
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HolidayBlob
+///  \brief         Read-only, memory-mapped view of the holiday data generated
+///                 by `DateTimeFeaturizerData/Tools/HolidayBlob.py` (see that
+///                 file for a description of the format).
+///
+class HolidayBlob {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    struct Country {
+        std::uint32_t                       NameId;
+        std::uint32_t                       FirstHoliday;
+        std::uint32_t                       NumHolidays;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static char const * const               Filename;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HolidayBlob(std::string const &filename);
+    ~HolidayBlob(void) = default;
+
+    HolidayBlob(HolidayBlob const &) = delete;
+    HolidayBlob & operator =(HolidayBlob const &) = delete;
+
+    std::uint32_t num_countries(void) const;
+    Country const & country(std::uint32_t index) const;
+
+    std::uint32_t num_strings(void) const;
+    TimePointLabel string(std::uint32_t id) const;
+
+    std::uint16_t const * days(void) const;
+    std::uint16_t const * name_ids(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    MemoryMappedFile const                  _file;
+
+    std::uint32_t                           _numCountries;
+    std::uint32_t                           _numStrings;
+    Country const *                         _pCountries;
+    std::uint32_t const *                   _pStringOffsets;
+    std::uint16_t const *                   _pDays;
+    std::uint16_t const *                   _pNameIds;
+    char const *                            _pChars;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void initialize(void);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HolidayTable
+///  \brief         The holidays for a single country. Holiday ids are the ids
+///                 of the holiday names within the blob; they are overlaid on
+///                 the (shared) default calendar table rather than stored in
+///                 a per-country copy of it.
+///
+class HolidayTable {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HolidayTable(std::shared_ptr<HolidayBlob const> pBlob, std::uint32_t countryIndex);
+
+    HolidayTable(HolidayTable const &) = delete;
+    HolidayTable & operator =(HolidayTable const &) = delete;
+
+    bool operator==(HolidayTable const &other) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns the id of the holiday on the day that contains
+    ///                 `secondsSinceEpoch`, or `CalendarDay::NoHolidayId`.
+    ///
+    std::uint32_t find(std::int64_t secondsSinceEpoch) const;
+
+    TimePointLabel name(std::uint32_t holidayId) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::shared_ptr<HolidayBlob const> const    _pBlob;
+    std::uint16_t const * const                 _pDays;
+    std::uint16_t const * const                 _pNameIds;
+    std::uint32_t const                         _numHolidays;
+};
+
+/*static*/ char const * const HolidayBlob::Filename = "Holidays.bin";
+
+HolidayBlob::HolidayBlob(std::string const &filename) :
+    _file(filename) {
+    initialize();
+}
+
+std::uint32_t HolidayBlob::num_countries(void) const {
+    return _numCountries;
+}
+
+HolidayBlob::Country const & HolidayBlob::country(std::uint32_t index) const {
+    assert(index < _numCountries);
+    return _pCountries[index];
+}
+
+std::uint32_t HolidayBlob::num_strings(void) const {
+    return _numStrings;
+}
+
+TimePointLabel HolidayBlob::string(std::uint32_t id) const {
+    assert(id < _numStrings);
+
+    // Strings are null-terminated
+    return TimePointLabel(_pChars + _pStringOffsets[id], _pStringOffsets[id + 1] - _pStringOffsets[id] - 1);
+}
+
+std::uint16_t const * HolidayBlob::days(void) const {
+    return _pDays;
+}
+
+std::uint16_t const * HolidayBlob::name_ids(void) const {
+    return _pNameIds;
+}
+
+void HolidayBlob::initialize(void) {
+    struct Header {
+        char                                Magic[4];
+        std::uint32_t                       ByteOrderMark;
+        std::uint16_t                       MajorVersion;
+        std::uint16_t                       MinorVersion;
+        std::uint32_t                       NumCountries;
+        std::uint32_t                       NumStrings;
+        std::uint32_t                       NumHolidays;
+        std::uint32_t                       NumChars;
+    };
+
+    static_assert(sizeof(Header) == 28, "Unexpected header size");
+    static_assert(sizeof(Country) == 12, "Unexpected country size");
+
+    std::runtime_error const                error("Invalid holiday data");
+
+    if(_file.size() < sizeof(Header))
+        throw error;
+
+    Header const &                          header(*reinterpret_cast<Header const *>(_file.data()));
+
+    if(std::memcmp(header.Magic, "FZHD", sizeof(header.Magic)) != 0 || header.ByteOrderMark != 0x01020304)
+        throw error;
+
+    if(header.MajorVersion != 1)
+        throw std::runtime_error("Unsupported holiday data version");
+
+    std::uint64_t const                     expectedSize(
+        sizeof(Header)
+        + static_cast<std::uint64_t>(header.NumCountries) * sizeof(Country)
+        + (static_cast<std::uint64_t>(header.NumStrings) + 1) * sizeof(std::uint32_t)
+        + static_cast<std::uint64_t>(header.NumHolidays) * sizeof(std::uint16_t) * 2
+        + header.NumChars
+    );
+
+    if(expectedSize != _file.size())
+        throw error;
+
+    _numCountries = header.NumCountries;
+    _numStrings = header.NumStrings;
+    _pCountries = reinterpret_cast<Country const *>(_file.data() + sizeof(Header));
+    _pStringOffsets = reinterpret_cast<std::uint32_t const *>(_pCountries + _numCountries);
+    _pDays = reinterpret_cast<std::uint16_t const *>(_pStringOffsets + _numStrings + 1);
+    _pNameIds = _pDays + header.NumHolidays;
+    _pChars = reinterpret_cast<char const *>(_pNameIds + header.NumHolidays);
+
+    // Strings
+    if(_pStringOffsets[0] != 0 || _pStringOffsets[_numStrings] != header.NumChars)
+        throw error;
+
+    for(std::uint32_t id = 0; id < _numStrings; ++id) {
+        if(_pStringOffsets[id + 1] <= _pStringOffsets[id] || _pChars[_pStringOffsets[id + 1] - 1] != 0)
+            throw error;
+    }
+
+    // Countries
+    for(Country const *pCountry = _pCountries; pCountry != _pCountries + _numCountries; ++pCountry) {
+        if(pCountry->NameId >= _numStrings)
+            throw error;
+
+        if(static_cast<std::uint64_t>(pCountry->FirstHoliday) + pCountry->NumHolidays > header.NumHolidays)
+            throw error;
+
+        std::uint16_t const * const         pDays(_pDays + pCountry->FirstHoliday);
+        std::uint16_t const * const         pNameIds(_pNameIds + pCountry->FirstHoliday);
+
+        for(std::uint32_t index = 0; index < pCountry->NumHolidays; ++index) {
+            if(pNameIds[index] >= _numStrings)
+                throw error;
+
+            // Days must be sorted so that they can be searched
+            if(index != 0 && pDays[index] <= pDays[index - 1])
+                throw error;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Details::HolidayTable
+// |
+// ----------------------------------------------------------------------
+HolidayTable::HolidayTable(std::shared_ptr<HolidayBlob const> pBlob, std::uint32_t countryIndex) :
+    _pBlob(std::move(pBlob)),
+    _pDays(_pBlob->days() + _pBlob->country(countryIndex).FirstHoliday),
+    _pNameIds(_pBlob->name_ids() + _pBlob->country(countryIndex).FirstHoliday),
+    _numHolidays(_pBlob->country(countryIndex).NumHolidays) {
+}
+
+bool HolidayTable::operator==(HolidayTable const &other) const {
+    if(_numHolidays != other._numHolidays)
+        return false;
+
+    for(std::uint32_t index = 0; index < _numHolidays; ++index) {
+        if(_pDays[index] != other._pDays[index] || name(_pNameIds[index]) != other.name(other._pNameIds[index]))
+            return false;
+    }
+
+    return true;
+}
+
+std::uint32_t HolidayTable::find(std::int64_t secondsSinceEpoch) const {
+    static constexpr std::int64_t const     secondsPerDay(60 * 60 * 24);
+
+    std::int64_t                            daysSinceEpoch(secondsSinceEpoch / secondsPerDay);
+
+    if(secondsSinceEpoch % secondsPerDay < 0)
+        --daysSinceEpoch;
+
+    if(daysSinceEpoch < 0 || daysSinceEpoch > std::numeric_limits<std::uint16_t>::max())
+        return CalendarDay::NoHolidayId;
+
+    std::uint16_t const * const             pEnd(_pDays + _numHolidays);
+    std::uint16_t const * const             pDay(std::lower_bound(_pDays, pEnd, static_cast<std::uint16_t>(daysSinceEpoch)));
+
+    if(pDay == pEnd || *pDay != daysSinceEpoch)
+        return CalendarDay::NoHolidayId;
+
+    return _pNameIds[pDay - _pDays];
+}
+
+TimePointLabel HolidayTable::name(std::uint32_t holidayId) const {
+    if(holidayId >= _pBlob->num_strings())
+        throw std::invalid_argument("holidayId");
+
+    return _pBlob->string(holidayId);
+}
+
+} // namespace Details
+
+namespace {
+
+std::mutex                                  g_holidayMutex;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetHolidayBlob
+///  \brief         Returns the holiday data within `dataDirectory` (or null
+///                 if it doesn't exist); the data is shared by all callers
+///                 in the process. `g_holidayMutex` must be locked.
+///
+std::shared_ptr<Details::HolidayBlob const> GetHolidayBlob(std::string const &dataDirectory) {
+    static std::map<std::string, std::weak_ptr<Details::HolidayBlob const>>    cache;
+
+    std::weak_ptr<Details::HolidayBlob const> &         cached(cache[dataDirectory]);
+    std::shared_ptr<Details::HolidayBlob const>         result(cached.lock());
+
+    if(result)
+        return result;
+
+    std::string const                       filename(dataDirectory + Details::HolidayBlob::Filename);
+
+    if(std::ifstream(filename).good() == false)
+        return result;
+
+    result = std::make_shared<Details::HolidayBlob>(filename);
+    cached = result;
+
+    return result;
+}
+
+std::uint32_t FindCountry(Details::HolidayBlob const &blob, std::string const &value) {
+    std::string const                       country(RemoveCountryExtension(value));
+
+    for(std::uint32_t index = 0; index < blob.num_countries(); ++index) {
+        if(DoesCountryMatch(country, blob.string(blob.country(index).NameId).str()))
+            return index;
+    }
+
+    return blob.num_countries();
+}
+
+std::shared_ptr<Details::HolidayTable const> GetHolidayTable(std::string const &countryName, std::string const &optionalDataRootDir) {
+    static std::map<std::pair<std::string, std::uint32_t>, std::weak_ptr<Details::HolidayTable const>>   cache;
+
+    std::string const                       dataDirectory(GetDataDirectory(optionalDataRootDir));
+    std::lock_guard<std::mutex> const       lock(g_holidayMutex);
+    std::shared_ptr<Details::HolidayBlob const>     pBlob(GetHolidayBlob(dataDirectory));
+    std::uint32_t const                     countryIndex(pBlob ? FindCountry(*pBlob, countryName) : 0);
+
+    if(!pBlob || countryIndex == pBlob->num_countries())
+        throw std::invalid_argument(countryName);
+
+    std::weak_ptr<Details::HolidayTable const> &        cached(cache[std::make_pair(dataDirectory, countryIndex)]);
+    std::shared_ptr<Details::HolidayTable const>        result(cached.lock());
+
+    if(result)
+        return result;
+
+    result = std::make_shared<Details::HolidayTable>(std::move(pBlob), countryIndex);
+    cached = result;
+
+    return result;
+}
+
+} // anonymous namespace
+
 DateTimeTransformer::DateTimeTransformer(Archive &ar) :
     DateTimeTransformer(ar, "") {
 }
@@ -316,54 +871,22 @@ DateTimeTransformer::DateTimeTransformer(Archive &ar, std::string dataRootDir) :
 
 DateTimeTransformer::DateTimeTransformer(std::string optionalCountryName, std::string optionalDataRootDir):
     _countryName(std::move(optionalCountryName)),
-    _dateHolidayMap(
-        [this, &optionalDataRootDir]() {
+    _holidays(
+        [this, &optionalDataRootDir](void) {
             if(_countryName.empty())
-                return HolidayMap();
-
-            // Get the corresponding file
-            std::string                         filename;
-
-            if(
-                EnumCountries(
-                    [this, &filename](std::string country) {
-                        if(DoesCountryMatch(_countryName, country)) {
-                            filename = std::move(country);
-
-                            // Don't continue processing
-                            return false;
-                        }
-
-                        return true;
-                    },
-                    optionalDataRootDir
-                )
-            ) {
-                // A true return value means that we have enumerated through all of the country names and didn't find a match
-                throw std::invalid_argument(_countryName);
-            }
-
-            JsonStream holidaysByCountry = GetJsonStream(GetDataDirectory(optionalDataRootDir) + filename);
+                return std::shared_ptr<Details::HolidayTable const>();
 
-            //Convert Jsonstream to std::unordered_map
-            //Note that the map keys are generated with "Date" and "Holiday" so no need to check existence
-            std::vector<std::int64_t> dateVector = holidaysByCountry.at("Date").get<std::vector<std::int64_t>>();
-            std::vector<std::string> nameVector = holidaysByCountry.at("Holiday").get<std::vector<std::string>>();
-            HolidayMap                      holidays;
-
-            assert(dateVector.size() == nameVector.size());
-            for (unsigned long iter = 0; iter < dateVector.size(); ++iter) {
-                holidays[dateVector[iter]] = nameVector[iter];
-            }
-
-            return holidays;
+            return GetHolidayTable(_countryName, optionalDataRootDir);
         }()
-    ) {
-
+    ),
+    _calendar(GetDefaultCalendarTable()) {
 }
 
 bool DateTimeTransformer::operator==(DateTimeTransformer const &other) const {
-    return _dateHolidayMap == other._dateHolidayMap;
+    if(_holidays == other._holidays)
+        return true;
+
+    return _holidays && other._holidays && *_holidays == *other._holidays;
 }
 
 void DateTimeTransformer::save(Archive & ar) const /*override*/ {
@@ -375,23 +898,75 @@ void DateTimeTransformer::save(Archive & ar) const /*override*/ {
     Traits<std::string>::serialize(ar, _countryName);
 }
 
+void DateTimeTransformer::transform(std::int64_t const *pSecondsSinceEpoch, size_t cItems, TimePointColumns &columns) const {
+    if(pSecondsSinceEpoch == nullptr && cItems != 0)
+        throw std::invalid_argument("pSecondsSinceEpoch");
+
+    columns.resize(cItems);
+
+    _calendar->transform(
+        pSecondsSinceEpoch,
+        cItems,
+        columns,
+        [pSecondsSinceEpoch, &columns](size_t index) {
+            std::int64_t const                          secondsSinceEpoch(pSecondsSinceEpoch[index]);
+            std::chrono::system_clock::time_point const timePoint((std::chrono::seconds(secondsSinceEpoch)));
+            TimePoint const                             result(timePoint);
+
+            columns.year[index] = result.year;
+            columns.month[index] = result.month;
+            columns.day[index] = result.day;
+            columns.hour[index] = result.hour;
+            columns.minute[index] = result.minute;
+            columns.second[index] = result.second;
+            columns.amPm[index] = result.amPm;
+            columns.hour12[index] = result.hour12;
+            columns.dayOfWeek[index] = result.dayOfWeek;
+            columns.dayOfQuarter[index] = result.dayOfQuarter;
+            columns.dayOfYear[index] = result.dayOfYear;
+            columns.weekOfMonth[index] = result.weekOfMonth;
+            columns.quarterOfYear[index] = result.quarterOfYear;
+            columns.halfOfYear[index] = result.halfOfYear;
+            columns.weekIso[index] = result.weekIso;
+            columns.yearIso[index] = result.yearIso;
+            columns.holidayId[index] = NoHolidayId;
+            columns.isPaidTimeOff[index] = result.isPaidTimeOff;
+        }
+    );
+
+    // The calendar is shared by all countries, so holidays are overlaid
+    if(_holidays) {
+        for(size_t index = 0; index < cItems; ++index)
+            columns.holidayId[index] = _holidays->find(pSecondsSinceEpoch[index]);
+    }
+}
+
+TimePointLabel DateTimeTransformer::holiday_name(std::uint32_t holidayId) const {
+    if(holidayId == NoHolidayId)
+        return TimePointLabel();
+
+    if(!_holidays)
+        throw std::invalid_argument("holidayId");
+
+    return _holidays->name(holidayId);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction const &callback) /*override*/ {
-    static constexpr long long const        secondsPerDay(60 * 60 * 24);
+    long long const                         secondsSinceEpoch(std::chrono::time_point_cast<std::chrono::seconds>(input).time_since_epoch().count());
+    std::uint32_t                           secondsSinceMidnight;
+    CalendarDay const * const               pDay(_calendar->find(secondsSinceEpoch, secondsSinceMidnight));
 
-    TimePoint                               result(input);
+    // The timestamp may be outside of the range covered by the calendar table
+    TimePoint                               result(pDay ? TimePoint(*pDay, secondsSinceMidnight) : TimePoint(input));
 
-    if (!_dateHolidayMap.empty()) {
-        // Values in the holiday map are based on midnight of the corresponding day. When looking up holidays for this time,
-        // remove any seconds since midnight.
-        long long const                     totalSeconds(std::chrono::time_point_cast<std::chrono::seconds>(input).time_since_epoch().count());
-        int64_t const                       holidayKey(static_cast<int64_t>((static_cast<double>(totalSeconds) / secondsPerDay)) * secondsPerDay);
-        HolidayMap::const_iterator const    iter(_dateHolidayMap.find(holidayKey));
+    if(_holidays) {
+        std::uint32_t const                 holidayId(_holidays->find(secondsSinceEpoch));
 
-        if(iter != _dateHolidayMap.end())
-            result.holidayName = iter->second;
+        if(holidayId != NoHolidayId)
+            result.holidayName = _holidays->name(holidayId);
     }
 
     callback(std::move(result));
@@ -406,28 +981,25 @@ void DateTimeTransformer::flush_impl(CallbackFunction const &) /*override*/ {
 // |
 // ----------------------------------------------------------------------
 /*static*/ bool DateTimeEstimator::IsValidCountry(std::string const &value, nonstd::optional<std::string> dataRootDir) {
-    // EnumCountries will return true if the enumeration completes
-    // and false if it was terminated. In this case, termination means
-    // that the country was found.
-    return EnumCountries(
-        [&value](std::string country) {
-            // Continue if the countries don't match
-            return DoesCountryMatch(value, std::move(country)) == false;
-        },
-        dataRootDir ? *dataRootDir : std::string()
-    ) == false;
+    std::string const                       dataDirectory(GetDataDirectory(dataRootDir ? *dataRootDir : std::string()));
+    std::lock_guard<std::mutex> const       lock(g_holidayMutex);
+    std::shared_ptr<Details::HolidayBlob const> const   pBlob(GetHolidayBlob(dataDirectory));
+
+    return pBlob && FindCountry(*pBlob, value) != pBlob->num_countries();
 }
 
 /*static*/ std::vector<std::string> DateTimeEstimator::GetSupportedCountries(nonstd::optional<std::string> dataRootDir) {
+    std::string const                       dataDirectory(GetDataDirectory(dataRootDir ? *dataRootDir : std::string()));
+    std::lock_guard<std::mutex> const       lock(g_holidayMutex);
+    std::shared_ptr<Details::HolidayBlob const> const   pBlob(GetHolidayBlob(dataDirectory));
     std::vector<std::string>                results;
 
-    EnumCountries(
-        [&results](std::string country) {
-            results.emplace_back(RemoveCountryExtension(country));
-            return true;
-        },
-        dataRootDir ? *dataRootDir : std::string()
-    );
+    if(pBlob) {
+        results.reserve(pBlob->num_countries());
+
+        for(std::uint32_t index = 0; index < pBlob->num_countries(); ++index)
+            results.emplace_back(pBlob->string(pBlob->country(index).NameId).str());
+    }
 
     std::sort(results.begin(), results.end());
 
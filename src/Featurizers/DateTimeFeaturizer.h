@@ -7,10 +7,12 @@
 #include <chrono>
 #include <ctime>
 #include <cstdint>
-#include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <stdio.h>
 
@@ -29,7 +31,6 @@
 #endif
 
 #include "../3rdParty/iso_week.h"
-#include "../3rdParty/json.h"
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -45,6 +46,87 @@ namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimePointLabel
+///  \brief         Non-owning reference to a null-terminated label. Labels
+///                 reference either the static tables in `TimePoint` or the
+///                 holiday names owned by a `DateTimeTransformer`, and are
+///                 only valid for the lifetime of that transformer.
+///
+class TimePointLabel {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using const_iterator                    = char const *;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimePointLabel(void);
+    explicit TimePointLabel(std::string const &value);
+    TimePointLabel(char const *value, size_t size);
+
+    template <size_t N>
+    TimePointLabel(char const (&value)[N]);
+
+    TimePointLabel(TimePointLabel const &) = default;
+    TimePointLabel & operator =(TimePointLabel const &) = default;
+
+    char const * c_str(void) const;
+    size_t size(void) const;
+    bool empty(void) const;
+
+    const_iterator begin(void) const;
+    const_iterator end(void) const;
+
+    std::string str(void) const;
+
+    bool operator==(TimePointLabel const &other) const;
+    bool operator==(std::string const &other) const;
+    bool operator==(char const *other) const;
+    bool operator!=(TimePointLabel const &other) const;
+    bool operator!=(std::string const &other) const;
+    bool operator!=(char const *other) const;
+
+    friend std::ostream & operator <<(std::ostream &os, TimePointLabel const &label);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    char const *                            _value;
+    size_t                                  _size;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        CalendarDay
+///  \brief         Calendar information for a single day, as stored in a
+///                 `CalendarTable`.
+///
+struct CalendarDay {
+    static constexpr std::uint32_t const    NoHolidayId = std::numeric_limits<std::uint32_t>::max();
+
+    std::int16_t                            year;
+    std::int16_t                            yearIso;
+    std::uint16_t                           dayOfYear;      // 0 through 365
+    std::uint8_t                            month;          // 1 through 12
+    std::uint8_t                            day;            // 1 through 31
+    std::uint8_t                            dayOfWeek;      // 0 (Sunday) through 6 (Saturday)
+    std::uint8_t                            dayOfQuarter;   // 1 through 92
+    std::uint8_t                            weekOfMonth;    // 0 through 4
+    std::uint8_t                            weekIso;        // 1 through 53
+    std::uint32_t                           holidayId;      // `NoHolidayId` if the day isn't a holiday
+};
+
+static_assert(sizeof(CalendarDay) == 16, "CalendarDay should remain compact");
+
 /////////////////////////////////////////////////////////////////////////
 ///  \struct        TimePoint
 ///  \brief         Struct to hold various components of DateTime information
@@ -66,10 +148,10 @@ struct TimePoint {
     std::uint8_t halfOfYear = 0;    // 1 if date is prior to July 1, 2 otherwise
     std::uint8_t weekIso = 0;       // ISO week, see below for details
     std::int32_t yearIso = 0;      // ISO year, see details later
-    std::string monthLabel = "";    // calendar month as string, 'January' through 'December'
-    std::string amPmLabel = "";     // 'am' if hour is before noon (12 pm), 'pm' otherwise
-    std::string dayOfWeekLabel = "";// day of week as string
-    std::string holidayName = "";   // If a country is provided, we check if the date is a holiday
+    TimePointLabel monthLabel;      // calendar month as string, 'January' through 'December'
+    TimePointLabel amPmLabel;       // 'am' if hour is before noon (12 pm), 'pm' otherwise
+    TimePointLabel dayOfWeekLabel;  // day of week as string
+    TimePointLabel holidayName;     // If a country is provided, we check if the date is a holiday
     std::uint8_t isPaidTimeOff = 0; // If its a holiday, is it PTO
 
     // ISO year and week are defined in ISO 8601, see Wikipedia.ISO for details.
@@ -79,6 +161,7 @@ struct TimePoint {
     // January 4. As such, ISO years may differ from calendar years.
 
     TimePoint(const std::chrono::system_clock::time_point& sysTime);
+    TimePoint(CalendarDay const &calendarDay, std::uint32_t secondsSinceMidnight);
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimePoint);
 
@@ -90,18 +173,122 @@ struct TimePoint {
         SUNDAY = 0, MONDAY, TUESDAY, WEDNESDAY, THURSDAY, FRIDAY, SATURDAY
     };
 
-private:
-    const std::string _weekDays[7] = {
-        "Sunday", "Monday", "Tuesday", "Wednesday",
-        "Thursday", "Friday", "Saturday"
-    };
+    // Labels shared by all TimePoints, indexed by `month - 1`, `dayOfWeek` and `amPm`
+    static TimePointLabel const             MonthLabels[12];
+    static TimePointLabel const             DayOfWeekLabels[7];
+    static TimePointLabel const             AmPmLabels[2];
+};
 
-    const std::string _months[12] = {
-        "January", "February", "March", "April", "May", "June",
-        "July", "August", "September", "October", "November", "December"
-    };
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TimePointColumns
+///  \brief         Struct-of-arrays representation of a batch of `TimePoint`s
+///                 produced by `DateTimeTransformer::transform`. Labels are not
+///                 stored, as they are available through the `TimePoint` label
+///                 tables and `DateTimeTransformer::holiday_name`. The columns
+///                 are resized (rather than reallocated) on each call, so a
+///                 single instance can be reused across batches without
+///                 additional heap allocations.
+///
+struct TimePointColumns {
+    std::vector<std::int32_t>               year;
+    std::vector<std::uint8_t>               month;
+    std::vector<std::uint8_t>               day;
+    std::vector<std::uint8_t>               hour;
+    std::vector<std::uint8_t>               minute;
+    std::vector<std::uint8_t>               second;
+    std::vector<std::uint8_t>               amPm;
+    std::vector<std::uint8_t>               hour12;
+    std::vector<std::uint8_t>               dayOfWeek;
+    std::vector<std::uint8_t>               dayOfQuarter;
+    std::vector<std::uint16_t>              dayOfYear;
+    std::vector<std::uint16_t>              weekOfMonth;
+    std::vector<std::uint8_t>               quarterOfYear;
+    std::vector<std::uint8_t>               halfOfYear;
+    std::vector<std::uint8_t>               weekIso;
+    std::vector<std::int32_t>               yearIso;
+    std::vector<std::uint32_t>              holidayId;      // `DateTimeTransformer::NoHolidayId` if the date isn't a holiday
+    std::vector<std::uint8_t>               isPaidTimeOff;
+
+    void resize(size_t numItems);
+    size_t size(void) const;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CalendarTable
+///  \brief         Calendar information for every day within a range of
+///                 years, indexed by the number of days since the epoch.
+///                 Converting a timestamp within that range is a single
+///                 lookup followed by time-of-day arithmetic.
+///
+class CalendarTable {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using GetHolidayIdFunc                  = std::function<std::uint32_t (std::int64_t midnightSecondsSinceEpoch)>;
+    using OutOfRangeFunc                    = std::function<void (size_t index)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // The range covered by the holiday data
+    static constexpr std::int32_t const     DefaultFirstYear = 1970;
+    static constexpr std::int32_t const     DefaultLastYear = 2099;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    CalendarTable(
+        std::int32_t firstYear=DefaultFirstYear,
+        std::int32_t lastYear=DefaultLastYear,
+        GetHolidayIdFunc const &getHolidayIdFunc=GetHolidayIdFunc()
+    );
+    ~CalendarTable(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(CalendarTable);
+
+    size_t size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns the day that contains `secondsSinceEpoch` (and
+    ///                 populates `secondsSinceMidnight`), or nullptr if the
+    ///                 timestamp is outside of the table's range.
+    ///
+    CalendarDay const * find(std::int64_t secondsSinceEpoch, std::uint32_t &secondsSinceMidnight) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            transform
+    ///  \brief         Populates the first `cItems` rows of `columns`. Rows whose
+    ///                 timestamps are outside of the table's range are left
+    ///                 untouched and passed to `outOfRangeFunc`.
+    ///
+    void transform(std::int64_t const *pSecondsSinceEpoch, size_t cItems, TimePointColumns &columns, OutOfRangeFunc const &outOfRangeFunc) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::int64_t const                      _firstDay;      // Days since the epoch
+    std::vector<CalendarDay> const          _days;
 };
 
+namespace Details {
+
+// Defined in DateTimeFeaturizer.cpp
+class HolidayTable;
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         DateTimeTransformer
 ///  \brief         A Transformer that takes a chrono::system_clock::time_point and
@@ -116,6 +303,13 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                          = Components::InferenceOnlyTransformerImpl<std::chrono::system_clock::time_point, TimePoint>;
 
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint32_t const    NoHolidayId = CalendarDay::NoHolidayId;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -136,22 +330,33 @@ public:
 
     void save(Archive & ar) const override;
 
-private:
-    // ----------------------------------------------------------------------
-    // |
-    // |  Private Types
-    // |
-    // ----------------------------------------------------------------------
-    using JsonStream                        = nlohmann::json;
-    using HolidayMap                        = std::unordered_map<std::int64_t, std::string>;
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            transform
+    ///  \brief         Converts a column of timestamps (seconds since the epoch)
+    ///                 into `columns`.
+    ///
+    void transform(std::int64_t const *pSecondsSinceEpoch, size_t cItems, TimePointColumns &columns) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            holiday_name
+    ///  \brief         Returns the name associated with a holiday id in
+    ///                 `TimePointColumns`.
+    ///
+    TimePointLabel holiday_name(std::uint32_t holidayId) const;
 
+private:
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
     std::string const                       _countryName;
-    HolidayMap const                        _dateHolidayMap;
+
+    // The holidays are shared by all transformers in the process that use the
+    // same country (`_holidays` is null when a country isn't provided) and the
+    // calendar is shared by all transformers.
+    std::shared_ptr<Details::HolidayTable const>        _holidays;
+    std::shared_ptr<CalendarTable const>                _calendar;
 
     // ----------------------------------------------------------------------
     // |
@@ -218,6 +423,22 @@ private:
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override;
 };
 
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <size_t N>
+TimePointLabel::TimePointLabel(char const (&value)[N]) :
+    _value(value),
+    _size(N - 1) {
+    static_assert(N != 0, "Labels must be null-terminated");
+}
+
 } // namespace Featurizers
 } // namespace Featurizer
 } // namespace Microsoft
@@ -0,0 +1,153 @@
+# ----------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License
+# ----------------------------------------------------------------------
+"""\
+Writes holiday data in the read-only binary format consumed by DateTimeTransformer.
+
+The file is generated from the '<country>.json' files in GeneratedCode as part of
+the build (see Featurizers/cmake/FeaturizersCode.cmake).
+
+All values are little-endian and every array is naturally aligned so that the
+file can be memory-mapped and used in place:
+
+    Header
+        char[4]         Magic ("FZHD")
+        uint32          Byte order mark (0x01020304)
+        uint16          Major version
+        uint16          Minor version
+        uint32          Number of countries
+        uint32          Number of strings
+        uint32          Number of holidays
+        uint32          Number of string characters
+
+    uint32[3][num_countries]    Country name string id, first holiday, number of holidays (sorted by name)
+    uint32[num_strings + 1]     Offset of each string (strings are null-terminated)
+    uint16[num_holidays]        Days since the epoch of each holiday (sorted within a country)
+    uint16[num_holidays]        Holiday name string id
+    char[num_chars]             String data
+"""
+
+import json
+import os
+import struct
+import sys
+
+# ----------------------------------------------------------------------
+MAGIC                                       = b"FZHD"
+BYTE_ORDER_MARK                             = 0x01020304
+MAJOR_VERSION                               = 1
+MINOR_VERSION                               = 0
+
+SECONDS_PER_DAY                             = 60 * 60 * 24
+
+# ----------------------------------------------------------------------
+def Write(output_filename, holidays_by_country):
+    """\
+    Writes the holiday data.
+
+    holidays_by_country: { "<country>" : [ (<seconds since epoch at midnight>, "<holiday name>"), ... ], ... }
+    """
+
+    strings = []
+    string_ids = {}
+
+    def GetStringId(value):
+        string_id = string_ids.get(value, None)
+        if string_id is None:
+            string_id = len(strings)
+            string_ids[value] = string_id
+            strings.append(value)
+
+        return string_id
+
+    countries = []
+    days = []
+    name_ids = []
+
+    for country in sorted(holidays_by_country.keys()):
+        holidays = sorted(holidays_by_country[country], key=lambda item: item[0])
+
+        countries.append((GetStringId(country), len(days), len(holidays)))
+
+        prev_day = None
+
+        for seconds, name in holidays:
+            if seconds % SECONDS_PER_DAY != 0:
+                raise Exception("'{}' is not at midnight ({})".format(seconds, country))
+
+            day = seconds // SECONDS_PER_DAY
+            if day < 0 or day > 0xFFFF:
+                raise Exception("'{}' is out of range ({})".format(seconds, country))
+
+            if day == prev_day:
+                raise Exception("'{}' is duplicated ({})".format(seconds, country))
+
+            prev_day = day
+
+            days.append(day)
+            name_ids.append(GetStringId(name))
+
+    if len(strings) > 0xFFFF:
+        raise Exception("There are too many strings")
+
+    encoded_strings = [value.encode("utf-8") + b"\0" for value in strings]
+
+    offsets = [0]
+    for encoded_string in encoded_strings:
+        offsets.append(offsets[-1] + len(encoded_string))
+
+    with open(output_filename, "wb") as f:
+        f.write(MAGIC)
+        f.write(
+            struct.pack(
+                "<IHHIIII",
+                BYTE_ORDER_MARK,
+                MAJOR_VERSION,
+                MINOR_VERSION,
+                len(countries),
+                len(strings),
+                len(days),
+                offsets[-1],
+            ),
+        )
+
+        for country in countries:
+            f.write(struct.pack("<III", *country))
+
+        f.write(struct.pack("<{}I".format(len(offsets)), *offsets))
+        f.write(struct.pack("<{}H".format(len(days)), *days))
+        f.write(struct.pack("<{}H".format(len(name_ids)), *name_ids))
+
+        for encoded_string in encoded_strings:
+            f.write(encoded_string)
+
+
+# ----------------------------------------------------------------------
+def WriteFromJsonFiles(json_dir, output_filename):
+    """Writes the holiday data based on the '<country>.json' files in a directory"""
+
+    holidays_by_country = {}
+
+    for filename in os.listdir(json_dir):
+        country, ext = os.path.splitext(filename)
+        if ext != ".json":
+            continue
+
+        with open(os.path.join(json_dir, filename)) as f:
+            content = json.load(f)
+
+        holidays_by_country[country] = list(zip(content["Date"], content["Holiday"]))
+
+    Write(output_filename, holidays_by_country)
+
+
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.stdout.write("Usage: {} <json dir> <output filename>\n".format(os.path.basename(sys.argv[0])))
+        sys.exit(-1)
+
+    WriteFromJsonFiles(sys.argv[1], sys.argv[2])
@@ -0,0 +1,332 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Components/HashedDocumentStatisticsEstimator.h"
+#include "Components/VocabularyIndex.h"
+#include "../Traits.h"
+#include "Structs.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedCountVectorizerTransformer
+///  \brief         Counts the terms within a document, where each term is
+///                 mapped to one of `numBuckets` columns by its hash rather
+///                 than by a vocabulary.
+///
+class HashedCountVectorizerTransformer : public StandardTransformer<std::string, SparseVectorEncoding<std::uint32_t>> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                           = StandardTransformer<std::string, SparseVectorEncoding<std::uint32_t>>;
+    using AnalyzerMethod                     = Components::AnalyzerMethod;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedCountVectorizerTransformer(std::uint32_t hashingSeedVal, std::uint32_t numBuckets, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max);
+    HashedCountVectorizerTransformer(Archive &ar);
+
+    ~HashedCountVectorizerTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HashedCountVectorizerTransformer);
+
+    void save(Archive &ar) const override;
+
+    bool operator==(HashedCountVectorizerTransformer const &other) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using ParseFunctionType                  = Components::ParseFunctionType;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint32_t const                      _hashingSeedVal;
+    std::uint32_t const                      _numBuckets;
+    bool const                               _binary;
+
+    bool const                               _lower;
+    AnalyzerMethod const                     _analyzer;
+    std::string const                        _regex;
+    std::uint32_t const                      _ngram_min;
+    std::uint32_t const                      _ngram_max;
+
+    ParseFunctionType const                  _parse_func;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        std::string const processedInput(Components::DocumentDecorator(input, _lower, _analyzer, _regex, _ngram_min, _ngram_max));
+        Components::TermCounts & termCounts(Components::TermCounts::GetThreadLocal(_numBuckets));
+
+        _parse_func(
+            processedInput,
+            [this, &termCounts] (std::string::const_iterator iter_start, std::string::const_iterator iter_end) {
+                termCounts.increment(Components::GetTermBucket(iter_start, iter_end, _hashingSeedVal, _numBuckets));
+            }
+        );
+
+        std::vector<SparseVectorEncoding<std::uint32_t>::ValueEncoding> result;
+
+        termCounts.flush(
+            [this, &result] (std::uint32_t bucket, std::uint32_t count) {
+                result.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(_binary ? 1 : count, bucket));
+            }
+        );
+
+        callback(SparseVectorEncoding<std::uint32_t>(_numBuckets, std::move(result)));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedCountVectorizerEstimator
+///  \brief         Creates a `HashedCountVectorizerTransformer` object. Unlike
+///                 `CountVectorizerEstimator`, no vocabulary is needed and
+///                 the estimator doesn't require training.
+///
+class HashedCountVectorizerEstimator : public TransformerEstimator<std::string, SparseVectorEncoding<std::uint32_t>> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                          = TransformerEstimator<std::string, SparseVectorEncoding<std::uint32_t>>;
+    using TransformerType                   = HashedCountVectorizerTransformer;
+    using AnalyzerMethod                    = Components::AnalyzerMethod;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedCountVectorizerEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        std::uint32_t hashingSeedVal,
+        std::uint32_t numBuckets,
+        bool lower,
+        AnalyzerMethod analyzer,
+        std::string regex,
+        std::uint32_t ngram_min,
+        std::uint32_t ngram_max,
+        bool binary
+    );
+    ~HashedCountVectorizerEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HashedCountVectorizerEstimator);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint32_t const                      _hashingSeedVal;
+    std::uint32_t const                      _numBuckets;
+    bool const                               _binary;
+
+    bool const                               _lower;
+    AnalyzerMethod const                     _analyzer;
+    std::string const                        _regex;
+    std::uint32_t const                      _ngram_min;
+    std::uint32_t const                      _ngram_max;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    bool begin_training_impl(void) override;
+
+    // MSVC has problems when the declaration and definition are separated
+    FitResult fit_impl(typename BaseType::InputType const *, size_t) override {
+        throw std::runtime_error("This should never be called as this class will not be used during training");
+    }
+
+    void complete_training_impl(void) override;
+
+    // MSVC has problems when the declaration and definition are separated
+    typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
+        return typename BaseType::TransformerUniquePtr(
+            new HashedCountVectorizerTransformer(_hashingSeedVal, _numBuckets, _binary, _lower, _analyzer, _regex, _ngram_min, _ngram_max)
+        );
+    }
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  HashedCountVectorizerTransformer
+// |
+// ----------------------------------------------------------------------
+inline HashedCountVectorizerTransformer::HashedCountVectorizerTransformer(std::uint32_t hashingSeedVal, std::uint32_t numBuckets, bool binary, bool lower, AnalyzerMethod analyzer, std::string regex, std::uint32_t ngram_min, std::uint32_t ngram_max) :
+    _hashingSeedVal(std::move(hashingSeedVal)),
+    _numBuckets(
+        std::move(
+            [&numBuckets](void) -> std::uint32_t & {
+                if(numBuckets == 0)
+                    throw std::invalid_argument("numBuckets");
+
+                return numBuckets;
+            }()
+        )),
+    _binary(std::move(binary)),
+    _lower(std::move(lower)),
+    _analyzer(std::move(analyzer)),
+    _regex(std::move(regex)),
+    _ngram_min(
+        std::move(
+            [&ngram_min](void) -> std::uint32_t & {
+                if(ngram_min == 0)
+                    throw std::invalid_argument("ngramRangeMin");
+
+                return ngram_min;
+            }()
+        )),
+    _ngram_max(
+        std::move(
+            [&ngram_max](void) -> std::uint32_t & {
+                if(ngram_max == 0)
+                    throw std::invalid_argument("ngramRangeMax");
+
+                return ngram_max;
+            }()
+        )),
+    _parse_func(
+        [this](void) -> ParseFunctionType {
+            ParseFunctionType parseFunc;
+            Components::DocumentParseFuncGenerator(parseFunc, _analyzer, _regex, _ngram_min, _ngram_max);
+            return parseFunc;
+        }()
+    ) {
+}
+
+inline HashedCountVectorizerTransformer::HashedCountVectorizerTransformer(Archive &ar) :
+    HashedCountVectorizerTransformer(
+        [&ar](void) {
+            // Version
+            std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
+            std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+            if(majorVersion != 1 || minorVersion != 0)
+                throw std::runtime_error("Unsupported archive version");
+
+            // Data
+            std::uint32_t          hashingSeedVal(Traits<std::uint32_t>::deserialize(ar));
+            std::uint32_t          numBuckets(Traits<std::uint32_t>::deserialize(ar));
+            bool                   binary(Traits<bool>::deserialize(ar));
+
+            bool                   lower(Traits<bool>::deserialize(ar));
+            AnalyzerMethod         analyzer(static_cast<AnalyzerMethod>(Traits<std::uint8_t>::deserialize(ar)));
+            std::string            regex(Traits<std::string>::deserialize(ar));
+            std::uint32_t          ngram_min(Traits<std::uint32_t>::deserialize(ar));
+            std::uint32_t          ngram_max(Traits<std::uint32_t>::deserialize(ar));
+
+            return HashedCountVectorizerTransformer(std::move(hashingSeedVal), std::move(numBuckets), std::move(binary), std::move(lower), std::move(analyzer), std::move(regex), std::move(ngram_min), std::move(ngram_max));
+        }()
+    ) {
+}
+
+inline void HashedCountVectorizerTransformer::save(Archive &ar) const /*override*/ {
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Data
+    Traits<decltype(_hashingSeedVal)>::serialize(ar, _hashingSeedVal);
+    Traits<decltype(_numBuckets)>::serialize(ar, _numBuckets);
+    Traits<decltype(_binary)>::serialize(ar, _binary);
+    Traits<decltype(_lower)>::serialize(ar, _lower);
+    Traits<std::underlying_type<AnalyzerMethod>::type>::serialize(ar, static_cast<std::underlying_type<AnalyzerMethod>::type>(_analyzer));
+    Traits<decltype(_regex)>::serialize(ar, _regex);
+    Traits<decltype(_ngram_min)>::serialize(ar, _ngram_min);
+    Traits<decltype(_ngram_max)>::serialize(ar, _ngram_max);
+}
+
+inline bool HashedCountVectorizerTransformer::operator==(HashedCountVectorizerTransformer const &other) const {
+    return _hashingSeedVal == other._hashingSeedVal
+        && _numBuckets == other._numBuckets
+        && _binary == other._binary
+        && _lower == other._lower
+        && _analyzer == other._analyzer
+        && _regex == other._regex
+        && _ngram_min == other._ngram_min
+        && _ngram_max == other._ngram_max;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  HashedCountVectorizerEstimator
+// |
+// ----------------------------------------------------------------------
+inline HashedCountVectorizerEstimator::HashedCountVectorizerEstimator(
+    AnnotationMapsPtr pAllColumnAnnotations,
+    std::uint32_t hashingSeedVal,
+    std::uint32_t numBuckets,
+    bool lower,
+    AnalyzerMethod analyzer,
+    std::string regex,
+    std::uint32_t ngram_min,
+    std::uint32_t ngram_max,
+    bool binary
+) :
+    BaseType("HashedCountVectorizerEstimator", std::move(pAllColumnAnnotations)),
+    _hashingSeedVal(std::move(hashingSeedVal)),
+    _numBuckets(
+        std::move(
+            [&numBuckets](void) -> std::uint32_t & {
+                if(numBuckets == 0)
+                    throw std::invalid_argument("numBuckets");
+
+                return numBuckets;
+            }()
+        )),
+    _binary(std::move(binary)),
+    _lower(std::move(lower)),
+    _analyzer(std::move(analyzer)),
+    _regex(std::move(regex)),
+    _ngram_min(std::move(ngram_min)),
+    _ngram_max(std::move(ngram_max)) {
+}
+
+inline bool HashedCountVectorizerEstimator::begin_training_impl(void) /*override*/ {
+    return false;
+}
+
+inline void HashedCountVectorizerEstimator::complete_training_impl(void) /*override*/ {
+}
+
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,587 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Components/HashedDocumentStatisticsEstimator.h"
+#include "TfidfVectorizerFeaturizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedTfidfVectorizerTransformer
+///  \brief         Returns the tf-idf values of the terms within a document,
+///                 where each term is mapped to one of `numBuckets` columns by
+///                 its hash rather than by a vocabulary. Terms that hash to a
+///                 bucket that wasn't encountered during training are ignored.
+///
+class HashedTfidfVectorizerTransformer : public StandardTransformer<std::string, SparseVectorEncoding<std::float_t>> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                           = StandardTransformer<std::string, SparseVectorEncoding<std::float_t>>;
+    using AnalyzerMethod                     = Components::AnalyzerMethod;
+    using NormMethod                         = TfidfVectorizerTransformer::NormMethod;
+    using TfidfPolicy                        = TfidfVectorizerTransformer::TfidfPolicy;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedTfidfVectorizerTransformer(
+        std::vector<std::uint32_t> documentFrequencies,
+        std::uint32_t totalNumDocus,
+        std::uint32_t hashingSeedVal,
+        NormMethod norm,
+        TfidfPolicy tfidfParameters,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax
+    );
+    explicit HashedTfidfVectorizerTransformer(Archive &ar);
+
+    ~HashedTfidfVectorizerTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HashedTfidfVectorizerTransformer);
+
+    void save(Archive &ar) const override;
+
+    bool operator==(HashedTfidfVectorizerTransformer const &other) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using ParseFunctionType                  = Components::ParseFunctionType;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<std::uint32_t> const         _documentFrequencies;      // One item per bucket
+    std::uint32_t const                      _totalNumDocuments;
+    std::uint32_t const                      _hashingSeedVal;
+    NormMethod const                         _norm;
+    TfidfPolicy const                        _tfidfParameters;
+
+    bool const                               _lowercase;
+    AnalyzerMethod const                     _analyzer;
+    std::string const                        _regexToken;
+    std::uint32_t const                      _ngramRangeMin;
+    std::uint32_t const                      _ngramRangeMax;
+
+    ParseFunctionType const                  _parseFunc;
+
+    // idf values for each bucket
+    std::vector<double> const                _idfs;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<double> create_idfs(void) const;
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        std::string const processedInput(Components::DocumentDecorator(input, _lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax));
+        Components::TermCounts & termCounts(Components::TermCounts::GetThreadLocal(_documentFrequencies.size()));
+
+        _parseFunc(
+            processedInput,
+            [this, &termCounts] (std::string::const_iterator iterStart, std::string::const_iterator iterEnd) {
+                std::uint32_t const bucket(Components::GetTermBucket(iterStart, iterEnd, _hashingSeedVal, static_cast<std::uint32_t>(_documentFrequencies.size())));
+
+                // Buckets that weren't encountered during training are treated
+                // like terms that aren't in the vocabulary.
+                if (_documentFrequencies[bucket] != 0)
+                    termCounts.increment(bucket);
+            }
+        );
+
+        std::float_t normVal = 0.0f;
+        std::vector<SparseVectorEncoding<std::float_t>::ValueEncoding> results;
+
+        termCounts.flush(
+            [this, &normVal, &results] (std::uint32_t bucket, std::uint32_t count) {
+                double tf;
+
+                if ((_tfidfParameters & TfidfPolicy::Binary) == TfidfPolicy::Binary) {
+                    tf = 1.0;
+                } else if (!((_tfidfParameters & TfidfPolicy::SublinearTf) == TfidfPolicy::SublinearTf)) {
+                    tf = count;
+                } else {
+                    tf = 1.0 + std::log(count);
+                }
+
+                std::float_t tfidf = static_cast<std::float_t>(tf * _idfs[bucket]);
+
+                if(_norm == NormMethod::L1) {
+                    assert(tfidf >= 0.0f);
+                    normVal += tfidf;
+                } else if (_norm == NormMethod::L2) {
+                    normVal += tfidf * tfidf;
+                }
+
+                results.emplace_back(tfidf, bucket);
+            }
+        );
+
+        if (_norm == NormMethod::L2)
+            normVal = std::sqrt(normVal);
+
+        std::vector<SparseVectorEncoding<std::float_t>::ValueEncoding> sparseVector;
+
+        sparseVector.reserve(results.size());
+
+        for (auto const & result : results) {
+            sparseVector.emplace_back(normVal > 0.0f ? result.Value / normVal : result.Value, result.Index);
+        }
+
+        callback(SparseVectorEncoding<std::float_t>(_documentFrequencies.size(), std::move(sparseVector)));
+    }
+};
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedTfidfVectorizerEstimatorImpl
+///  \brief         Estimator that uses the output of the
+///                 HashedDocumentStatisticsEstimator to create a
+///                 HashedTfidfVectorizerTransformer.
+///
+template <size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()>
+class HashedTfidfVectorizerEstimatorImpl : public TransformerEstimator<std::string, SparseVectorEncoding<std::float_t>> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                          = TransformerEstimator<std::string, SparseVectorEncoding<std::float_t>>;
+    using TransformerType                   = HashedTfidfVectorizerTransformer;
+    using NormMethod                        = HashedTfidfVectorizerTransformer::NormMethod;
+    using TfidfPolicy                       = HashedTfidfVectorizerTransformer::TfidfPolicy;
+    using AnalyzerMethod                    = HashedTfidfVectorizerTransformer::AnalyzerMethod;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedTfidfVectorizerEstimatorImpl(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        size_t colIndex,
+        std::uint32_t hashingSeedVal,
+        NormMethod norm,
+        TfidfPolicy tfidfParameters,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax
+    );
+    ~HashedTfidfVectorizerEstimatorImpl(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HashedTfidfVectorizerEstimatorImpl);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                             _colIndex;
+    std::uint32_t const                      _hashingSeedVal;
+    NormMethod const                         _norm;
+    TfidfPolicy const                        _tfidfParameters;
+
+    bool const                               _lowercase;
+    AnalyzerMethod const                     _analyzer;
+    std::string const                        _regexToken;
+    std::uint32_t const                      _ngramRangeMin;
+    std::uint32_t const                      _ngramRangeMax;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    bool begin_training_impl(void) override;
+
+    // MSVC has problems when the declaration and definition are separated
+    FitResult fit_impl(typename BaseType::InputType const *, size_t) override {
+        throw std::runtime_error("This should not be called");
+    }
+
+    void complete_training_impl(void) override;
+
+    // MSVC has problems when the declaration and definition are separated
+    typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
+        // ----------------------------------------------------------------------
+        using HashedDocumentStatisticsAnnotationData    = Components::HashedDocumentStatisticsAnnotationData;
+        using HashedDocumentStatisticsEstimator         = Components::HashedDocumentStatisticsEstimator<MaxNumTrainingItemsV>;
+        // ----------------------------------------------------------------------
+
+        HashedDocumentStatisticsAnnotationData const &  data(HashedDocumentStatisticsEstimator::get_annotation_data(BaseType::get_column_annotations(), _colIndex, Components::HashedDocumentStatisticsEstimatorName));
+
+        return typename BaseType::TransformerUniquePtr(
+            new HashedTfidfVectorizerTransformer(
+                data.DocumentFrequencies,
+                data.TotalNumDocuments,
+                _hashingSeedVal,
+                _norm,
+                _tfidfParameters,
+                _lowercase,
+                _analyzer,
+                _regexToken,
+                _ngramRangeMin,
+                _ngramRangeMax
+            )
+        );
+    }
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HashedTfidfVectorizerEstimator
+///  \brief         Creates a `HashedTfidfVectorizerTransformer` object. Training
+///                 only collects per-bucket document frequencies, so the memory
+///                 used is proportional to `numBuckets` rather than to the
+///                 size of the vocabulary.
+///
+template <size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()>
+class HashedTfidfVectorizerEstimator :
+    public Components::PipelineExecutionEstimatorImpl<
+        Components::HashedDocumentStatisticsEstimator<MaxNumTrainingItemsV>,
+        Details::HashedTfidfVectorizerEstimatorImpl<MaxNumTrainingItemsV>
+    > {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType =
+        Components::PipelineExecutionEstimatorImpl<
+            Components::HashedDocumentStatisticsEstimator<MaxNumTrainingItemsV>,
+            Details::HashedTfidfVectorizerEstimatorImpl<MaxNumTrainingItemsV>
+        >;
+
+    using AnalyzerMethod                = Components::AnalyzerMethod;
+    using NormMethod                    = HashedTfidfVectorizerTransformer::NormMethod;
+    using TfidfPolicy                   = HashedTfidfVectorizerTransformer::TfidfPolicy;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    HashedTfidfVectorizerEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        size_t colIndex,
+        std::uint32_t hashingSeedVal,
+        std::uint32_t numBuckets,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regex,
+        NormMethod norm = NormMethod::L2,
+        TfidfPolicy tfidfParameters = TfidfPolicy::UseIdf|TfidfPolicy::SmoothIdf,
+        std::uint32_t ngramRangeMin = 1,
+        std::uint32_t ngramRangeMax = 1
+    );
+    ~HashedTfidfVectorizerEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HashedTfidfVectorizerEstimator);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  HashedTfidfVectorizerTransformer
+// |
+// ----------------------------------------------------------------------
+inline HashedTfidfVectorizerTransformer::HashedTfidfVectorizerTransformer(
+    std::vector<std::uint32_t> documentFrequencies,
+    std::uint32_t totalNumDocus,
+    std::uint32_t hashingSeedVal,
+    NormMethod norm,
+    TfidfPolicy tfidfParameters,
+    bool lowercase,
+    AnalyzerMethod analyzer,
+    std::string regexToken,
+    std::uint32_t ngramRangeMin,
+    std::uint32_t ngramRangeMax
+) :
+    _documentFrequencies(
+        std::move(
+            [&documentFrequencies](void) -> std::vector<std::uint32_t> & {
+                if (documentFrequencies.empty())
+                    throw std::invalid_argument("documentFrequencies");
+
+                return documentFrequencies;
+            }()
+        )
+    ),
+    _totalNumDocuments(
+        std::move(
+            [&totalNumDocus](void) -> std::uint32_t & {
+                if (totalNumDocus == 0)
+                    throw std::invalid_argument("totalNumDocus");
+
+                return totalNumDocus;
+            }()
+        )
+    ),
+    _hashingSeedVal(std::move(hashingSeedVal)),
+    _norm(std::move(norm)),
+    _tfidfParameters(std::move(tfidfParameters)),
+    _lowercase(std::move(lowercase)),
+    _analyzer(std::move(analyzer)),
+    _regexToken(std::move(regexToken)),
+    _ngramRangeMin(
+        std::move(
+            [&ngramRangeMin](void) -> std::uint32_t & {
+                if (ngramRangeMin == 0)
+                    throw std::invalid_argument("ngramRangeMin");
+
+                return ngramRangeMin;
+            }()
+        )
+    ),
+    _ngramRangeMax(
+        std::move(
+            [&ngramRangeMax](void) -> std::uint32_t & {
+                if (ngramRangeMax == 0)
+                    throw std::invalid_argument("ngramRangeMax");
+
+                return ngramRangeMax;
+            }()
+        )
+    ),
+    _parseFunc(
+        [this](void) -> ParseFunctionType {
+            ParseFunctionType parseFunc;
+            Components::DocumentParseFuncGenerator(parseFunc, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax);
+            return parseFunc;
+        }()
+    ),
+    _idfs(create_idfs()) {
+}
+
+inline HashedTfidfVectorizerTransformer::HashedTfidfVectorizerTransformer(Archive &ar) :
+    HashedTfidfVectorizerTransformer(
+        [&ar](void) {
+            // Version
+            std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
+            std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+            if(majorVersion != 1 || minorVersion != 0)
+                throw std::runtime_error("Unsupported archive version");
+
+            // Data
+            std::vector<std::uint32_t>     documentFrequencies(Traits<std::vector<std::uint32_t>>::deserialize(ar));
+            std::uint32_t                  totalNumDocus(Traits<std::uint32_t>::deserialize(ar));
+            std::uint32_t                  hashingSeedVal(Traits<std::uint32_t>::deserialize(ar));
+            NormMethod                     norm(static_cast<NormMethod>(Traits<std::underlying_type<NormMethod>::type>::deserialize(ar)));
+            TfidfPolicy                    tfidfParameters(static_cast<TfidfPolicy>(Traits<std::underlying_type<TfidfPolicy>::type>::deserialize(ar)));
+            bool                           lowercase(Traits<bool>::deserialize(ar));
+            AnalyzerMethod                 analyzer(static_cast<AnalyzerMethod>(Traits<std::underlying_type<AnalyzerMethod>::type>::deserialize(ar)));
+            std::string                    regexToken(Traits<std::string>::deserialize(ar));
+            std::uint32_t                  ngramRangeMin(Traits<std::uint32_t>::deserialize(ar));
+            std::uint32_t                  ngramRangeMax(Traits<std::uint32_t>::deserialize(ar));
+
+            return HashedTfidfVectorizerTransformer(
+                std::move(documentFrequencies),
+                std::move(totalNumDocus),
+                std::move(hashingSeedVal),
+                std::move(norm),
+                std::move(tfidfParameters),
+                std::move(lowercase),
+                std::move(analyzer),
+                std::move(regexToken),
+                std::move(ngramRangeMin),
+                std::move(ngramRangeMax)
+            );
+        }()
+    ) {
+}
+
+inline void HashedTfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Data
+    Traits<decltype(_documentFrequencies)>::serialize(ar, _documentFrequencies);
+    Traits<decltype(_totalNumDocuments)>::serialize(ar, _totalNumDocuments);
+    Traits<decltype(_hashingSeedVal)>::serialize(ar, _hashingSeedVal);
+    Traits<std::underlying_type<NormMethod>::type>::serialize(ar, static_cast<std::underlying_type<NormMethod>::type>(_norm));
+    Traits<std::underlying_type<TfidfPolicy>::type>::serialize(ar, static_cast<std::underlying_type<TfidfPolicy>::type>(_tfidfParameters));
+    Traits<decltype(_lowercase)>::serialize(ar, _lowercase);
+    Traits<std::underlying_type<AnalyzerMethod>::type>::serialize(ar, static_cast<std::underlying_type<AnalyzerMethod>::type>(_analyzer));
+    Traits<decltype(_regexToken)>::serialize(ar, _regexToken);
+    Traits<decltype(_ngramRangeMin)>::serialize(ar, _ngramRangeMin);
+    Traits<decltype(_ngramRangeMax)>::serialize(ar, _ngramRangeMax);
+}
+
+inline bool HashedTfidfVectorizerTransformer::operator==(HashedTfidfVectorizerTransformer const &other) const {
+    return _documentFrequencies == other._documentFrequencies
+        && _totalNumDocuments == other._totalNumDocuments
+        && _hashingSeedVal == other._hashingSeedVal
+        && _norm == other._norm
+        && _tfidfParameters == other._tfidfParameters
+        && _lowercase == other._lowercase
+        && _analyzer == other._analyzer
+        && _regexToken == other._regexToken
+        && _ngramRangeMin == other._ngramRangeMin
+        && _ngramRangeMax == other._ngramRangeMax;
+}
+
+inline std::vector<double> HashedTfidfVectorizerTransformer::create_idfs(void) const {
+    std::vector<double>                     result;
+
+    result.reserve(_documentFrequencies.size());
+
+    for (std::uint32_t documentFrequency : _documentFrequencies) {
+        // See TfidfVectorizerTransformer::create_idfs for a description of these calculations
+        if (!((_tfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf)) {
+            result.emplace_back(1.0);
+        } else if ((_tfidfParameters & TfidfPolicy::SmoothIdf) == TfidfPolicy::SmoothIdf) {
+            result.emplace_back(1.0 + std::log((1 + _totalNumDocuments) / (1.0 + documentFrequency)));
+        } else {
+            result.emplace_back(1.0 + std::log((1 + _totalNumDocuments) / (0.0 + documentFrequency)));
+        }
+    }
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  HashedTfidfVectorizerEstimator
+// |
+// ----------------------------------------------------------------------
+template <size_t MaxNumTrainingItemsV>
+HashedTfidfVectorizerEstimator<MaxNumTrainingItemsV>::HashedTfidfVectorizerEstimator(
+    AnnotationMapsPtr pAllColumnAnnotations,
+    size_t colIndex,
+    std::uint32_t hashingSeedVal,
+    std::uint32_t numBuckets,
+    bool lowercase,
+    AnalyzerMethod analyzer,
+    std::string regex,
+    NormMethod norm,
+    TfidfPolicy tfidfParameters,
+    std::uint32_t ngramRangeMin,
+    std::uint32_t ngramRangeMax
+) :
+    BaseType(
+        "HashedTfidfVectorizerEstimator",
+        pAllColumnAnnotations,
+        [pAllColumnAnnotations, colIndex, hashingSeedVal, numBuckets, lowercase, analyzer, regex, ngramRangeMin, ngramRangeMax](void) {
+            return Components::HashedDocumentStatisticsEstimator<MaxNumTrainingItemsV>(
+                std::move(pAllColumnAnnotations),
+                std::move(colIndex),
+                std::move(lowercase),
+                std::move(analyzer),
+                std::move(regex),
+                std::move(ngramRangeMin),
+                std::move(ngramRangeMax),
+                std::move(hashingSeedVal),
+                std::move(numBuckets)
+            );
+        },
+        [pAllColumnAnnotations, colIndex, hashingSeedVal, &norm, &tfidfParameters, lowercase, analyzer, regex, ngramRangeMin, ngramRangeMax](void) {
+            return Details::HashedTfidfVectorizerEstimatorImpl<MaxNumTrainingItemsV>(
+                std::move(pAllColumnAnnotations),
+                std::move(colIndex),
+                std::move(hashingSeedVal),
+                std::move(norm),
+                std::move(tfidfParameters),
+                std::move(lowercase),
+                std::move(analyzer),
+                std::move(regex),
+                std::move(ngramRangeMin),
+                std::move(ngramRangeMax)
+            );
+        }
+    ) {
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Details::HashedTfidfVectorizerEstimatorImpl
+// |
+// ----------------------------------------------------------------------
+template <size_t MaxNumTrainingItemsV>
+Details::HashedTfidfVectorizerEstimatorImpl<MaxNumTrainingItemsV>::HashedTfidfVectorizerEstimatorImpl(
+    AnnotationMapsPtr pAllColumnAnnotations,
+    size_t colIndex,
+    std::uint32_t hashingSeedVal,
+    NormMethod norm,
+    TfidfPolicy tfidfParameters,
+    bool lowercase,
+    AnalyzerMethod analyzer,
+    std::string regexToken,
+    std::uint32_t ngramRangeMin,
+    std::uint32_t ngramRangeMax
+) :
+    BaseType("HashedTfidfVectorizerEstimatorImpl", std::move(pAllColumnAnnotations)),
+    _colIndex(
+        std::move(
+            [this, &colIndex](void) -> size_t & {
+                if(colIndex >= this->get_column_annotations().size())
+                    throw std::invalid_argument("colIndex");
+
+                return colIndex;
+            }()
+        )
+    ),
+    _hashingSeedVal(std::move(hashingSeedVal)),
+    _norm(std::move(norm)),
+    _tfidfParameters(std::move(tfidfParameters)),
+    _lowercase(std::move(lowercase)),
+    _analyzer(std::move(analyzer)),
+    _regexToken(std::move(regexToken)),
+    _ngramRangeMin(std::move(ngramRangeMin)),
+    _ngramRangeMax(std::move(ngramRangeMax)) {
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <size_t MaxNumTrainingItemsV>
+bool Details::HashedTfidfVectorizerEstimatorImpl<MaxNumTrainingItemsV>::begin_training_impl(void) /*override*/ {
+    return false;
+}
+
+template <size_t MaxNumTrainingItemsV>
+void Details::HashedTfidfVectorizerEstimatorImpl<MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
+}
+
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
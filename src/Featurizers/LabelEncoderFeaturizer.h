@@ -51,6 +51,20 @@ public:
 
     bool operator==(LabelEncoderTransformer const &other) const;
 
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
+        typename IndexMap::const_iterator const         iter(Labels.find(input));
+
+        if(iter == Labels.end()) {
+            if(AllowMissingValues)
+                return 0;
+
+            throw std::invalid_argument("'input' was not found");
+        }
+
+        return iter->second + (AllowMissingValues ? 1 : 0);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -60,18 +74,27 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        typename IndexMap::const_iterator const         iter(Labels.find(input));
+        callback(transform(input));
+    }
 
-        if(iter == Labels.end()) {
-            if(AllowMissingValues) {
-                callback(0);
-                return;
+    // MSVC has problems when the definition and declaration are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        std::uint32_t const                             offset(AllowMissingValues ? 1 : 0);
+        typename IndexMap::const_iterator const         iterEnd(Labels.end());
+
+        for(size_t i = 0; i < cInputs; ++i) {
+            typename IndexMap::const_iterator const     iter(Labels.find(pInputs[i]));
+
+            if(iter == iterEnd) {
+                if(AllowMissingValues == false)
+                    throw std::invalid_argument("'input' was not found");
+
+                pOutputs[i] = 0;
+                continue;
             }
 
-            throw std::invalid_argument("'input' was not found");
+            pOutputs[i] = iter->second + offset;
         }
-
-        callback(iter->second + (AllowMissingValues ? 1 : 0));
     }
 };
 
@@ -10,6 +10,7 @@
 
 #include "Components/MaxAbsValueEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "Components/ScaleKernels.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -54,6 +55,8 @@ public:
 
     void save(Archive & ar) const override;
 
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -61,6 +64,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
 };
 
 namespace Details {
@@ -228,27 +232,49 @@ void MaxAbsScalarTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
     Traits<decltype(Scale)>::serialize(ar, Scale);
 }
 
+template <typename InputT, typename TransformedT>
+typename MaxAbsScalarTransformer<InputT, TransformedT>::BaseType::TransformedType MaxAbsScalarTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    if (Scale != static_cast<TransformedT>(0))
+        return static_cast<TransformedT>(input) / Scale;
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+
+    return static_cast<TransformedT>(input);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void MaxAbsScalarTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void MaxAbsScalarTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if (Scale != static_cast<TransformedT>(0)) {
-        callback(static_cast<TransformedT>(input) / Scale);
-        return;
-    }
+    // Dividing by 1 (and subtracting 0) doesn't change the value, so the zero
+    // scale case is handled by the same kernel.
+    TransformedT const                      divisor(Scale != static_cast<TransformedT>(0) ? Scale : static_cast<TransformedT>(1));
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
 
-    callback(static_cast<TransformedT>(input));
+    Components::ShiftAndScale(pInputs, cInputs, pOutputs, static_cast<TransformedT>(0), divisor);
 }
 
 
@@ -95,6 +95,10 @@ struct ShouldInterpolateValues {
 ///  \brief         Creates a `Transformer` that populates null values with the
 ///                 median value encountered during training.
 ///
+///                 When `maxRankError` is not 0, an approximate median is
+///                 calculated using memory that is independent of the number
+///                 of training items (see `Components::MedianEstimator`).
+///
 template <
     typename InputT,
     typename TransformedT,
@@ -126,7 +130,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex);
+    MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, std::float_t maxRankError=0.0f);
     ~MedianImputerEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MedianImputerEstimator);
@@ -186,11 +190,11 @@ void Details::MedianImputerEstimatorImpl<InputT, TransformedT, InterpolateValues
 // |
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT, bool InterpolateValuesV, size_t MaxNumTrainingItemsV>
-MedianImputerEstimator<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>::MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex) :
+MedianImputerEstimator<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>::MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, std::float_t maxRankError) :
     BaseType(
         "MedianImputerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::MedianEstimator<typename Traits<InputT>::nullable_type, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex, maxRankError](void) { return Components::MedianEstimator<typename Traits<InputT>::nullable_type, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), true, std::move(maxRankError)); },
         [pAllColumnAnnotations, colIndex](void) { return Details::MedianImputerEstimatorImpl<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); }
     ) {
 }
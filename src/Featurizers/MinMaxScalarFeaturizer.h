@@ -6,6 +6,7 @@
 
 #include "Components/MinMaxEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "Components/ScaleKernels.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -46,6 +47,8 @@ public:
 
     void save(Archive &ar) const override;
 
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -62,11 +65,19 @@ private:
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
 
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type);
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type);
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::true_type /*is_nullable*/) const;
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::false_type /*is_nullable*/) const;
 
     template <typename U>
-    void execute_implex(U const &input, typename BaseType::CallbackFunction const &callback);
+    typename BaseType::TransformedType transform_value(U const &input) const;
+
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::true_type /*is_arithmetic*/);
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::false_type /*is_arithmetic*/);
+
+    void execute_batch_loop(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::true_type /*is_nullable*/);
+    void execute_batch_loop(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::false_type /*is_nullable*/);
 };
 
 namespace Details {
@@ -250,37 +261,124 @@ void MinMaxScalarTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
     Traits<decltype(_span)>::serialize(ar, _min + _span);
 }
 
+template <typename InputT, typename TransformedT>
+typename MinMaxScalarTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalarTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
+    return transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void MinMaxScalarTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    execute_impl(input, callback, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+    callback(transform(input));
 }
 
 template <typename InputT, typename TransformedT>
-void MinMaxScalarTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type) {
+typename MinMaxScalarTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalarTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::true_type /*is_nullable*/) const {
     // ----------------------------------------------------------------------
     using InputTraits                       = Traits<InputT>;
     using TransformedTraits                 = Traits<TransformedT>;
     // ----------------------------------------------------------------------
 
-    if(InputTraits::IsNull(input)) {
-        callback(TransformedTraits::CreateNullValue());
+    if(InputTraits::IsNull(input))
+        return TransformedTraits::CreateNullValue();
+
+    return transform_value(InputTraits::GetNullableValue(input));
+}
+
+template <typename InputT, typename TransformedT>
+typename MinMaxScalarTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalarTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::false_type /*is_nullable*/) const {
+    return transform_value(input);
+}
+
+template <typename InputT, typename TransformedT>
+template <typename U>
+typename MinMaxScalarTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalarTransformer<InputT, TransformedT>::transform_value(U const &input) const {
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    if(_span == static_cast<InputT>(0))
+        return static_cast<TransformedT>(0);
+
+    return (static_cast<TransformedT>(input) - _min) / _span;
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+}
+
+template <typename InputT, typename TransformedT>
+void MinMaxScalarTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    execute_batch_impl(pInputs, cInputs, pOutputs, std::integral_constant<bool, std::is_arithmetic<InputT>::value && std::is_arithmetic<TransformedT>::value>());
+}
+
+template <typename InputT, typename TransformedT>
+void MinMaxScalarTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::true_type /*is_arithmetic*/) {
+    // ----------------------------------------------------------------------
+    using ComputeType                       = typename std::common_type<TransformedT, InputT>::type;
+    // ----------------------------------------------------------------------
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    // Null (NaN) inputs still produce null outputs when the span is 0
+    if(_span == static_cast<InputT>(0)) {
+        execute_batch_loop(pInputs, cInputs, pOutputs, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
         return;
     }
 
-    execute_implex(InputTraits::GetNullableValue(input), callback);
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+
+    // NaN inputs propagate through the kernel, so null inputs produce null outputs
+    Components::ShiftAndScale(pInputs, cInputs, pOutputs, static_cast<ComputeType>(_min), static_cast<ComputeType>(_span));
 }
 
 template <typename InputT, typename TransformedT>
-void MinMaxScalarTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type) {
-    execute_implex(input, callback);
+void MinMaxScalarTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::false_type /*is_arithmetic*/) {
+    execute_batch_loop(pInputs, cInputs, pOutputs, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
 }
 
 template <typename InputT, typename TransformedT>
-template <typename U>
-void MinMaxScalarTransformer<InputT, TransformedT>::execute_implex(U const &input, typename BaseType::CallbackFunction const &callback) {
+void MinMaxScalarTransformer<InputT, TransformedT>::execute_batch_loop(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::true_type /*is_nullable*/) {
+    // ----------------------------------------------------------------------
+    using InputTraits                       = Traits<InputT>;
+    using TransformedTraits                 = Traits<TransformedT>;
+    // ----------------------------------------------------------------------
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    bool const                              isZeroSpan(_span == static_cast<InputT>(0));
+
+    for(size_t i = 0; i < cInputs; ++i) {
+        typename BaseType::InputType const &            input(pInputs[i]);
+
+        if(InputTraits::IsNull(input))
+            pOutputs[i] = TransformedTraits::CreateNullValue();
+        else if(isZeroSpan)
+            pOutputs[i] = static_cast<TransformedT>(0);
+        else
+            pOutputs[i] = (static_cast<TransformedT>(InputTraits::GetNullableValue(input)) - _min) / _span;
+    }
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+}
+
+template <typename InputT, typename TransformedT>
+void MinMaxScalarTransformer<InputT, TransformedT>::execute_batch_loop(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::false_type /*is_nullable*/) {
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wdouble-promotion"
@@ -288,11 +386,14 @@ void MinMaxScalarTransformer<InputT, TransformedT>::execute_implex(U const &inpu
 #endif
 
     if(_span == static_cast<InputT>(0)) {
-        callback(static_cast<TransformedT>(0));
+        for(size_t i = 0; i < cInputs; ++i)
+            pOutputs[i] = static_cast<TransformedT>(0);
+
         return;
     }
 
-    callback((static_cast<TransformedT>(input) - _min) / _span);
+    for(size_t i = 0; i < cInputs; ++i)
+        pOutputs[i] = (static_cast<TransformedT>(pInputs[i]) - _min) / _span;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
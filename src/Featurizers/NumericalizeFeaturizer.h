@@ -44,6 +44,18 @@ public:
 
     bool operator==(NumericalizeTransformer const &other) const;
 
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const& input) const {
+        typename IndexMap::const_iterator const         iter(labels_.find(input));
+        double result = 0.;
+        if(iter != labels_.end()) {
+            result = iter->second;
+        } else {
+            result = std::numeric_limits<double>::quiet_NaN();
+        }
+        return result;
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -53,14 +65,12 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const& input, typename BaseType::CallbackFunction const& callback) override {
-        typename IndexMap::const_iterator const         iter(labels_.find(input));
-        double result = 0.;
-        if(iter != labels_.end()) {
-            result = iter->second;
-        } else {
-            result = std::numeric_limits<double>::quiet_NaN();
-        }
-        callback(result);
+        callback(transform(input));
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        BaseType::execute_batch_transform(*this, pInputs, cInputs, pOutputs);
     }
 
 private:
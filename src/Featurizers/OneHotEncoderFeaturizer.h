@@ -52,15 +52,8 @@ public:
 
     void save(Archive &ar) const override;
 
-private:
-    // ----------------------------------------------------------------------
-    // |
-    // |  Private Methods
-    // |
-    // ----------------------------------------------------------------------
-
     // MSVC has problems when the definition and declaration are separated
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
         // when missing values are allowed, the total size is increased by 1 and the 0th element in the vector represent missing values
         std::uint64_t const                 offset(AllowMissingValues ? 1 : 0);
 
@@ -78,7 +71,24 @@ private:
         else
             encodingIndex = static_cast<std::uint64_t>(label_iter->second + offset);
 
-        callback(SingleValueSparseVectorEncoding<std::uint8_t>(Labels.size() + offset, 1, encodingIndex));
+        return SingleValueSparseVectorEncoding<std::uint8_t>(Labels.size() + offset, 1, encodingIndex);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        BaseType::execute_batch_transform(*this, pInputs, cInputs, pOutputs);
     }
 };
 
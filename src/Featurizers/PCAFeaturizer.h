@@ -7,6 +7,8 @@
 #include "../Featurizer.h"
 #include "../Archive.h"
 
+#include <thread>
+
 namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
@@ -18,6 +20,10 @@ namespace Featurizers {
 ///                 matrix for dimensionality reduction, also provides
 ///                 PCAComponents retriving
 ///
+///                 When loaded from a memory-mapped `Archive`, the components
+///                 are used in place rather than copied (see
+///                 `Archive::deserialize_array`).
+///
 template <
     typename InputEigenMatrixT,
     typename OutputEigenMatrixT = typename InputMatrixTypeMapper<InputEigenMatrixT>::OutType
@@ -53,18 +59,30 @@ public:
     std::ptrdiff_t getEigenVectorColsNumber() const;
 
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using Scalar                            = typename EigenMatrix::Scalar;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    EigenMatrix const                       _eigenvectors;
+
+    // Eigenvectors in the storage order of `EigenMatrix`
+    ArchiveArray<Scalar>                    _eigenvectorData;
+    Eigen::Map<EigenMatrix const> const     _eigenvectors;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    PCATransformer(ArchiveArray<Scalar> eigenvectorData, std::ptrdiff_t rows, std::ptrdiff_t cols);
+
      // MSVC has problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
         if (input.size() == 0)
@@ -80,9 +98,94 @@ private:
     }
 };
 
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CovarianceAccumulator
+///  \brief         Accumulates the number of rows, the column means and the
+///                 scatter matrix (the sum of the outer products of the
+///                 centered rows) of a matrix that is provided in chunks.
+///
+///                 Chunks are processed in blocks of at most `BlockRows` rows
+///                 and merged with the pairwise update described by Chan,
+///                 Golub and LeVeque, so the memory used is proportional to
+///                 features^2 regardless of the number of rows and the
+///                 results don't suffer from the cancellation of the naive
+///                 sum-of-squares formulation.
+///
+template <typename EigenMatrixT>
+class CovarianceAccumulator {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Scalar                            = typename EigenMatrixT::Scalar;
+    using RowVector                         = Eigen::Matrix<Scalar, 1, Eigen::Dynamic>;
+    using SquareMatrix                      = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::ptrdiff_t const   BlockRows = 1024;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    CovarianceAccumulator(void);
+
+    std::uint64_t numRows(void) const;
+    RowVector const & mean(void) const;
+    SquareMatrix const & scatter(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            update
+    ///  \brief         Adds rows [rowBegin, rowEnd) of the matrix.
+    ///
+    template <typename MatrixT>
+    void update(MatrixT const &matrix, std::ptrdiff_t rowBegin, std::ptrdiff_t rowEnd);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            merge
+    ///  \brief         Adds the rows accumulated by another instance.
+    ///
+    void merge(CovarianceAccumulator const &other);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint64_t                           _numRows;
+    RowVector                               _mean;
+    SquareMatrix                            _scatter;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void merge(std::uint64_t numRows, RowVector const &mean, SquareMatrix const &scatter);
+};
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         PCAEstimator
-///  \brief         Estimator to calculate PCAComponents
+///  \brief         Estimator to calculate PCAComponents.
+///
+///                 Any number of matrices (each containing a chunk of the
+///                 training rows) may be provided across calls to `fit`;
+///                 the mean and covariance are accumulated incrementally
+///                 and the components are calculated when training is
+///                 complete. Rows of large matrices are distributed across
+///                 `numThreads` workers.
 ///
 template <
     typename InputEigenMatrixT,
@@ -104,7 +207,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex);
+    PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, std::uint32_t numThreads=1);
     ~PCAEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(PCAEstimator);
@@ -118,6 +221,7 @@ private:
     using EigenMatrix                       = typename InputMatrixTypeMapper<InputEigenMatrixT>::MatrixType;
     using SelfAdjointEigenSolver            = Eigen::SelfAdjointEigenSolver<EigenMatrix>;
     using EigenVectors                      = typename SelfAdjointEigenSolver::EigenvectorsType;
+    using Accumulator                       = Details::CovarianceAccumulator<EigenMatrix>;
 
     // ----------------------------------------------------------------------
     // |
@@ -125,7 +229,9 @@ private:
     // |
     // ----------------------------------------------------------------------
     size_t const                            _colIndex;
+    std::uint32_t const                     _numThreads;
 
+    Accumulator                             _accumulator;
     EigenVectors                            _eigenVectors;
 
     // ----------------------------------------------------------------------
@@ -137,29 +243,17 @@ private:
 
     // MSVC has problems when the declaration and definition are separated
     FitResult fit_impl(typename BaseType::InputType const *pBuffer, size_t cElements) override {
-        if(cElements != 1)
-            throw std::runtime_error("Only 1 matrix can be provided");
-
-        auto const &                        matrix(*pBuffer);
-
-        SelfAdjointEigenSolver              eig(
-            [&matrix]() {
-                //compute for centered training data
-                EigenMatrix                 centered = matrix.rowwise() - matrix.colwise().mean();
+        typename BaseType::InputType const * const          pEndBuffer(pBuffer + cElements);
 
-                //compute for covariance matrix
-                EigenMatrix                 cov = centered.adjoint() * centered;
+        while(pBuffer != pEndBuffer)
+            fit_matrix(*pBuffer++);
 
-                //using covariance matrix to compute PCA
-                return cov;
-            }()
-        );
-
-        _eigenVectors = eig.eigenvectors();
-
-        return FitResult::Complete;
+        return FitResult::Continue;
     }
 
+    template <typename MatrixT>
+    void fit_matrix(MatrixT const &matrix);
+
     void complete_training_impl(void) override;
 
     // MSVC has problems when the definition is separate from the declaration
@@ -185,9 +279,11 @@ private:
 // ----------------------------------------------------------------------
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::PCATransformer(EigenMatrix eigenvectors) :
-    _eigenvectors(std::move(eigenvectors)) {
-    if(_eigenvectors.size() == 0)
-        throw std::invalid_argument("eigenvectors");
+    PCATransformer(
+        ArchiveArray<Scalar>(std::vector<Scalar>(eigenvectors.data(), eigenvectors.data() + eigenvectors.size())),
+        eigenvectors.rows(),
+        eigenvectors.cols()
+    ) {
 }
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
@@ -198,17 +294,44 @@ PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::PCATransformer(Archive &a
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 1)
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            EigenMatrix                     eigenvectors(Traits<EigenMatrix>::deserialize(ar));
 
-            return PCATransformer(std::move(eigenvectors));
+            // Starting with 1.1, the eigenvectors are serialized as an aligned
+            // array so that they can be used in place from a memory-mapped
+            // archive.
+            if(minorVersion == 0)
+                return PCATransformer(Traits<EigenMatrix>::deserialize(ar));
+
+            std::uint64_t                   rows(Traits<std::uint64_t>::deserialize(ar));
+            std::uint64_t                   cols(Traits<std::uint64_t>::deserialize(ar));
+            ArchiveArray<Scalar>            data(ar.template deserialize_array<Scalar>());
+
+            if(rows > static_cast<std::uint64_t>(std::numeric_limits<std::ptrdiff_t>::max()) || cols > static_cast<std::uint64_t>(std::numeric_limits<std::ptrdiff_t>::max()))
+                throw std::runtime_error("Invalid eigenvectors");
+
+            return PCATransformer(std::move(data), static_cast<std::ptrdiff_t>(rows), static_cast<std::ptrdiff_t>(cols));
         }()
     ) {
 }
 
+template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
+PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::PCATransformer(ArchiveArray<Scalar> eigenvectorData, std::ptrdiff_t rows, std::ptrdiff_t cols) :
+    _eigenvectorData(
+        std::move(
+            [&eigenvectorData, &rows, &cols](void) -> ArchiveArray<Scalar> & {
+                if(eigenvectorData.empty() || rows <= 0 || cols <= 0 || eigenvectorData.size() / static_cast<size_t>(rows) != static_cast<size_t>(cols) || eigenvectorData.size() % static_cast<size_t>(rows) != 0)
+                    throw std::invalid_argument("eigenvectors");
+
+                return eigenvectorData;
+            }()
+        )
+    ),
+    _eigenvectors(_eigenvectorData.data(), rows, cols) {
+}
+
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 bool PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::operator==(PCATransformer const &other) const {
     if ((this->_eigenvectors - other._eigenvectors).norm() > 0.000001f)
@@ -221,10 +344,12 @@ template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 void PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::save(Archive &ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, 1); // Minor
 
     // Data
-    Traits<decltype(_eigenvectors)>::serialize(ar, _eigenvectors);
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(_eigenvectors.rows()));
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(_eigenvectors.cols()));
+    ar.serialize_array(_eigenvectorData.data(), _eigenvectorData.size());
 }
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
@@ -237,13 +362,89 @@ std::ptrdiff_t PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::getEigenVe
     return _eigenvectors.cols();
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  Details::CovarianceAccumulator
+// |
+// ----------------------------------------------------------------------
+template <typename EigenMatrixT>
+constexpr std::ptrdiff_t const Details::CovarianceAccumulator<EigenMatrixT>::BlockRows;
+
+template <typename EigenMatrixT>
+Details::CovarianceAccumulator<EigenMatrixT>::CovarianceAccumulator(void) :
+    _numRows(0) {
+}
+
+template <typename EigenMatrixT>
+std::uint64_t Details::CovarianceAccumulator<EigenMatrixT>::numRows(void) const {
+    return _numRows;
+}
+
+template <typename EigenMatrixT>
+typename Details::CovarianceAccumulator<EigenMatrixT>::RowVector const & Details::CovarianceAccumulator<EigenMatrixT>::mean(void) const {
+    return _mean;
+}
+
+template <typename EigenMatrixT>
+typename Details::CovarianceAccumulator<EigenMatrixT>::SquareMatrix const & Details::CovarianceAccumulator<EigenMatrixT>::scatter(void) const {
+    return _scatter;
+}
+
+template <typename EigenMatrixT>
+template <typename MatrixT>
+void Details::CovarianceAccumulator<EigenMatrixT>::update(MatrixT const &matrix, std::ptrdiff_t rowBegin, std::ptrdiff_t rowEnd) {
+    assert(rowBegin >= 0 && rowBegin <= rowEnd && rowEnd <= matrix.rows());
+
+    while(rowBegin != rowEnd) {
+        std::ptrdiff_t const                numBlockRows(std::min(BlockRows, rowEnd - rowBegin));
+        auto const                          block(matrix.middleRows(rowBegin, numBlockRows));
+        RowVector const                     blockMean(block.colwise().mean());
+        EigenMatrixT const                  centered(block.rowwise() - blockMean);
+
+        merge(static_cast<std::uint64_t>(numBlockRows), blockMean, centered.adjoint() * centered);
+
+        rowBegin += numBlockRows;
+    }
+}
+
+template <typename EigenMatrixT>
+void Details::CovarianceAccumulator<EigenMatrixT>::merge(CovarianceAccumulator const &other) {
+    if(other._numRows == 0)
+        return;
+
+    merge(other._numRows, other._mean, other._scatter);
+}
+
+template <typename EigenMatrixT>
+void Details::CovarianceAccumulator<EigenMatrixT>::merge(std::uint64_t numRows, RowVector const &mean, SquareMatrix const &scatter) {
+    if(_numRows == 0) {
+        _numRows = numRows;
+        _mean = mean;
+        _scatter = scatter;
+        return;
+    }
+
+    if(mean.cols() != _mean.cols())
+        throw std::invalid_argument("Input matrix cols() invalid");
+
+    std::uint64_t const                     totalRows(_numRows + numRows);
+    RowVector const                         delta(mean - _mean);
+    Scalar const                            thisRows(static_cast<Scalar>(_numRows));
+    Scalar const                            otherRows(static_cast<Scalar>(numRows));
+    Scalar const                            newRows(static_cast<Scalar>(totalRows));
+
+    _scatter += scatter + delta.adjoint() * delta * (thisRows * otherRows / newRows);
+    _mean += delta * (otherRows / newRows);
+    _numRows = totalRows;
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  PCAEstimator
 // |
 // ----------------------------------------------------------------------
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
-PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex) :
+PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, std::uint32_t numThreads) :
     BaseType("SVDEstimatorImpl", std::move(pAllColumnAnnotations)),
     _colIndex(
         std::move(
@@ -254,6 +455,16 @@ PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::PCAEs
                 return colIndex;
             }()
         )
+    ),
+    _numThreads(
+        std::move(
+            [&numThreads](void) -> std::uint32_t & {
+                if(numThreads == 0)
+                    throw std::invalid_argument("numThreads");
+
+                return numThreads;
+            }()
+        )
     ) {
 }
 
@@ -265,8 +476,81 @@ bool PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::
     return true;
 }
 
+template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
+template <typename MatrixT>
+void PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::fit_matrix(MatrixT const &matrix) {
+    // Starting threads isn't worth it for small matrices
+    static constexpr std::ptrdiff_t const   MinRowsPerThread = Accumulator::BlockRows;
+
+    if(matrix.size() == 0)
+        throw std::invalid_argument("Input matrix size() invalid");
+
+    if(_accumulator.numRows() != 0 && matrix.cols() != _accumulator.mean().cols())
+        throw std::invalid_argument("Input matrix cols() invalid");
+
+    std::ptrdiff_t const                    numRows(matrix.rows());
+    std::ptrdiff_t const                    numThreads(std::min(static_cast<std::ptrdiff_t>(_numThreads), numRows / MinRowsPerThread));
+
+    if(numThreads <= 1) {
+        _accumulator.update(matrix, 0, numRows);
+        return;
+    }
+
+    std::vector<Accumulator>                accumulators(static_cast<size_t>(numThreads));
+    std::vector<std::exception_ptr>         exceptions(static_cast<size_t>(numThreads));
+    std::vector<std::thread>                threads;
+
+    threads.reserve(static_cast<size_t>(numThreads));
+
+    try {
+        for(std::ptrdiff_t threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+            std::ptrdiff_t const            rowBegin(numRows * threadIndex / numThreads);
+            std::ptrdiff_t const            rowEnd(numRows * (threadIndex + 1) / numThreads);
+
+            threads.emplace_back(
+                [&matrix, &accumulators, &exceptions, threadIndex, rowBegin, rowEnd](void) {
+                    try {
+                        accumulators[static_cast<size_t>(threadIndex)].update(matrix, rowBegin, rowEnd);
+                    }
+                    catch(...) {
+                        exceptions[static_cast<size_t>(threadIndex)] = std::current_exception();
+                    }
+                }
+            );
+        }
+    }
+    catch(...) {
+        // The threads that were started must be joined before they are destroyed
+        for(auto &thread : threads)
+            thread.join();
+
+        throw;
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    for(auto const &exception : exceptions) {
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+
+    // Merge in a consistent order so that the results don't depend on thread scheduling
+    for(auto const &accumulator : accumulators)
+        _accumulator.merge(accumulator);
+}
+
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
 void PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
+    if(_accumulator.numRows() == 0)
+        throw std::runtime_error("No matrices were provided during training");
+
+    // The scatter matrix is proportional to the covariance matrix, which is
+    // sufficient for calculating the principal components
+    SelfAdjointEigenSolver                  eig(EigenMatrix(_accumulator.scatter()));
+
+    _eigenVectors = eig.eigenvectors();
+    _accumulator = Accumulator();
 }
 
 } // namespace Featurizers
@@ -4,9 +4,9 @@
 // ----------------------------------------------------------------------
 #pragma once
 
-#include "Components/MedianEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
-#include "Components/StatisticalMetricsEstimator.h"
+#include "Components/QuantileEstimator.h"
+#include "Components/ScaleKernels.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -51,6 +51,8 @@ public:
 
     void save(Archive &ar) const override;
 
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -58,14 +60,16 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
 };
 
 namespace Details {
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         RobustScalarEstimatorImpl
-///  \brief         This class retrieves a RobustScalarNormAnnotation and computes
-///                 the scale.
+///  \brief         This class retrieves a QuantileAnnotationData and computes
+///                 the median and the scale (the distance between the qRangeMin
+///                 and qRangeMax percentiles).
 ///
 template <
     typename InputT,
@@ -115,40 +119,26 @@ private:
     // MSVC runs into problems when separating the definition for this method
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
         // ----------------------------------------------------------------------
-        using MedianEstimator                           = Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>;
-        using MedianAnnotationData                      = Components::MedianAnnotationData<TransformedT>;
-
-        using StatisticalMetricsEstimator               = Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>;
-        using StatisticalMetricsAnnoationData           = typename StatisticalMetricsEstimator::AnnotationData;
+        using QuantileEstimator                         = Components::QuantileEstimator<InputT, TransformedT, MaxNumTrainingItemsV>;
+        using QuantileAnnotationData                    = Components::QuantileAnnotationData<TransformedT>;
         // ----------------------------------------------------------------------
 
-        TransformedT                        median(static_cast<TransformedT>(0.0));
+        QuantileAnnotationData const &      data(QuantileEstimator::get_annotation_data(BaseType::get_column_annotations(), _colIndex, Components::QuantileEstimatorName));
 
-        if(_withCentering) {
-            MedianAnnotationData const &                medianData(MedianEstimator::get_annotation_data(BaseType::get_column_annotations(), _colIndex, Components::MedianEstimatorName));
+        TransformedT                        median(static_cast<TransformedT>(0.0));
 
-            median = medianData.Median;
-        }
+        if(_withCentering)
+            median = static_cast<TransformedT>(data.Sketch.interpolated_quantile(0.5));
 
         TransformedT                        scale(static_cast<TransformedT>(1.0));
 
         if(Traits<float>::IsNull(_qRangeMin) == false) {
-            float const                     qRangeRatio((_qRangeMax - _qRangeMin) / 100.0f);
-
-            assert(qRangeRatio >= 0.0f && qRangeRatio <= 1.0f);
-
-            StatisticalMetricsAnnoationData const &     statisticsData(StatisticalMetricsEstimator::get_annotation_data(BaseType::get_column_annotations(), _colIndex, Components::StatisticalMetricsEstimatorName));
+            assert(_qRangeMin >= 0.0f && _qRangeMin <= _qRangeMax && _qRangeMax <= 100.0f);
 
-#if (defined __clang__)
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wdouble-promotion"
-#endif
-
-            scale = static_cast<TransformedT>((statisticsData.Max - statisticsData.Min) * qRangeRatio);
-
-#if (defined __clang__)
-#   pragma clang diagnostic pop
-#endif
+            scale = static_cast<TransformedT>(
+                data.Sketch.interpolated_quantile(static_cast<double>(_qRangeMax) / 100.0)
+                - data.Sketch.interpolated_quantile(static_cast<double>(_qRangeMin) / 100.0)
+            );
         }
 
         return typename BaseType::TransformerUniquePtr(new RobustScalarTransformer<InputT, TransformedT>(std::move(median), std::move(scale)));
@@ -160,7 +150,14 @@ private:
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         RobustScalarEstimator
-///  \brief         This class 'chains' RobustScalarNormEstimator and RobustScalarEstimator.
+///  \brief         This class 'chains' QuantileEstimator and RobustScalarEstimatorImpl.
+///
+///                 Both the median and the quantile range are calculated from a
+///                 single pass over the training data, using memory that is
+///                 independent of the number of rows. The rank of each calculated
+///                 quantile is within `maxRankError * <number of rows>` of the
+///                 exact rank (with 99% confidence); inputs with fewer than
+///                 roughly 1 / `maxRankError` rows produce exact results.
 ///
 template <
     typename InputT,
@@ -169,8 +166,7 @@ template <
 >
 class RobustScalarEstimator :
     public Components::PipelineExecutionEstimatorImpl<
-        Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>,
-        Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>,
+        Components::QuantileEstimator<InputT, TransformedT, MaxNumTrainingItemsV>,
         Details::RobustScalarEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>
     > {
 public:
@@ -180,8 +176,7 @@ public:
     // |
     // ----------------------------------------------------------------------
     using BaseType = Components::PipelineExecutionEstimatorImpl<
-        Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>,
-        Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>,
+        Components::QuantileEstimator<InputT, TransformedT, MaxNumTrainingItemsV>,
         Details::RobustScalarEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>
     >;
 
@@ -200,7 +195,8 @@ public:
         size_t colIndex,
         bool withCentering,
         float qRangeMin=Traits<std::float_t>::CreateNullValue(),
-        float qRangeMax=Traits<std::float_t>::CreateNullValue()
+        float qRangeMax=Traits<std::float_t>::CreateNullValue(),
+        std::float_t maxRankError=Components::Details::QuantileTrainingOnlyPolicy<InputT, TransformedT>::DefaultMaxRankError
     );
     ~RobustScalarEstimator(void) override = default;
 
@@ -276,24 +272,46 @@ void RobustScalarTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
     Traits<decltype(Scale)>::serialize(ar, Scale);
 }
 
+template <typename InputT, typename TransformedT>
+typename RobustScalarTransformer<InputT, TransformedT>::BaseType::TransformedType RobustScalarTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+    if (Scale != static_cast<TransformedT>(0))
+        return (static_cast<TransformedT>(input) - Median) / Scale;
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+
+    return static_cast<TransformedT>(input) - Median;
+}
+
 template <typename InputT, typename TransformedT>
 void RobustScalarTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void RobustScalarTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if (Scale != static_cast<TransformedT>(0)) {
-        callback((static_cast<TransformedT>(input) - Median) / Scale);
-        return;
-    }
+    // Dividing by 1 doesn't change the value, so the zero scale case is
+    // handled by the same kernel.
+    TransformedT const                      divisor(Scale != static_cast<TransformedT>(0) ? Scale : static_cast<TransformedT>(1));
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
 
-    callback(static_cast<TransformedT>(input) - Median);
+    Components::ShiftAndScale(pInputs, cInputs, pOutputs, Median, divisor);
 }
 
 // ----------------------------------------------------------------------
@@ -385,12 +403,11 @@ void Details::RobustScalarEstimatorImpl<InputT, TransformedT, MaxNumTrainingItem
 // |
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-RobustScalarEstimator<InputT, TransformedT, MaxNumTrainingItemsV>::RobustScalarEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
+RobustScalarEstimator<InputT, TransformedT, MaxNumTrainingItemsV>::RobustScalarEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax, std::float_t maxRankError) :
     BaseType(
         "RobustScalarEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
-        [pAllColumnAnnotations, colIndex](void) { return Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex, &maxRankError](void) { return Components::QuantileEstimator<InputT, TransformedT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), true, std::move(maxRankError)); },
         [pAllColumnAnnotations, colIndex, &withCentering, &qRangeMin, &qRangeMax](void) { return Details::RobustScalarEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), std::move(withCentering), std::move(qRangeMin), std::move(qRangeMax)); }
     ) {
 }
@@ -7,6 +7,7 @@
 #include "Components/StatisticalMetricsEstimator.h"
 #include "Components/StandardDeviationEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "Components/ScaleKernels.h"
 #include "../Archive.h"
 
 namespace Microsoft {
@@ -46,6 +47,8 @@ public:
 
     void save(Archive &ar) const override;
 
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -62,11 +65,16 @@ private:
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
 
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type);
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type);
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::true_type /*is_nullable*/) const;
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::false_type /*is_nullable*/) const;
 
     template <typename U>
-    void execute_implex(U const &input, typename BaseType::CallbackFunction const &callback);
+    typename BaseType::TransformedType transform_value(U const &input) const;
+
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::true_type /*is_arithmetic*/);
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::false_type /*is_arithmetic*/);
 };
 
 namespace Details {
@@ -238,6 +246,11 @@ void StandardScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*
     Traits<std::double_t>::serialize(ar, _deviation);
 }
 
+template <typename InputT, typename TransformedT>
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
+    return transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
 template <typename InputT, typename TransformedT>
 bool StandardScalerTransformer<InputT, TransformedT>::operator==(StandardScalerTransformer const &other) const {
 
@@ -261,11 +274,11 @@ bool StandardScalerTransformer<InputT, TransformedT>::operator==(StandardScalerT
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    execute_impl(input, callback, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+    callback(transform(input));
 }
 
 template <typename InputT, typename TransformedT>
-void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type) {
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::true_type /*is_nullable*/) const {
     // ----------------------------------------------------------------------
     using InputTraits                       = Traits<InputT>;
     using TransformedTraits                 = Traits<TransformedT>;
@@ -273,23 +286,37 @@ void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename Base
 
     // TODO: Implement different strategies to handle nulls
     // potential strategies can be returning 0s for nulls, throwing errors, returning nulls for nulls
-    if(InputTraits::IsNull(input)) {
-        callback(TransformedTraits::CreateNullValue());
-        return;
-    }
+    if(InputTraits::IsNull(input))
+        return TransformedTraits::CreateNullValue();
 
-    execute_implex(InputTraits::GetNullableValue(input), callback);
+    return transform_value(InputTraits::GetNullableValue(input));
 }
 
 template <typename InputT, typename TransformedT>
-void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type) {
-    execute_implex(input, callback);
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::false_type /*is_nullable*/) const {
+    return transform_value(input);
 }
 
 template <typename InputT, typename TransformedT>
 template <typename U>
-void StandardScalerTransformer<InputT, TransformedT>::execute_implex(U const &input, typename BaseType::CallbackFunction const &callback) {
-    callback((static_cast<TransformedT>(input) - _average) / _deviation);
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform_value(U const &input) const {
+    return static_cast<TransformedT>((static_cast<TransformedT>(input) - _average) / _deviation);
+}
+
+template <typename InputT, typename TransformedT>
+void StandardScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    execute_batch_impl(pInputs, cInputs, pOutputs, std::integral_constant<bool, std::is_arithmetic<InputT>::value && std::is_arithmetic<TransformedT>::value>());
+}
+
+template <typename InputT, typename TransformedT>
+void StandardScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::true_type /*is_arithmetic*/) {
+    // NaN inputs propagate through the kernel, so null inputs produce null outputs
+    Components::ShiftAndScale(pInputs, cInputs, pOutputs, _average, _deviation);
+}
+
+template <typename InputT, typename TransformedT>
+void StandardScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs, std::false_type /*is_arithmetic*/) {
+    BaseType::execute_batch_transform(*this, pInputs, cInputs, pOutputs);
 }
 
 // ----------------------------------------------------------------------
@@ -6,6 +6,7 @@
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
 #include "Components/DocumentStatisticsEstimator.h"
+#include "Components/VocabularyIndex.h"
 #include "Structs.h"
 #include "../Traits.h"
 #include "../Strings.h"
@@ -73,8 +74,6 @@ public:
     // |  Public Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap const                           Labels;
-    FrequencyMap const                       DocumentFreq;
     std::uint32_t const                      TotalNumsDocuments;
     NormMethod const                         Norm;
     TfidfPolicy const                        TfidfParameters;
@@ -116,42 +115,78 @@ public:
     bool operator==(TfidfVectorizerTransformer const &other) const;
 
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using DocumentFrequencies                = ArchiveArray<std::uint32_t>;
+    using Idfs                               = ArchiveArray<double>;
+    using CreateDocumentFrequenciesFunc      = std::function<DocumentFrequencies (Components::VocabularyIndex const &)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // Document frequency value used for terms that don't have a document frequency
+    static constexpr std::uint32_t const     MissingDocumentFrequency = std::numeric_limits<std::uint32_t>::max();
+
+    Components::VocabularyIndex              _vocabulary;
+
+    // Document frequency for each vocabulary id
+    DocumentFrequencies                      _documentFrequencies;
+
+    // idf values for each vocabulary id; NaN if the term doesn't have a document frequency
+    Idfs                                     _idfs;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    TfidfVectorizerTransformer(
+        Components::VocabularyIndex vocabulary,
+        CreateDocumentFrequenciesFunc const &createDocumentFrequencies,
+        Idfs idfs,
+        std::uint32_t totalNumDocus,
+        NormMethod norm,
+        TfidfPolicy tfidfParameters,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax
+    );
+
+    static CreateDocumentFrequenciesFunc CreateDocumentFrequenciesFromMap(FrequencyMap docuFreq);
+
+    std::vector<double> create_idfs(void) const;
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        //termfrequency for specific document
-        MapWithIterRange documentTermFrequency;
-
         std::string processedInput = Components::DocumentDecorator(input, Lowercase, Analyzer, RegexToken, NgramRangeMin, NgramRangeMax);
+        Components::TermCounts & termCounts(Components::TermCounts::GetThreadLocal(_vocabulary.size()));
 
         ParseFunc(
             processedInput,
-            [&documentTermFrequency] (std::string::const_iterator iterStart, std::string::const_iterator iterEnd) {
-                MapWithIterRange::iterator docuTermFreqIter(documentTermFrequency.find(std::make_tuple(iterStart, iterEnd)));
-                if (docuTermFreqIter != documentTermFrequency.end()) {
-                    ++docuTermFreqIter->second;
-                } else {
-                    documentTermFrequency.insert(std::make_pair(std::make_tuple(iterStart, iterEnd), 1));
-                }
+            [this, &termCounts] (std::string::const_iterator iterStart, std::string::const_iterator iterEnd) {
+                std::uint32_t const id(_vocabulary.find(iterStart, iterEnd));
+
+                if (id != Components::InvalidVocabularyId)
+                    termCounts.increment(id);
             }
         );
 
         std::float_t normVal = 0.0f;
         std::vector<std::tuple<std::uint32_t, std::float_t>> results;
-        for (auto const & wordIteratorPair : documentTermFrequency) {
-            std::string const word(std::string(std::get<0>(wordIteratorPair.first), std::get<1>(wordIteratorPair.first)));
-
-            IndexMap::const_iterator const      labelIter(Labels.find(word));
-
-            if (labelIter != Labels.end()) {
 
+        // Ids are ordered by label index, so the results are already in the order
+        // required by SparseVectorEncoding
+        termCounts.flush(
+            [this, &normVal, &results] (std::uint32_t id, std::uint32_t count) {
                 double tf;
-                double idf;
 
                 //calculate tf(term frequency) which measures how frequently a term occurs in a document.
                 //Since every document is different in length, it is possible that a term would appear much more times
@@ -162,24 +197,16 @@ private:
                 if ((TfidfParameters & TfidfPolicy::Binary) == TfidfPolicy::Binary) {
                     tf = 1.0;
                 } else if (!((TfidfParameters & TfidfPolicy::SublinearTf) == TfidfPolicy::SublinearTf)) {
-                    tf = wordIteratorPair.second;
+                    tf = count;
                 } else {
-                    tf = 1.0 + std::log(wordIteratorPair.second);
+                    tf = 1.0 + std::log(count);
                 }
 
-                //calculate idf(inverse document frequency) which measures how important a term is. While computing TF,
-                //all terms are considered equally important. However it is known that certain terms, such as "is", "of",
-                //and "that", may appear a lot of times but have little importance. Thus we need to weigh down the frequent
-                //terms while scale up the rare ones, by computing the following:
-                //IDF(t) = log_e(Total number of documents / Number of documents with term t in it).
-                //source:http://www.tfidf.com/
-                if (!((TfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf)) {
-                    idf = 1.0;
-                } else if ((TfidfParameters & TfidfPolicy::SmoothIdf) == TfidfPolicy::SmoothIdf) {
-                    idf = 1.0 + std::log((1 + TotalNumsDocuments) / (1.0 + DocumentFreq.at(word)));
-                } else {
-                    idf = 1.0 + std::log((1 + TotalNumsDocuments) / (0.0 + DocumentFreq.at(word)));
-                }
+                //idf(inverse document frequency) is calculated when the transformer is created
+                double const idf(_idfs[id]);
+
+                if (std::isnan(idf))
+                    throw std::out_of_range("DocumentFreq");
 
                 //calculate tfidf (tfidf = tf * idf)
                 std::float_t tfidf = static_cast<std::float_t>(tf * idf);
@@ -193,9 +220,10 @@ private:
                 }
 
                 //temperarily put output in a vector for future normalization
-                results.emplace_back(std::make_tuple(labelIter->second, tfidf));
+                results.emplace_back(std::make_tuple(_vocabulary.value(id), tfidf));
             }
-        }
+        );
+
         //normVal will never be 0 as long as results is not empty
         assert(normVal > 0.0f);
 
@@ -205,17 +233,13 @@ private:
 
         std::vector<SparseVectorEncoding<std::float_t>::ValueEncoding> sparseVector;
 
+        sparseVector.reserve(results.size());
+
         for (auto & result : results) {
             sparseVector.emplace_back(SparseVectorEncoding<std::float_t>::ValueEncoding(std::get<1>(result) / normVal, std::get<0>(result)));
         }
 
-        std::sort(sparseVector.begin(), sparseVector.end(),
-            [](SparseVectorEncoding<std::float_t>::ValueEncoding const &a, SparseVectorEncoding<std::float_t>::ValueEncoding const &b) {
-                return a.Index < b.Index;
-            }
-        );
-
-        callback(SparseVectorEncoding<std::float_t>(Labels.size(), std::move(sparseVector)));
+        callback(SparseVectorEncoding<std::float_t>(_vocabulary.size(), std::move(sparseVector)));
     }
 
 };
@@ -378,7 +402,8 @@ public:
         nonstd::optional<std::uint32_t> topKTerms = nonstd::optional<std::uint32_t>(),
         std::uint32_t ngramRangeMin = 1,
         std::uint32_t ngramRangeMax = 1,
-        nonstd::optional<IndexMap> vocabulary = nonstd::optional<IndexMap>()
+        nonstd::optional<IndexMap> vocabulary = nonstd::optional<IndexMap>(),
+        std::uint32_t numThreads = 1
     );
     ~TfidfVectorizerEstimator(void) override = default;
 
@@ -429,26 +454,39 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
                                                        std::string regexToken,
                                                        std::uint32_t ngramRangeMin,
                                                        std::uint32_t ngramRangeMax) :
-    Labels(
-        std::move(
+    TfidfVectorizerTransformer(
+        Components::VocabularyIndex(
             [&labels](void) ->  IndexMap & {
                 if (labels.size() == 0) {
                     throw std::invalid_argument("Index map is empty!");
                 }
                 return labels;
             }()
-        )
-    ),
-    DocumentFreq(
-        std::move(
-            [&docuFreq](void) ->  IndexMap & {
-                if (docuFreq.size() == 0) {
-                    throw std::invalid_argument("DocumentFrequency map is empty!");
-                }
-                return docuFreq;
-            }()
-        )
-    ),
+        ),
+        CreateDocumentFrequenciesFromMap(std::move(docuFreq)),
+        Idfs(),
+        std::move(totalNumDocus),
+        std::move(norm),
+        std::move(tfidfParameters),
+        std::move(lowercase),
+        std::move(analyzer),
+        std::move(regexToken),
+        std::move(ngramRangeMin),
+        std::move(ngramRangeMax)
+    ) {
+}
+
+TfidfVectorizerTransformer::TfidfVectorizerTransformer(Components::VocabularyIndex vocabulary,
+                                                       CreateDocumentFrequenciesFunc const &createDocumentFrequencies,
+                                                       Idfs idfs,
+                                                       std::uint32_t totalNumDocus,
+                                                       NormMethod norm,
+                                                       TfidfPolicy tfidfParameters,
+                                                       bool lowercase,
+                                                       AnalyzerMethod analyzer,
+                                                       std::string regexToken,
+                                                       std::uint32_t ngramRangeMin,
+                                                       std::uint32_t ngramRangeMax) :
     TotalNumsDocuments(std::move(totalNumDocus)),
     Norm(std::move(norm)),
     TfidfParameters(std::move(tfidfParameters)),
@@ -464,6 +502,38 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
             Components::DocumentParseFuncGenerator(parseFunc, Analyzer, RegexToken, NgramRangeMin, NgramRangeMax);
             return parseFunc;
         }()
+    ),
+    _vocabulary(
+        std::move(
+            [&vocabulary](void) -> Components::VocabularyIndex & {
+                if (vocabulary.size() == 0) {
+                    throw std::invalid_argument("Index map is empty!");
+                }
+                return vocabulary;
+            }()
+        )
+    ),
+    _documentFrequencies(
+        [this, &createDocumentFrequencies](void) {
+            DocumentFrequencies             result(createDocumentFrequencies(_vocabulary));
+
+            if (result.size() != _vocabulary.size()) {
+                throw std::invalid_argument("DocumentFrequency");
+            }
+            return result;
+        }()
+    ),
+    _idfs(
+        [this, &idfs](void) -> Idfs {
+            // idfs are only calculated when they aren't provided by an archive
+            if (idfs.empty())
+                return Idfs(create_idfs());
+
+            if (idfs.size() != _vocabulary.size()) {
+                throw std::invalid_argument("idfs");
+            }
+            return std::move(idfs);
+        }()
     ) {
 }
 
@@ -474,12 +544,39 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 1)
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMap                       labels(Traits<IndexMap>::deserialize(ar));
-            FrequencyMap                   docuFreq(Traits<FrequencyMap>::deserialize(ar));
+
+            // Version 1.0 archives contain the vocabulary and document frequencies
+            // as maps; starting with 1.1, the index, the frequencies, and the idfs
+            // (in id order) are serialized directly so that they can be used in
+            // place from a memory-mapped archive.
+            nonstd::optional<Components::VocabularyIndex>   vocabulary;
+            CreateDocumentFrequenciesFunc                   createDocumentFrequencies;
+            DocumentFrequencies                             documentFrequencies;
+            Idfs                                            idfs;
+
+            if(minorVersion == 0) {
+                IndexMap                   labels(Traits<IndexMap>::deserialize(ar));
+                FrequencyMap               docuFreq(Traits<FrequencyMap>::deserialize(ar));
+
+                vocabulary.emplace(labels);
+                createDocumentFrequencies = CreateDocumentFrequenciesFromMap(std::move(docuFreq));
+            }
+            else {
+                vocabulary.emplace(ar);
+                documentFrequencies = ar.deserialize_array<std::uint32_t>();
+                idfs = ar.deserialize_array<double>();
+
+                // Invoked once while the transformer is constructed below
+                createDocumentFrequencies =
+                    [&documentFrequencies](Components::VocabularyIndex const &) {
+                        return std::move(documentFrequencies);
+                    };
+            }
+
             std::uint32_t                  totalNumDocus(Traits<std::uint32_t >::deserialize(ar));
             NormMethod                     norm(static_cast<NormMethod>(Traits<std::underlying_type<NormMethod>::type>::deserialize(ar)));
             TfidfPolicy                    tfidfParameters(static_cast<TfidfPolicy>(Traits<std::underlying_type<TfidfPolicy>::type>::deserialize(ar)));
@@ -490,8 +587,9 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
             std::uint32_t                  ngramRangeMax(Traits<std::uint32_t>::deserialize(ar));
 
             return TfidfVectorizerTransformer(
-                        std::move(labels),
-                        std::move(docuFreq),
+                        std::move(*vocabulary),
+                        createDocumentFrequencies,
+                        std::move(idfs),
                         std::move(totalNumDocus),
                         std::move(norm),
                         std::move(tfidfParameters),
@@ -508,11 +606,12 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
 void TfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, 1); // Minor
 
     // Data
-    Traits<decltype(Labels)>::serialize(ar, Labels);
-    Traits<decltype(DocumentFreq)>::serialize(ar, DocumentFreq);
+    _vocabulary.save(ar);
+    ar.serialize_array(_documentFrequencies.data(), _documentFrequencies.size());
+    ar.serialize_array(_idfs.data(), _idfs.size());
     Traits<decltype(TotalNumsDocuments)>::serialize(ar, TotalNumsDocuments);
     Traits<std::underlying_type<NormMethod>::type>::serialize(ar, static_cast<std::underlying_type<NormMethod>::type>(Norm));
     Traits<std::underlying_type<TfidfPolicy>::type>::serialize(ar, static_cast<std::underlying_type<TfidfPolicy>::type>(TfidfParameters));
@@ -524,8 +623,8 @@ void TfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
 }
 
 bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &other) const {
-    return Labels == other.Labels
-        && DocumentFreq == other.DocumentFreq
+    return _vocabulary == other._vocabulary
+        && _documentFrequencies == other._documentFrequencies
         && TotalNumsDocuments == other.TotalNumsDocuments
         && Norm == other.Norm
         && TfidfParameters == other.TfidfParameters
@@ -536,6 +635,63 @@ bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &ot
         && NgramRangeMax == other.NgramRangeMax;
 }
 
+// static
+TfidfVectorizerTransformer::CreateDocumentFrequenciesFunc TfidfVectorizerTransformer::CreateDocumentFrequenciesFromMap(FrequencyMap docuFreq) {
+    return
+        [docuFreq](Components::VocabularyIndex const &vocabulary) {
+            if (docuFreq.size() == 0) {
+                throw std::invalid_argument("DocumentFrequency map is empty!");
+            }
+
+            std::vector<std::uint32_t>      result;
+
+            result.reserve(vocabulary.size());
+
+            for (std::uint32_t id = 0; id < vocabulary.size(); ++id) {
+                FrequencyMap::const_iterator const  iter(docuFreq.find(vocabulary.term(id)));
+                std::uint32_t                       documentFrequency(MissingDocumentFrequency);
+
+                if (iter != docuFreq.end())
+                    documentFrequency = iter->second;
+
+                result.emplace_back(documentFrequency);
+            }
+
+            return DocumentFrequencies(std::move(result));
+        };
+}
+
+std::vector<double> TfidfVectorizerTransformer::create_idfs(void) const {
+    std::vector<double>                     result;
+
+    result.reserve(_vocabulary.size());
+
+    for (std::uint32_t id = 0; id < _vocabulary.size(); ++id) {
+        //calculate idf(inverse document frequency) which measures how important a term is. While computing TF,
+        //all terms are considered equally important. However it is known that certain terms, such as "is", "of",
+        //and "that", may appear a lot of times but have little importance. Thus we need to weigh down the frequent
+        //terms while scale up the rare ones, by computing the following:
+        //IDF(t) = log_e(Total number of documents / Number of documents with term t in it).
+        //source:http://www.tfidf.com/
+        if (!((TfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf)) {
+            result.emplace_back(1.0);
+            continue;
+        }
+
+        std::uint32_t const                 documentFrequency(_documentFrequencies[id]);
+
+        if (documentFrequency == MissingDocumentFrequency) {
+            result.emplace_back(std::numeric_limits<double>::quiet_NaN());
+        } else if ((TfidfParameters & TfidfPolicy::SmoothIdf) == TfidfPolicy::SmoothIdf) {
+            result.emplace_back(1.0 + std::log((1 + TotalNumsDocuments) / (1.0 + documentFrequency)));
+        } else {
+            result.emplace_back(1.0 + std::log((1 + TotalNumsDocuments) / (0.0 + documentFrequency)));
+        }
+    }
+
+    return result;
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  TfidfVectorizerEstimator
@@ -556,12 +712,13 @@ TfidfVectorizerEstimator<MaxNumTrainingItemsV>::TfidfVectorizerEstimator(
     nonstd::optional<std::uint32_t> topKTerms,
     std::uint32_t ngramRangeMin,
     std::uint32_t ngramRangeMax,
-    nonstd::optional<IndexMap> vocabulary
+    nonstd::optional<IndexMap> vocabulary,
+    std::uint32_t numThreads
 ) :
     BaseType(
         "TfidfVectorizerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex, lowercase, analyzer, regex, &vocabulary, &topKTerms, &minDf, &maxDf, ngramRangeMin, ngramRangeMax](void) {
+        [pAllColumnAnnotations, colIndex, lowercase, analyzer, regex, &vocabulary, &topKTerms, &minDf, &maxDf, ngramRangeMin, ngramRangeMax, numThreads](void) {
             StringDecorator decorator = lowercase ? Microsoft::Featurizer::Strings::ToLower : StringDecorator();
             return Components::DocumentStatisticsEstimator<MaxNumTrainingItemsV>(
                 std::move(pAllColumnAnnotations),
@@ -574,7 +731,8 @@ TfidfVectorizerEstimator<MaxNumTrainingItemsV>::TfidfVectorizerEstimator(
                 std::move(minDf),
                 std::move(maxDf),
                 std::move(ngramRangeMin),
-                std::move(ngramRangeMax)
+                std::move(ngramRangeMax),
+                std::move(numThreads)
             );
         },
         [pAllColumnAnnotations, colIndex, &norm, &tfidfParameters, lowercase, analyzer, regex, ngramRangeMin, ngramRangeMax](void) {
@@ -20,6 +20,15 @@ namespace Featurizers {
 ///                 TimeSeriesFrequencyEstimator generates Frequency Annotation which is consumed by
 ///                 TimeSeriesImputerEstimator to Impute data.
 ///
+///                 The frequency and median estimators share a single
+///                 `GrainDictionary`, so each grain is interned once.
+///
+///                 When backward filling, rows are emitted as soon as their
+///                 null values have been filled; the number of rows that each
+///                 grain keeps in memory while waiting for a value can be limited
+///                 with `set_max_buffered_rows_per_grain` on the imputer's
+///                 transformer (`get_transformer<2>()`).
+///
 class TimeSeriesImputerEstimator :
     public Components::PipelineExecutionEstimatorImpl<
         Components::TimeSeriesFrequencyEstimator,
@@ -41,6 +50,55 @@ public:
     TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations,std::vector<TypeId> colsToImputeDataTypes, bool suppresserror = false, Components::TimeSeriesImputeStrategy tsImputeStrategy= Components::TimeSeriesImputeStrategy::Forward);
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesImputerEstimator);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, bool suppresserror, Components::TimeSeriesImputeStrategy tsImputeStrategy, Components::TimeSeriesFrequencyEstimator::GrainDictionaryPtr pGrains);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         NumericTimeSeriesImputerEstimator
+///  \brief         `TimeSeriesImputerEstimator` for time series whose grains are
+///                 pre-hashed by the caller and whose columns to impute are
+///                 numeric, where NaN values are null. Values are imputed
+///                 without any string formatting or parsing, and rows are
+///                 stored inline (see `Components::NumericTimeSeriesRow`), so
+///                 at most `Components::NumericTimeSeriesRow::MaxNumColumns`
+///                 columns can be imputed.
+///
+class NumericTimeSeriesImputerEstimator :
+    public Components::PipelineExecutionEstimatorImpl<
+        Components::NumericTimeSeriesFrequencyEstimator,
+        Components::NumericTimeSeriesMedianEstimator,
+        Components::NumericTimeSeriesImputerEstimator
+    > {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType = Components::PipelineExecutionEstimatorImpl<
+        Components::NumericTimeSeriesFrequencyEstimator,
+        Components::NumericTimeSeriesMedianEstimator,
+        Components::NumericTimeSeriesImputerEstimator
+    >;
+
+    NumericTimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t numColsToImpute, bool suppressError = false, Components::TimeSeriesImputeStrategy tsImputeStrategy = Components::TimeSeriesImputeStrategy::Forward);
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(NumericTimeSeriesImputerEstimator);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    NumericTimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t numColsToImpute, bool suppressError, Components::TimeSeriesImputeStrategy tsImputeStrategy, Components::NumericTimeSeriesFrequencyEstimator::GrainDictionaryPtr pGrains);
 };
 
 // ----------------------------------------------------------------------
@@ -53,14 +111,48 @@ public:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, bool suppresserror, Components::TimeSeriesImputeStrategy tsImputeStrategy) :
+    TimeSeriesImputerEstimator(
+        std::move(pAllColumnAnnotations),
+        std::move(colsToImputeDataTypes),
+        suppresserror,
+        tsImputeStrategy,
+        std::make_shared<Components::StringTimeSeriesTypes::GrainDictionaryType>()
+    ) {
+}
+
+inline TimeSeriesImputerEstimator::TimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, std::vector<TypeId> colsToImputeDataTypes, bool suppresserror, Components::TimeSeriesImputeStrategy tsImputeStrategy, Components::TimeSeriesFrequencyEstimator::GrainDictionaryPtr pGrains) :
     BaseType("TimeSeriesImputerEstimator",
         pAllColumnAnnotations,
-        [&pAllColumnAnnotations](void) { return Components::TimeSeriesFrequencyEstimator(pAllColumnAnnotations); },
-        [&pAllColumnAnnotations,&colsToImputeDataTypes](void) { return Components::TimeSeriesMedianEstimator(pAllColumnAnnotations,colsToImputeDataTypes); },
+        [&pAllColumnAnnotations,&pGrains](void) { return Components::TimeSeriesFrequencyEstimator(pAllColumnAnnotations,pGrains); },
+        [&pAllColumnAnnotations,&colsToImputeDataTypes,&pGrains](void) { return Components::TimeSeriesMedianEstimator(pAllColumnAnnotations,colsToImputeDataTypes,Components::TimeSeriesMedianEstimator::DefaultMaxRankError,pGrains); },
         [&pAllColumnAnnotations,&colsToImputeDataTypes,&tsImputeStrategy,&suppresserror](void) { return Components::TimeSeriesImputerEstimator(pAllColumnAnnotations,colsToImputeDataTypes,tsImputeStrategy,suppresserror); }
     ) {
 }
 
+inline NumericTimeSeriesImputerEstimator::NumericTimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t numColsToImpute, bool suppressError, Components::TimeSeriesImputeStrategy tsImputeStrategy) :
+    NumericTimeSeriesImputerEstimator(
+        std::move(pAllColumnAnnotations),
+        [&numColsToImpute](void) {
+            if(numColsToImpute > Components::NumericTimeSeriesRow::MaxNumColumns)
+                throw std::invalid_argument("numColsToImpute");
+
+            return numColsToImpute;
+        }(),
+        suppressError,
+        tsImputeStrategy,
+        std::make_shared<Components::NumericTimeSeriesTypes::GrainDictionaryType>()
+    ) {
+}
+
+inline NumericTimeSeriesImputerEstimator::NumericTimeSeriesImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t numColsToImpute, bool suppressError, Components::TimeSeriesImputeStrategy tsImputeStrategy, Components::NumericTimeSeriesFrequencyEstimator::GrainDictionaryPtr pGrains) :
+    BaseType("NumericTimeSeriesImputerEstimator",
+        pAllColumnAnnotations,
+        [&pAllColumnAnnotations, &pGrains](void) { return Components::NumericTimeSeriesFrequencyEstimator(pAllColumnAnnotations, pGrains); },
+        [&pAllColumnAnnotations, &numColsToImpute, &pGrains](void) { return Components::NumericTimeSeriesMedianEstimator(pAllColumnAnnotations, std::vector<TypeId>(numColsToImpute, TypeId::Float64), Components::NumericTimeSeriesMedianEstimator::DefaultMaxRankError, pGrains); },
+        [&pAllColumnAnnotations, &numColsToImpute, &tsImputeStrategy, &suppressError](void) { return Components::NumericTimeSeriesImputerEstimator(pAllColumnAnnotations, std::vector<TypeId>(numColsToImpute, TypeId::Float64), tsImputeStrategy, suppressError); }
+    ) {
+}
+
 } // namespace Featurizers
 } // namespace Featurizer
 } // namespace Microsoft
@@ -6,11 +6,69 @@
 
 #include "../Featurizer.h"
 #include "../Archive.h"
+#include "Structs.h"
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wold-style-cast"
+#   pragma clang diagnostic ignored "-Wsign-conversion"
+#   pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#   pragma clang diagnostic ignored "-Wzero-as-null-pointer-constant"
+#   pragma clang diagnostic ignored "-Wextra-semi-stmt"
+#   pragma clang diagnostic ignored "-Wmissing-noreturn"
+#   pragma clang diagnostic ignored "-Wdocumentation"
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#   pragma clang diagnostic ignored "-Wcast-align"
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#   pragma clang diagnostic ignored "-Wshadow"
+#elif (defined _MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable: 4127)
+#endif
+
+#include "../3rdParty/eigen/Eigen/Sparse"
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#elif (defined _MSC_VER)
+#   pragma warning(pop)
+#endif
 
 namespace Microsoft {
 namespace Featurizer {
+
+namespace Details {
+
+// Sparse matrices (CSR when RowMajor, CSC when ColMajor) are projected into
+// dense matrices
+template <typename T, int OptionsV, typename IndexT>
+struct MatrixTypeMapper<Eigen::SparseMatrix<T, OptionsV, IndexT>> {
+    typedef ColMajMatrix<T> OutType;
+    typedef ColMajMatrix<T> MatrixType;
+};
+
+template <typename T, int OptionsV, typename IndexT>
+struct MatrixTypeMapper<const Eigen::SparseMatrix<T, OptionsV, IndexT>> {
+    typedef ColMajMatrix<T> OutType;
+    typedef ColMajMatrix<T> MatrixType;
+};
+
+} // namespace Details
+
 namespace Featurizers {
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CreateSparseMatrix
+///  \brief         Creates a sparse matrix with one row for each encoded
+///                 vector (for example, the output of
+///                 `TfidfVectorizerTransformer`). Throws `std::invalid_argument`
+///                 if the rows have different sizes, a value's index is out
+///                 of range, or the matrix is too large for the matrix's
+///                 `StorageIndex` type.
+///
+template <typename SparseMatrixT, typename T>
+SparseMatrixT CreateSparseMatrix(std::vector<SparseVectorEncoding<T>> const &rows);
+
 // SVD results can have different sign for result in different environment
 // so we create this function so that the largest number within a column is always positive
 // in order to always get a deterministic result across envrionment between UNIX and Windows
@@ -168,44 +226,27 @@ inline void sample_gaussian(MatrixType& mat) {
     }
 }
 
+// Replaces the columns of the matrix with an orthonormal basis of their span.
+// Eigen's Householder QR is blocked, so this is cache friendly and remains
+// numerically stable when the columns are nearly dependent.
 template<typename MatrixType>
-inline void gram_schmidt(MatrixType& mat) {
-
-    typedef typename MatrixType::Scalar Scalar;
-    typedef typename MatrixType::Index Index;
-
-    #if (defined __clang__)
-    #   pragma clang diagnostic push
-    #   pragma clang diagnostic ignored "-Wdouble-promotion"
-    #endif
-
-    static const Scalar EPS(1E-4f);
-
-    #if (defined __clang__)
-    #   pragma clang diagnostic pop
-    #endif
-
-    for(Index i = 0; i < mat.cols(); ++i) {
-        for(Index j = 0; j < i; ++j) {
-            Scalar r = mat.col(i).dot(mat.col(j));
-            mat.col(i) -= r * mat.col(j);
-        }
-
-        Scalar norm = mat.col(i).norm();
+inline void orthonormalize(MatrixType& mat) {
+    Eigen::HouseholderQR<MatrixType>        qr(mat);
 
-        if(norm < EPS) {
-            for(Index k = i; k < mat.cols(); ++k)
-                mat.col(k).setZero();
-            return;
-        }
-        mat.col(i) /= norm;
-    }
+    mat = qr.householderQ() * MatrixType::Identity(mat.rows(), mat.cols());
 }
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         TruncatedSVDEstimator
-///  \brief         Estimator that reads an annotation created by the `SVDComponentsEstimator`
-///                 and creates a `SVDTransformer` object.
+///  \brief         Estimator that calculates the right singular vectors of a
+///                 matrix with a randomized SVD and creates a
+///                 `TruncatedSVDTransformer` object.
+///
+///                 The input may be dense or sparse (`Eigen::SparseMatrix` in
+///                 either CSR or CSC format); sparse input is never densified,
+///                 so memory is proportional to
+///                 (rows + cols) * (numComponents + numOversamples). Because
+///                 of this, `numComponents` must be provided for sparse input.
 ///
 template <
     typename InputEigenMatrixT,
@@ -227,7 +268,26 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TruncatedSVDEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Constructor
+    ///  \brief         `numComponents` is the number of singular vectors to
+    ///                 calculate (0 calculates min(rows, cols) of them, and is
+    ///                 only valid for dense input);
+    ///                 `numOversamples` is the number of additional random
+    ///                 vectors used to sample the range of the matrix and
+    ///                 `numPowerIterations` the number of passes over the
+    ///                 matrix used to refine that sample. Larger values
+    ///                 improve the accuracy of the trailing components when
+    ///                 the singular values decay slowly.
+    ///
+    TruncatedSVDEstimator(
+        AnnotationMapsPtr pAllColumnAnnotations,
+        size_t colIndex,
+        std::uint32_t numComponents=0,
+        std::uint32_t numOversamples=0,
+        std::uint32_t numPowerIterations=0
+    );
     ~TruncatedSVDEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TruncatedSVDEstimator);
@@ -246,6 +306,9 @@ private:
     // |
     // ----------------------------------------------------------------------
     size_t const                            _colIndex;
+    std::uint32_t const                     _numComponents;
+    std::uint32_t const                     _numOversamples;
+    std::uint32_t const                     _numPowerIterations;
 
     EigenMatrix                             _state;
 
@@ -262,23 +325,39 @@ private:
             throw std::runtime_error("Only 1 matrix can be provided");
 
         auto const &                        matrix(*pBuffer);
-        Eigen::Index                        rank((matrix.rows() < matrix.cols()) ? matrix.rows() : matrix.cols());
+
+        if(matrix.size() == 0)
+            throw std::invalid_argument("Input matrix size() invalid");
+
+        Eigen::Index const                  rank((matrix.rows() < matrix.cols()) ? matrix.rows() : matrix.cols());
+        Eigen::Index const                  numComponents(_numComponents == 0 ? rank : std::min(rank, static_cast<Eigen::Index>(_numComponents)));
+        Eigen::Index const                  numSamples(std::min(rank, numComponents + static_cast<Eigen::Index>(_numOversamples)));
 
         // Gaussian Random Matrix for _matrix^T
-        EigenMatrix                         O(matrix.rows(), rank);
+        EigenMatrix                         O(matrix.rows(), numSamples);
         sample_gaussian(O);
 
         // Compute Sample Matrix of _matrix^T
         EigenMatrix                         Y(matrix.transpose() * O);
 
         // Orthonormalize Y
-        gram_schmidt(Y);
+        orthonormalize(Y);
+
+        // Power iterations; orthonormalizing after each product prevents the
+        // small singular values from being lost to rounding
+        for(std::uint32_t iteration = 0; iteration < _numPowerIterations; ++iteration) {
+            O = matrix * Y;
+            orthonormalize(O);
+
+            Y = matrix.transpose() * O;
+            orthonormalize(Y);
+        }
 
         // Range(B) = Range(_matrix^T)
         EigenMatrix                         B(matrix * Y);
 
         // Gaussian Random Matrix
-        EigenMatrix                         P(B.cols(), rank);
+        EigenMatrix                         P(B.cols(), numSamples);
 
         sample_gaussian(P);
 
@@ -286,14 +365,14 @@ private:
         EigenMatrix                         Z(B * P);
 
         // Orthonormalize Z
-        gram_schmidt(Z);
+        orthonormalize(Z);
 
         // Range(C) = Range(B)
         EigenMatrix                         C(Z.transpose() * B);
 
         Eigen::JacobiSVD<EigenMatrix>       svdOfC(C, Eigen::ComputeThinV);
 
-        _state = Y * svdOfC.matrixV();
+        _state = Y * svdOfC.matrixV().leftCols(numComponents);
 
         return FitResult::Complete;
     }
@@ -316,6 +395,50 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 
+template <typename SparseMatrixT, typename T>
+SparseMatrixT CreateSparseMatrix(std::vector<SparseVectorEncoding<T>> const &rows) {
+    using Scalar                            = typename SparseMatrixT::Scalar;
+    using StorageIndex                      = typename SparseMatrixT::StorageIndex;
+    using Triplet                           = Eigen::Triplet<Scalar, StorageIndex>;
+
+    std::vector<Triplet>                    triplets;
+    std::uint64_t                           numCols(0);
+    size_t                                  numValues(0);
+
+    for(auto const &row : rows)
+        numValues += row.Values.size();
+
+    triplets.reserve(numValues);
+
+    if(rows.size() > static_cast<std::uint64_t>(std::numeric_limits<StorageIndex>::max()))
+        throw std::invalid_argument("rows");
+
+    for(size_t rowIndex = 0; rowIndex < rows.size(); ++rowIndex) {
+        SparseVectorEncoding<T> const &     row(rows[rowIndex]);
+
+        if(rowIndex == 0) {
+            if(row.NumElements > static_cast<std::uint64_t>(std::numeric_limits<StorageIndex>::max()))
+                throw std::invalid_argument("rows");
+
+            numCols = row.NumElements;
+        }
+        else if(row.NumElements != numCols)
+            throw std::invalid_argument("rows");
+
+        for(auto const &value : row.Values) {
+            if(value.Index >= row.NumElements)
+                throw std::invalid_argument("value.Index");
+
+            triplets.emplace_back(static_cast<StorageIndex>(rowIndex), static_cast<StorageIndex>(value.Index), static_cast<Scalar>(value.Value));
+        }
+    }
+
+    SparseMatrixT                           result(static_cast<Eigen::Index>(rows.size()), static_cast<Eigen::Index>(numCols));
+
+    result.setFromTriplets(triplets.begin(), triplets.end());
+    return result;
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  TruncatedSVDTransformer
@@ -381,7 +504,13 @@ std::ptrdiff_t TruncatedSVDTransformer<InputEigenMatrixT, OutputEigenMatrixT>::g
 // |
 // ----------------------------------------------------------------------
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
-TruncatedSVDEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::TruncatedSVDEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex) :
+TruncatedSVDEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::TruncatedSVDEstimator(
+    AnnotationMapsPtr pAllColumnAnnotations,
+    size_t colIndex,
+    std::uint32_t numComponents,
+    std::uint32_t numOversamples,
+    std::uint32_t numPowerIterations
+) :
     BaseType("SVDEstimatorImpl", std::move(pAllColumnAnnotations)),
     _colIndex(
         std::move(
@@ -392,7 +521,21 @@ TruncatedSVDEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItems
                 return colIndex;
             }()
         )
-    ) {
+    ),
+    _numComponents(
+        std::move(
+            [&numComponents](void) -> std::uint32_t & {
+                // The default of min(rows, cols) components would create dense
+                // matrices proportional to the size of the input
+                if(numComponents == 0 && std::is_base_of<Eigen::SparseMatrixBase<InputEigenMatrixT>, InputEigenMatrixT>::value)
+                    throw std::invalid_argument("numComponents");
+
+                return numComponents;
+            }()
+        )
+    ),
+    _numOversamples(std::move(numOversamples)),
+    _numPowerIterations(std::move(numPowerIterations)) {
 }
 
 // ----------------------------------------------------------------------
@@ -5,8 +5,13 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
 #include "../../3rdParty/optional.h"
 #include "../../Archive.h"
+#include "../../MemoryMappedFile.h"
 #include "../CountVectorizerFeaturizer.h"
 #include "../Structs.h"
 #include "../TestHelpers.h"
@@ -360,6 +365,62 @@ TEST_CASE("string - without binary with decorator, analyze word, maxdf = 1, mind
         )== inferencingOutput
     );
 }
+TEST_CASE("Shared transformer executed on multiple threads") {
+    NS::Featurizers::CountVectorizerTransformer         transformer(
+        IndexMapType(
+            {
+                {"apple", 0},
+                {"banana", 1},
+                {"grape", 2}
+            }
+        ),
+        false,
+        false,
+        AnalyzerMethod::Word,
+        "",
+        1,
+        1
+    );
+
+    std::vector<std::thread>                threads;
+    // `std::vector<bool>` packs elements, so each thread couldn't write its own
+    std::vector<int>                        succeeded(4, 0);
+
+    for(size_t threadIndex = 0; threadIndex < succeeded.size(); ++threadIndex) {
+        threads.emplace_back(
+            [&transformer, &succeeded, threadIndex](void) {
+                int                         result(1);
+
+                for(std::uint32_t i = 0; i < 1000; ++i) {
+                    std::string const       input(i % 2 ? "apple grape apple" : "banana banana");
+                    auto const              output(transformer.execute(input));
+
+                    std::vector<std::pair<std::uint32_t, std::uint64_t>>    values;
+
+                    for(auto const &value : output.Values)
+                        values.emplace_back(value.Value, value.Index);
+
+                    if(
+                        values != (
+                            i % 2
+                                ? std::vector<std::pair<std::uint32_t, std::uint64_t>>{{2, 0}, {1, 2}}
+                                : std::vector<std::pair<std::uint32_t, std::uint64_t>>{{2, 1}}
+                        )
+                    )
+                        result = 0;
+                }
+
+                succeeded[threadIndex] = result;
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(succeeded == std::vector<int>(succeeded.size(), 1));
+}
+
 TEST_CASE("Serialization/Deserialization") {
     using TransformerType = NS::Featurizers::CountVectorizerTransformer;
 
@@ -384,6 +445,73 @@ TEST_CASE("Serialization/Deserialization") {
     CHECK(other == original);
 }
 
+TEST_CASE("Deserialization - version 1.0") {
+    using TransformerType = NS::Featurizers::CountVectorizerTransformer;
+
+    IndexMapType indexMap(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3}
+        }
+    );
+
+    NS::Archive                             out;
+
+    NS::Traits<std::uint16_t>::serialize(out, 1);
+    NS::Traits<std::uint16_t>::serialize(out, 0);
+    NS::Traits<IndexMapType>::serialize(out, indexMap);
+    NS::Traits<bool>::serialize(out, false);
+    NS::Traits<bool>::serialize(out, false);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(AnalyzerMethod::Word));
+    NS::Traits<std::string>::serialize(out, "");
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+
+    NS::Archive                             in(out.commit());
+
+    CHECK(TransformerType(in) == TransformerType(indexMap, false, false, AnalyzerMethod::Word, "", 1, 1));
+}
+
+TEST_CASE("Deserialization - memory-mapped") {
+    using TransformerType = NS::Featurizers::CountVectorizerTransformer;
+
+    IndexMapType indexMap(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3},
+            {"orange", 4},
+            {"peach", 5}
+        }
+    );
+
+    TransformerType                         original(indexMap, false, false, AnalyzerMethod::Word, "", 1, 1);
+    NS::Archive                             out;
+
+    original.save(out);
+
+    std::string const                       filename("CountVectorizerFeaturizer_UnitTests.bin");
+    NS::Archive::ByteArray const            bytes(out.commit());
+
+    {
+        std::ofstream                       stream(filename, std::ios::binary);
+
+        stream.write(reinterpret_cast<char const *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    {
+        NS::Archive                         in(NS::CreateMappedArchive(filename));
+        TransformerType                     other(in);
+
+        CHECK(in.AtEnd());
+        CHECK(other == original);
+        CHECK(other.execute("orange apple orange kiwi") == original.execute("orange apple orange kiwi"));
+    }
+
+    std::remove(filename.c_str());
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
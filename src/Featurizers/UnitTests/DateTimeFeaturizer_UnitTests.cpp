@@ -7,6 +7,14 @@
 #include "catch.hpp"
 #include "../DateTimeFeaturizer.h"
 
+#include <fstream>
+
+#if (defined _WIN32)
+#   include <direct.h>
+#else
+#   include <sys/stat.h>
+#endif
+
 namespace NS = Microsoft::Featurizer;
 
 using SysClock = std::chrono::system_clock;
@@ -263,6 +271,220 @@ TEST_CASE("Pre-Epoch - 1776 July 4", "[DateTimeTransformer][DateTimeTransformer]
 }
 #endif /* _MSVCRT */
 
+TEST_CASE("Batch transform", "[DateTimeTransformer][DateTimeTransformer]") {
+    NS::Featurizers::DateTimeTransformer    dt("Canada");
+    std::vector<std::int64_t> const         input({217081624, 157161600, 157161599, 1751241600, 157161650});
+    NS::Featurizers::TimePointColumns       columns;
+
+    dt.transform(input.data(), input.size(), columns);
+    REQUIRE(columns.size() == input.size());
+
+    for(size_t index = 0; index < input.size(); ++index) {
+        NS::Featurizers::TimePoint const    tp(dt.execute(SysClock::from_time_t(static_cast<time_t>(input[index]))));
+
+        CHECK(columns.year[index] == tp.year);
+        CHECK(columns.month[index] == tp.month);
+        CHECK(columns.day[index] == tp.day);
+        CHECK(columns.hour[index] == tp.hour);
+        CHECK(columns.minute[index] == tp.minute);
+        CHECK(columns.second[index] == tp.second);
+        CHECK(columns.amPm[index] == tp.amPm);
+        CHECK(columns.hour12[index] == tp.hour12);
+        CHECK(columns.dayOfWeek[index] == tp.dayOfWeek);
+        CHECK(columns.dayOfQuarter[index] == tp.dayOfQuarter);
+        CHECK(columns.dayOfYear[index] == tp.dayOfYear);
+        CHECK(columns.weekOfMonth[index] == tp.weekOfMonth);
+        CHECK(columns.quarterOfYear[index] == tp.quarterOfYear);
+        CHECK(columns.halfOfYear[index] == tp.halfOfYear);
+        CHECK(columns.weekIso[index] == tp.weekIso);
+        CHECK(columns.yearIso[index] == tp.yearIso);
+        CHECK(columns.isPaidTimeOff[index] == tp.isPaidTimeOff);
+        CHECK(dt.holiday_name(columns.holidayId[index]) == tp.holidayName);
+
+        CHECK(NS::Featurizers::TimePoint::MonthLabels[columns.month[index] - 1] == tp.monthLabel);
+        CHECK(NS::Featurizers::TimePoint::DayOfWeekLabels[columns.dayOfWeek[index]] == tp.dayOfWeekLabel);
+        CHECK(NS::Featurizers::TimePoint::AmPmLabels[columns.amPm[index]] == tp.amPmLabel);
+    }
+
+    CHECK(columns.holidayId[0] == NS::Featurizers::DateTimeTransformer::NoHolidayId);
+    CHECK(dt.holiday_name(columns.holidayId[1]) == "Christmas Day");
+    CHECK(columns.holidayId[4] == columns.holidayId[1]);
+
+    // The columns are reused
+    int32_t const * const                   pYear(columns.year.data());
+
+    dt.transform(input.data(), 2, columns);
+    CHECK(columns.size() == 2);
+    CHECK(columns.year.data() == pYear);
+
+    CHECK_THROWS_WITH(dt.holiday_name(1000000), "holidayId");
+    CHECK_THROWS_WITH(dt.transform(nullptr, 1, columns), "pSecondsSinceEpoch");
+}
+
+TEST_CASE("CalendarTable") {
+    NS::Featurizers::CalendarTable const    table;
+    auto const                              checkFunc(
+        [](NS::Featurizers::TimePoint const &tp, NS::Featurizers::TimePoint const &expected) {
+            CHECK(tp.year == expected.year);
+            CHECK(tp.month == expected.month);
+            CHECK(tp.day == expected.day);
+            CHECK(tp.hour == expected.hour);
+            CHECK(tp.minute == expected.minute);
+            CHECK(tp.second == expected.second);
+            CHECK(tp.amPm == expected.amPm);
+            CHECK(tp.hour12 == expected.hour12);
+            CHECK(tp.dayOfWeek == expected.dayOfWeek);
+            CHECK(tp.dayOfQuarter == expected.dayOfQuarter);
+            CHECK(tp.dayOfYear == expected.dayOfYear);
+            CHECK(tp.weekOfMonth == expected.weekOfMonth);
+            CHECK(tp.quarterOfYear == expected.quarterOfYear);
+            CHECK(tp.halfOfYear == expected.halfOfYear);
+            CHECK(tp.weekIso == expected.weekIso);
+            CHECK(tp.yearIso == expected.yearIso);
+            CHECK(tp.monthLabel == expected.monthLabel);
+            CHECK(tp.amPmLabel == expected.amPmLabel);
+            CHECK(tp.dayOfWeekLabel == expected.dayOfWeekLabel);
+        }
+    );
+
+    // 1970 through 2099
+    CHECK(table.size() == 47482);
+
+    for(std::int64_t day = 0; day < static_cast<std::int64_t>(table.size()); ++day) {
+        std::int64_t const                  secondsSinceEpoch(day * 60 * 60 * 24 + (day * 7919) % (60 * 60 * 24));
+        std::uint32_t                       secondsSinceMidnight;
+        NS::Featurizers::CalendarDay const * const
+                                            pDay(table.find(secondsSinceEpoch, secondsSinceMidnight));
+
+        REQUIRE(pDay != nullptr);
+        CHECK(pDay->holidayId == NS::Featurizers::CalendarDay::NoHolidayId);
+        checkFunc(NS::Featurizers::TimePoint(*pDay, secondsSinceMidnight), NS::Featurizers::TimePoint(SysClock::from_time_t(static_cast<time_t>(secondsSinceEpoch))));
+    }
+
+    std::uint32_t                           secondsSinceMidnight;
+
+    CHECK(table.find(-1, secondsSinceMidnight) == nullptr);
+    CHECK(table.find(static_cast<std::int64_t>(table.size()) * 60 * 60 * 24, secondsSinceMidnight) == nullptr);
+    CHECK(table.find(std::numeric_limits<std::int64_t>::min(), secondsSinceMidnight) == nullptr);
+    CHECK(table.find(std::numeric_limits<std::int64_t>::max(), secondsSinceMidnight) == nullptr);
+
+    // Custom ranges
+    NS::Featurizers::CalendarTable const    preEpoch(1960, 1969);
+
+    REQUIRE(preEpoch.find(-1, secondsSinceMidnight) != nullptr);
+    CHECK(preEpoch.find(-1, secondsSinceMidnight)->year == 1969);
+    CHECK(preEpoch.find(-1, secondsSinceMidnight)->dayOfYear == 364);
+    CHECK(secondsSinceMidnight == 60 * 60 * 24 - 1);
+    CHECK(preEpoch.find(0, secondsSinceMidnight) == nullptr);
+
+    CHECK_THROWS_WITH(NS::Featurizers::CalendarTable(2000, 1999), "lastYear");
+    CHECK_THROWS_WITH(NS::Featurizers::CalendarTable(40000, 40001), "firstYear");
+}
+
+TEST_CASE("Batch transform - out of range", "[DateTimeTransformer][DateTimeTransformer]") {
+    NS::Featurizers::DateTimeTransformer    dt("United States");
+    std::vector<std::int64_t> const         input({
+#ifndef _MSC_VER
+        -6106060800,                        // 1776 July 4
+        7258118400,                         // 2200 Jan 1
+#endif
+        1751241600,
+        1577836800                          // 2020 Jan 1
+    });
+    NS::Featurizers::TimePointColumns       columns;
+
+    dt.transform(input.data(), input.size(), columns);
+    REQUIRE(columns.size() == input.size());
+
+    for(size_t index = 0; index < input.size(); ++index) {
+        NS::Featurizers::TimePoint const    tp(dt.execute(SysClock::from_time_t(static_cast<time_t>(input[index]))));
+
+        CHECK(columns.year[index] == tp.year);
+        CHECK(columns.month[index] == tp.month);
+        CHECK(columns.day[index] == tp.day);
+        CHECK(columns.dayOfYear[index] == tp.dayOfYear);
+        CHECK(columns.weekIso[index] == tp.weekIso);
+        CHECK(columns.yearIso[index] == tp.yearIso);
+        CHECK(dt.holiday_name(columns.holidayId[index]) == tp.holidayName);
+    }
+}
+
+TEST_CASE("TimePointLabel") {
+    NS::Featurizers::TimePointLabel const   empty;
+    std::string const                       value("Christmas Day");
+    NS::Featurizers::TimePointLabel const   label(value);
+
+    CHECK(empty.empty());
+    CHECK(empty == "");
+    CHECK(empty != "C");
+    CHECK(label.size() == value.size());
+    CHECK(label == value);
+    CHECK(label == "Christmas Day");
+    CHECK(label != "Christmas");
+    CHECK(label != "Christmas Day!");
+    CHECK(label.str() == value);
+    CHECK(label == NS::Featurizers::TimePointLabel(value));
+    CHECK(label != empty);
+}
+
+TEST_CASE("Holidays - shared") {
+    NS::Featurizers::DateTimeTransformer    dt1("United States");
+    NS::Featurizers::DateTimeTransformer    dt2("united states");
+    NS::Featurizers::DateTimeTransformer    dt3("Canada");
+    NS::Featurizers::DateTimeTransformer    dt4("");
+
+    CHECK(dt1 == dt2);
+    CHECK((dt1 == dt3) == false);
+    CHECK((dt1 == dt4) == false);
+    CHECK(dt4 == NS::Featurizers::DateTimeTransformer(""));
+
+    NS::Featurizers::TimePoint const        tp1(dt1.execute(SysClock::from_time_t(157161600)));
+    NS::Featurizers::TimePoint const        tp2(dt2.execute(SysClock::from_time_t(157161600)));
+
+    CHECK(tp1.holidayName == "Christmas Day");
+
+    // The names reference the same data
+    CHECK(tp1.holidayName.c_str() == tp2.holidayName.c_str());
+}
+
+TEST_CASE("Holidays - data") {
+    struct Internal {
+        static std::string CreateDataRootDir(std::string const &name) {
+            std::string const               root("DateTimeFeaturizer_UnitTests_" + name);
+
+            for(std::string const &dir : {root, root + "/Data", root + "/Data/DateTimeFeaturizer"}) {
+#if (defined _WIN32)
+                _mkdir(dir.c_str());
+#else
+                mkdir(dir.c_str(), 0777);
+#endif
+            }
+
+            return root;
+        }
+    };
+
+    // Missing data
+    std::string const                       missingDir(Internal::CreateDataRootDir("Missing"));
+
+    CHECK(NS::Featurizers::DateTimeEstimator::GetSupportedCountries(missingDir).empty());
+    CHECK(NS::Featurizers::DateTimeEstimator::IsValidCountry("United States", missingDir) == false);
+    CHECK_THROWS_WITH(NS::Featurizers::DateTimeTransformer("United States", missingDir), "United States");
+    CHECK(NS::Featurizers::DateTimeTransformer("", missingDir) == NS::Featurizers::DateTimeTransformer(""));
+
+    // Invalid data
+    std::string const                       invalidDir(Internal::CreateDataRootDir("Invalid"));
+
+    {
+        std::ofstream                       f(invalidDir + "/Data/DateTimeFeaturizer/Holidays.bin", std::ios::binary);
+
+        f << "FZHD but not really";
+    }
+
+    CHECK_THROWS_WITH(NS::Featurizers::DateTimeEstimator::GetSupportedCountries(invalidDir), "Invalid holiday data");
+    CHECK_THROWS_WITH(NS::Featurizers::DateTimeTransformer("United States", invalidDir), "Invalid holiday data");
+}
+
 TEST_CASE("Serialization") {
     NS::Featurizers::DateTimeTransformer    original("United States");
     NS::Archive                             out;
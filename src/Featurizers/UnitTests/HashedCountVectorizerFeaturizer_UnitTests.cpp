@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../../Archive.h"
+#include "../HashedCountVectorizerFeaturizer.h"
+#include "../TestHelpers.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using AnalyzerMethod = NS::Featurizers::Components::AnalyzerMethod;
+using TransformedType = NS::Featurizers::SparseVectorEncoding<std::uint32_t>;
+
+std::uint32_t GetBucket(std::string const &term, std::uint32_t numBuckets) {
+    return NS::Featurizers::Components::GetTermBucket(term.begin(), term.end(), 2, numBuckets);
+}
+
+std::vector<TransformedType::ValueEncoding> CreateValues(std::vector<std::pair<std::string, std::uint32_t>> const &counts, std::uint32_t numBuckets) {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>>    buckets;
+
+    for(auto const &count : counts)
+        buckets.emplace_back(GetBucket(count.first, numBuckets), count.second);
+
+    std::sort(buckets.begin(), buckets.end());
+
+    std::vector<TransformedType::ValueEncoding>             result;
+
+    for(auto const &bucket : buckets)
+        result.emplace_back(bucket.second, bucket.first);
+
+    return result;
+}
+
+TEST_CASE("HashedCountVectorizerEstimator") {
+    NS::Featurizers::HashedCountVectorizerEstimator         estimator(NS::CreateTestAnnotationMapsPtr(1), 2, 1024, true, AnalyzerMethod::Word, "", 1, 1, false);
+
+    CHECK(strcmp(estimator.Name, "HashedCountVectorizerEstimator") == 0);
+
+    estimator.begin_training();
+    estimator.complete_training();
+
+    CHECK(dynamic_cast<NS::Featurizers::HashedCountVectorizerTransformer *>(estimator.create_transformer().get()));
+}
+
+TEST_CASE("Invalid parameters") {
+    CHECK_THROWS_WITH(NS::Featurizers::HashedCountVectorizerTransformer(2, 0, false, false, AnalyzerMethod::Word, "", 1, 1), "numBuckets");
+    CHECK_THROWS_WITH(NS::Featurizers::HashedCountVectorizerTransformer(2, 1024, false, false, AnalyzerMethod::Word, "", 0, 1), "ngramRangeMin");
+    CHECK_THROWS_WITH(NS::Featurizers::HashedCountVectorizerEstimator(NS::CreateTestAnnotationMapsPtr(1), 2, 0, false, AnalyzerMethod::Word, "", 1, 1, false), "numBuckets");
+}
+
+TEST_CASE("Word counts") {
+    std::uint32_t const                     numBuckets(1 << 20);
+
+    // Ensure that the terms don't collide
+    REQUIRE(GetBucket("this", numBuckets) != GetBucket("is", numBuckets));
+    REQUIRE(GetBucket("this", numBuckets) != GetBucket("document", numBuckets));
+    REQUIRE(GetBucket("is", numBuckets) != GetBucket("document", numBuckets));
+
+    NS::Featurizers::HashedCountVectorizerTransformer       transformer(2, numBuckets, false, true, AnalyzerMethod::Word, "", 1, 1);
+
+    CHECK(
+        transformer.execute("THIS document is this DOCUMENT")
+        == TransformedType(numBuckets, CreateValues({{"this", 2}, {"document", 2}, {"is", 1}}, numBuckets))
+    );
+
+    // Scratch storage is reset between calls
+    CHECK(
+        transformer.execute("this is")
+        == TransformedType(numBuckets, CreateValues({{"this", 1}, {"is", 1}}, numBuckets))
+    );
+
+    // Consistent with CountVectorizerTransformer, documents without any terms produce an error
+    CHECK_THROWS_WITH(transformer.execute(""), "'values' is empty");
+}
+
+TEST_CASE("Binary and ngrams") {
+    std::uint32_t const                     numBuckets(1 << 20);
+
+    NS::Featurizers::HashedCountVectorizerTransformer       transformer(2, numBuckets, true, false, AnalyzerMethod::Word, "", 1, 2);
+
+    CHECK(
+        transformer.execute("a b a b")
+        == TransformedType(numBuckets, CreateValues({{"a", 1}, {"b", 1}, {"a b", 1}, {"b a", 1}}, numBuckets))
+    );
+}
+
+TEST_CASE("Collisions") {
+    // All terms map to the same bucket
+    NS::Featurizers::HashedCountVectorizerTransformer       transformer(2, 1, false, false, AnalyzerMethod::Word, "", 1, 1);
+
+    std::vector<TransformedType::ValueEncoding>             values;
+
+    values.emplace_back(4, 0);
+
+    CHECK(transformer.execute("one two three four") == TransformedType(1, std::move(values)));
+}
+
+TEST_CASE("Serialization/Deserialization") {
+    NS::Featurizers::HashedCountVectorizerTransformer       original(2, 1024, true, false, AnalyzerMethod::Char, "", 1, 3);
+    NS::Archive                             out;
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    NS::Featurizers::HashedCountVectorizerTransformer       other(in);
+
+    CHECK(other == original);
+    CHECK(other.execute("abc") == original.execute("abc"));
+}
+
+TEST_CASE("Serialization Version Error") {
+    NS::Archive                             out;
+
+    out.serialize(static_cast<std::uint16_t>(2));
+    out.serialize(static_cast<std::uint16_t>(0));
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(
+        NS::Featurizers::HashedCountVectorizerTransformer(in),
+        Catch::Contains("Unsupported archive version")
+    );
+}
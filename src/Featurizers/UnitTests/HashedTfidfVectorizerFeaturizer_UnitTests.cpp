@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../../Archive.h"
+#include "../HashedTfidfVectorizerFeaturizer.h"
+#include "../TestHelpers.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using AnalyzerMethod = NS::Featurizers::Components::AnalyzerMethod;
+using NormMethod = NS::Featurizers::HashedTfidfVectorizerTransformer::NormMethod;
+using TfidfPolicy = NS::Featurizers::TfidfPolicy;
+using TransformedType = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+static std::uint32_t const                  NumBuckets = 1 << 20;
+
+std::uint32_t GetBucket(std::string const &term) {
+    return NS::Featurizers::Components::GetTermBucket(term.begin(), term.end(), 2, NumBuckets);
+}
+
+std::vector<std::vector<std::string>> GetTrainingBatches(void) {
+    return NS::TestHelpers::make_vector<std::vector<std::string>>(
+        NS::TestHelpers::make_vector<std::string>("this is THE first document"),
+        NS::TestHelpers::make_vector<std::string>("this DOCUMENT is the second document"),
+        NS::TestHelpers::make_vector<std::string>("and this is the THIRD one"),
+        NS::TestHelpers::make_vector<std::string>("IS this THE first document")
+    );
+}
+
+TEST_CASE("HashedDocumentStatisticsEstimator") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NS::Featurizers::Components::HashedDocumentStatisticsEstimator<>   estimator(pAllColumnAnnotations, 0, true, AnalyzerMethod::Word, "", 1, 1, 2, NumBuckets);
+
+    NS::TestHelpers::Train(estimator, NS::TestHelpers::make_vector<std::string>("this is THE first document", "this DOCUMENT is the second document", "and this is the THIRD one"));
+
+    auto const &                            data(estimator.get_annotation_data());
+
+    CHECK(data.TotalNumDocuments == 3);
+    CHECK(data.DocumentFrequencies.size() == NumBuckets);
+
+    // Terms are counted once per document
+    CHECK(data.DocumentFrequencies[GetBucket("this")] == 3);
+    CHECK(data.DocumentFrequencies[GetBucket("document")] == 2);
+    CHECK(data.DocumentFrequencies[GetBucket("second")] == 1);
+    CHECK(data.DocumentFrequencies[GetBucket("missing")] == 0);
+}
+
+TEST_CASE("Matches TfidfVectorizer without collisions") {
+    for(auto const &params : {
+        TfidfPolicy::UseIdf | TfidfPolicy::SmoothIdf,
+        TfidfPolicy::UseIdf,
+        TfidfPolicy::UseIdf | TfidfPolicy::SublinearTf,
+        TfidfPolicy::Binary | TfidfPolicy::UseIdf | TfidfPolicy::SmoothIdf
+    }) {
+        for(auto const &norm : { NormMethod::L1, NormMethod::L2 }) {
+            auto const                      expected(
+                NS::TestHelpers::TransformerEstimatorTest(
+                    NS::Featurizers::TfidfVectorizerEstimator<>(NS::CreateTestAnnotationMapsPtr(1), 0, true, AnalyzerMethod::Word, "", norm, params),
+                    GetTrainingBatches(),
+                    NS::TestHelpers::make_vector<std::string>("THIS is the FIRST document document unknown")
+                )
+            );
+
+            auto const                      actual(
+                NS::TestHelpers::TransformerEstimatorTest(
+                    NS::Featurizers::HashedTfidfVectorizerEstimator<>(NS::CreateTestAnnotationMapsPtr(1), 0, 2, NumBuckets, true, AnalyzerMethod::Word, "", norm, params),
+                    GetTrainingBatches(),
+                    NS::TestHelpers::make_vector<std::string>("THIS is the FIRST document document unknown")
+                )
+            );
+
+            REQUIRE(actual.size() == 1);
+            CHECK(actual[0].NumElements == NumBuckets);
+
+            // The terms are the same, but the indexes are different; compare the values
+            // associated with each term.
+            std::map<std::string, std::float_t>     expectedValues;
+            std::map<std::string, std::float_t>     actualValues;
+
+            for(char const *term : { "this", "is", "the", "first", "document" }) {
+                for(auto const &value : actual[0].Values) {
+                    if(value.Index == GetBucket(term))
+                        actualValues[term] = value.Value;
+                }
+            }
+
+            // Vocabulary indexes are assigned in lexical order
+            std::vector<std::string> const  vocabulary({"and", "document", "first", "is", "one", "second", "the", "third", "this"});
+
+            for(auto const &value : expected[0].Values)
+                expectedValues[vocabulary[value.Index]] = value.Value;
+
+            REQUIRE(actual[0].Values.size() == expected[0].Values.size());
+            REQUIRE(actualValues.size() == expectedValues.size());
+
+            for(auto const &kvp : expectedValues)
+                CHECK(Approx(actualValues[kvp.first]) == kvp.second);
+
+            // Indexes are sorted
+            for(size_t index = 1; index < actual[0].Values.size(); ++index)
+                CHECK(actual[0].Values[index - 1].Index < actual[0].Values[index].Index);
+        }
+    }
+}
+
+TEST_CASE("Unknown terms") {
+    NS::Featurizers::HashedTfidfVectorizerTransformer       transformer(std::vector<std::uint32_t>(16, 0), 1, 2, NormMethod::L2, TfidfPolicy::UseIdf, false, AnalyzerMethod::Word, "", 1, 1);
+
+    // Consistent with TfidfVectorizerTransformer, documents without any known terms produce an error
+    CHECK_THROWS_WITH(transformer.execute("no buckets were encountered during training"), "'values' is empty");
+}
+
+TEST_CASE("Invalid parameters") {
+    CHECK_THROWS_WITH(NS::Featurizers::HashedTfidfVectorizerTransformer(std::vector<std::uint32_t>(), 1, 2, NormMethod::L2, TfidfPolicy::UseIdf, false, AnalyzerMethod::Word, "", 1, 1), "documentFrequencies");
+    CHECK_THROWS_WITH(NS::Featurizers::HashedTfidfVectorizerTransformer(std::vector<std::uint32_t>(16, 1), 0, 2, NormMethod::L2, TfidfPolicy::UseIdf, false, AnalyzerMethod::Word, "", 1, 1), "totalNumDocus");
+    CHECK_THROWS_WITH(NS::Featurizers::Components::HashedDocumentStatisticsEstimator<>(NS::CreateTestAnnotationMapsPtr(1), 0, true, AnalyzerMethod::Word, "", 1, 1, 2, 0), "numBuckets");
+}
+
+TEST_CASE("Serialization/Deserialization") {
+    NS::Featurizers::HashedTfidfVectorizerTransformer       original(std::vector<std::uint32_t>({1, 2, 3, 0}), 5, 2, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1);
+    NS::Archive                             out;
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    NS::Featurizers::HashedTfidfVectorizerTransformer       other(in);
+
+    CHECK(other == original);
+}
+
+TEST_CASE("Serialization Version Error") {
+    NS::Archive                             out;
+
+    out.serialize(static_cast<std::uint16_t>(2));
+    out.serialize(static_cast<std::uint16_t>(0));
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(
+        NS::Featurizers::HashedTfidfVectorizerTransformer(in),
+        Catch::Contains("Unsupported archive version")
+    );
+}
@@ -171,3 +171,23 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Batch") {
+    using TransformerType = NS::Featurizers::LabelEncoderTransformer<std::string>;
+
+    IndexMap<std::string, std::uint32_t> const      indexmap(
+        {
+            {"apple", 0},
+            {"orange", 1},
+            {"peach", 2}
+        }
+    );
+
+    std::vector<std::string> const          inputs{ "peach", "grape", "apple" };
+    std::vector<std::uint32_t>              outputs(inputs.size());
+
+    TransformerType(indexmap, true).execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::uint32_t>{ 3, 0, 1 });
+
+    CHECK_THROWS_WITH(TransformerType(indexmap, false).execute_batch(inputs.data(), inputs.size(), outputs.data()), "'input' was not found");
+}
@@ -127,3 +127,17 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Batch") {
+    NS::Featurizers::MaxAbsScalarTransformer<std::int8_t, std::double_t>    transformer(4.0);
+    NS::Featurizers::MaxAbsScalarTransformer<std::int8_t, std::double_t>    zeroTransformer(0.0);
+
+    std::vector<std::int8_t> const          inputs{ -4, 0, 2, 8 };
+    std::vector<std::double_t>              outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::double_t>{ -1.0, 0.0, 0.5, 2.0 });
+
+    zeroTransformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::double_t>{ -4.0, 0.0, 2.0, 8.0 });
+}
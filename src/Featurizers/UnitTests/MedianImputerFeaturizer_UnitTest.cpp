@@ -244,9 +244,35 @@ TEST_CASE("No inputs - nullable type") {
     CHECK_THROWS_WITH(estimator.complete_training(), "No elements were provided during training");
 }
 
+TEST_CASE("Approximate") {
+    std::vector<nonstd::optional<int>>      training;
+
+    for(int i = 0; i < 100000; ++i)
+        training.emplace_back(i % 10 == 0 ? nonstd::optional<int>() : nonstd::optional<int>(i * 7919 % 100000));
+
+    std::vector<float> const                results(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::MedianImputerEstimator<int, float>(NS::CreateTestAnnotationMapsPtr(1), 0, 0.01f),
+            training,
+            {
+                nonstd::optional<int>(),
+                1
+            }
+        )
+    );
+
+    REQUIRE(results.size() == 2);
+    CHECK(results[0] == Approx(50000.0f).margin(0.01f * 100000.0f));
+    CHECK(results[1] == 1.0f);
+}
+
 TEST_CASE("Exceptions") {
     CHECK_THROWS_WITH(
         (NS::Featurizers::MedianImputerEstimator<float, float>(NS::CreateTestAnnotationMapsPtr(1), 10)),
         "colIndex"
     );
+    CHECK_THROWS_WITH(
+        (NS::Featurizers::MedianImputerEstimator<float, float>(NS::CreateTestAnnotationMapsPtr(1), 0, 1.5f)),
+        "maxRankError"
+    );
 }
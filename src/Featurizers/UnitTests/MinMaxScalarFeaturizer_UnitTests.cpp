@@ -143,3 +143,62 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Batch") {
+    NS::Featurizers::MinMaxScalarTransformer<std::int8_t, std::double_t>    transformer(1, 9);
+
+    std::vector<std::int8_t> const          inputs{ 1, 3, 5, 15, -7 };
+    std::vector<std::double_t>              outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::double_t>{ 0.0, 0.25, 0.5, 1.75, -1.0 });
+
+    for(size_t i = 0; i < inputs.size(); ++i)
+        CHECK(outputs[i] == transformer.execute(inputs[i]));
+}
+
+TEST_CASE("Batch - zero span") {
+    NS::Featurizers::MinMaxScalarTransformer<std::int8_t, std::double_t>    transformer(-1, -1);
+
+    std::vector<std::int8_t> const          inputs{ -1, 2 };
+    std::vector<std::double_t>              outputs(inputs.size(), 1.0);
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::double_t>{ 0.0, 0.0 });
+}
+
+TEST_CASE("Batch - null values") {
+    NS::Featurizers::MinMaxScalarTransformer<std::float_t, std::double_t>   transformer(-1.0f, 1.0f);
+
+    std::vector<std::float_t> const         inputs{ -1.0f, NS::Traits<std::float_t>::CreateNullValue(), 2.0f };
+    std::vector<std::double_t>              outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+
+    CHECK(outputs[0] == 0.0);
+    CHECK(NS::Traits<std::double_t>::IsNull(outputs[1]));
+    CHECK(outputs[2] == 1.5);
+}
+
+TEST_CASE("Batch - large") {
+    NS::Featurizers::MinMaxScalarTransformer<std::float_t, std::float_t>    transformer(-3.0f, 17.0f);
+
+    std::vector<std::float_t>               inputs;
+
+    for(int i = 0; i < 1027; ++i)
+        inputs.push_back(static_cast<std::float_t>(i % 29) - 5.5f);
+
+    inputs[0] = NS::Traits<std::float_t>::CreateNullValue();
+    inputs[1026] = NS::Traits<std::float_t>::CreateNullValue();
+
+    std::vector<std::float_t>               outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+
+    for(size_t i = 0; i < inputs.size(); ++i) {
+        if(i == 0 || i == 1026)
+            CHECK(NS::Traits<std::float_t>::IsNull(outputs[i]));
+        else
+            CHECK(outputs[i] == transformer.execute(inputs[i]));
+    }
+}
@@ -117,6 +117,33 @@ TEST_CASE("unseen values") {
     );
 }
 
+TEST_CASE("execute_batch") {
+    using InputType       = std::string;
+    using TransformerType = NS::Featurizers::OneHotEncoderTransformer<InputType>;
+    using TransformedType = NS::Featurizers::SingleValueSparseVectorEncoding<std::uint8_t>;
+
+    TransformerType                         transformer(IndexMap<InputType>({{"apple", 0}, {"banana", 1}, {"grape", 2}}), false);
+
+    // TransformedType isn't move assignable, so the outputs are constructed in uninitialized storage
+    std::vector<InputType> const            inputs({"grape", "apple", "banana"});
+    std::vector<typename std::aligned_storage<sizeof(TransformedType), alignof(TransformedType)>::type>  storage(inputs.size());
+    TransformedType * const                 pOutputs(reinterpret_cast<TransformedType *>(storage.data()));
+
+    transformer.execute_batch(inputs.data(), inputs.size(), pOutputs);
+
+    CHECK(pOutputs[0] == TransformedType(3, 1, 2));
+    CHECK(pOutputs[1] == TransformedType(3, 1, 0));
+    CHECK(pOutputs[2] == TransformedType(3, 1, 1));
+
+    for(size_t i = 0; i < inputs.size(); ++i)
+        pOutputs[i].~TransformedType();
+
+    // The values constructed before the error are destroyed
+    std::vector<InputType> const            invalidInputs({"grape", "peach", "banana"});
+
+    CHECK_THROWS_WITH(transformer.execute_batch(invalidInputs.data(), invalidInputs.size(), pOutputs), "'input' was not found");
+}
+
 TEST_CASE("Serialization/Deserialization- Numeric") {
     using InputType       = std::uint32_t;
     using TransformerType = NS::Featurizers::OneHotEncoderTransformer<InputType>;
@@ -379,7 +379,8 @@ TEST_CASE("Invalid_fit ColMajor") {
     estimator.begin_training();
     estimator.fit(trainingMatrix);
 
-    CHECK_THROWS_WITH(estimator.fit(trainingMatrix), "`fit` should not be invoked on an estimator that is not training or is already finished/complete");
+    CHECK_THROWS_WITH(estimator.fit(MatrixT(3, 2)), "Input matrix cols() invalid");
+    CHECK_THROWS_WITH(estimator.fit(MatrixT()), "Input matrix size() invalid");
 }
 
 TEST_CASE("Invalid_fit RowMajor") {
@@ -404,7 +405,127 @@ TEST_CASE("Invalid_fit RowMajor") {
     estimator.begin_training();
     estimator.fit(trainingMatrix);
 
-    CHECK_THROWS_WITH(estimator.fit(trainingMatrix), "`fit` should not be invoked on an estimator that is not training or is already finished/complete");
+    CHECK_THROWS_WITH(estimator.fit(MatrixT(3, 2)), "Input matrix cols() invalid");
+    CHECK_THROWS_WITH(estimator.fit(MatrixT()), "Input matrix size() invalid");
+}
+
+TEST_CASE("Invalid_complete_training") {
+    using MatrixT = Eigen::MatrixX<float>;
+
+    NS::AnnotationMapsPtr const                        pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK_THROWS_WITH(NS::Featurizers::PCAEstimator<MatrixT>(pAllColumnAnnotations, 0, 0), "numThreads");
+
+    NS::Featurizers::PCAEstimator<MatrixT>             estimator(pAllColumnAnnotations, 0);
+
+    estimator.begin_training();
+    CHECK_THROWS_WITH(estimator.complete_training(), "No matrices were provided during training");
+}
+
+template <typename MatrixT>
+MatrixT CreateRandomMatrix(std::ptrdiff_t rows, std::ptrdiff_t cols) {
+    // Add an offset to each column so that the results depend on the mean being calculated correctly
+    MatrixT                                 matrix(MatrixT::Random(rows, cols));
+
+    for(std::ptrdiff_t col = 0; col < cols; ++col)
+        matrix.col(col).array() += static_cast<typename MatrixT::Scalar>(1000 * (col + 1));
+
+    return matrix;
+}
+
+TEST_CASE("CovarianceAccumulator") {
+    using MatrixT                           = Eigen::MatrixX<std::double_t>;
+    using Accumulator                       = NS::Featurizers::Details::CovarianceAccumulator<MatrixT>;
+
+    std::srand(42);
+
+    MatrixT const                           matrix(CreateRandomMatrix<MatrixT>(5000, 6));
+    MatrixT const                           centered(matrix.rowwise() - matrix.colwise().mean());
+    MatrixT const                           expectedScatter(centered.adjoint() * centered);
+
+    for(std::ptrdiff_t chunkSize : {5000, 2500, 1024, 999, 7, 1}) {
+        Accumulator                         accumulator;
+
+        for(std::ptrdiff_t row = 0; row < matrix.rows(); row += chunkSize)
+            accumulator.update(matrix, row, std::min(row + chunkSize, matrix.rows()));
+
+        CHECK(accumulator.numRows() == 5000);
+        CHECK((accumulator.mean() - matrix.colwise().mean()).norm() < 0.000001);
+        CHECK((accumulator.scatter() - expectedScatter).norm() / expectedScatter.norm() < 0.000001);
+    }
+
+    // Merging
+    Accumulator                             first;
+    Accumulator                             second;
+    Accumulator                             empty;
+
+    first.update(matrix, 0, 1234);
+    second.update(matrix, 1234, matrix.rows());
+
+    first.merge(second);
+    first.merge(empty);
+
+    CHECK(first.numRows() == 5000);
+    CHECK((first.mean() - matrix.colwise().mean()).norm() < 0.000001);
+    CHECK((first.scatter() - expectedScatter).norm() / expectedScatter.norm() < 0.000001);
+}
+
+template <typename MatrixT>
+void PCAChunkedTestImpl(void) {
+    using PCAEstimator                      = NS::Featurizers::PCAEstimator<MatrixT>;
+
+    std::srand(42);
+
+    MatrixT const                           matrix(CreateRandomMatrix<MatrixT>(10000, 5));
+    std::vector<MatrixT> const              inputContainers(NS::TestHelpers::make_vector<MatrixT>(matrix.topRows(10)));
+
+    auto const                              train(
+        [&matrix, &inputContainers](std::uint32_t numThreads, std::vector<std::ptrdiff_t> const &chunkSizes) {
+            std::vector<MatrixT>            chunks;
+            std::ptrdiff_t                  row(0);
+
+            for(std::ptrdiff_t chunkSize : chunkSizes) {
+                chunks.emplace_back(matrix.middleRows(row, chunkSize));
+                row += chunkSize;
+            }
+
+            REQUIRE(row == matrix.rows());
+
+            std::vector<MatrixT>            results(
+                NS::TestHelpers::TransformerEstimatorTest(
+                    PCAEstimator(NS::CreateTestAnnotationMapsPtr(1), 0, numThreads),
+                    // One chunk per call to `fit`
+                    [&chunks](void) {
+                        std::vector<std::vector<MatrixT>>   batches;
+
+                        for(auto &chunk : chunks)
+                            batches.emplace_back(NS::TestHelpers::make_vector<MatrixT>(std::move(chunk)));
+
+                        return batches;
+                    }(),
+                    inputContainers
+                )
+            );
+
+            REQUIRE(results.size() == 1);
+
+            // The sign of each component is arbitrary
+            return MatrixT(results[0].cwiseAbs());
+        }
+    );
+
+    MatrixT const                           expected(train(1, {10000}));
+
+    for(std::uint32_t numThreads : {1, 2, 4, 7}) {
+        CHECK(train(numThreads, {10000}).isApprox(expected, 0.001f));
+        CHECK(train(numThreads, {3000, 1, 4999, 2000}).isApprox(expected, 0.001f));
+    }
+}
+
+TEST_CASE("Chunked and multithreaded training") {
+    PCAChunkedTestImpl<Eigen::MatrixX<std::double_t>>();
+    PCAChunkedTestImpl<NS::RowMajMatrix<std::double_t>>();
+    PCAChunkedTestImpl<Eigen::MatrixX<std::float_t>>();
 }
 
 TEST_CASE("Different training and inferencing data ColMajor") {
@@ -584,6 +705,86 @@ TEST_CASE("Serialization/Deserialization RowMajor") {
     CHECK(other == original);
 }
 
+template <typename MatrixT>
+void DeserializationTest(void) {
+    using TransformerType = NS::Featurizers::PCATransformer<MatrixT>;
+
+    // Not square, so that the storage order matters
+    MatrixT eigenVectors(2, 3);
+    eigenVectors(0, 0) =  0.805059f;
+    eigenVectors(0, 1) = -0.315908f;
+    eigenVectors(0, 2) = -0.502078f;
+    eigenVectors(1, 0) =  0.204052f;
+    eigenVectors(1, 1) =  0.942225f;
+    eigenVectors(1, 2) = -0.265660f;
+
+    MatrixT input(1, 3);
+    input(0, 0) = 1.0f;
+    input(0, 1) = 2.0f;
+    input(0, 2) = 3.0f;
+
+    TransformerType                         original(eigenVectors);
+    MatrixT const                           expected(original.execute(input));
+
+    // Version 1.0
+    {
+        NS::Archive                         out;
+
+        NS::Traits<std::uint16_t>::serialize(out, 1);
+        NS::Traits<std::uint16_t>::serialize(out, 0);
+        NS::Traits<MatrixT>::serialize(out, eigenVectors);
+
+        NS::Archive                         in(out.commit());
+        TransformerType                     other(in);
+
+        CHECK(in.AtEnd());
+        CHECK(other == original);
+        CHECK(other.execute(input).isApprox(expected));
+    }
+
+    // In place
+    {
+        NS::Archive                         out;
+
+        original.save(out);
+
+        std::shared_ptr<NS::Archive::ByteArray const> const     pBytes(std::make_shared<NS::Archive::ByteArray>(out.commit()));
+        NS::Archive                         in(pBytes, pBytes->data(), pBytes->size());
+        TransformerType                     other(in);
+
+        CHECK(in.AtEnd());
+        CHECK(pBytes.use_count() > 2);
+        CHECK(other == original);
+        CHECK(other.getEigenVectorRowsNumber() == 2);
+        CHECK(other.getEigenVectorColsNumber() == 3);
+        CHECK(other.execute(input).isApprox(expected));
+    }
+
+    // Invalid shape
+    {
+        NS::Archive                         out;
+        std::vector<float> const            data{1.0f, 2.0f, 3.0f};
+
+        NS::Traits<std::uint16_t>::serialize(out, 1);
+        NS::Traits<std::uint16_t>::serialize(out, 1);
+        NS::Traits<std::uint64_t>::serialize(out, 2);
+        NS::Traits<std::uint64_t>::serialize(out, 2);
+        out.serialize_array(data.data(), data.size());
+
+        NS::Archive                         in(out.commit());
+
+        CHECK_THROWS_WITH(TransformerType(in), "eigenvectors");
+    }
+}
+
+TEST_CASE("Deserialization ColMajor") {
+    DeserializationTest<Eigen::MatrixX<float>>();
+}
+
+TEST_CASE("Deserialization RowMajor") {
+    DeserializationTest<NS::RowMajMatrix<float>>();
+}
+
 TEST_CASE("Serialization Version Error ColMajor") {
     NS::Archive                             out;
 
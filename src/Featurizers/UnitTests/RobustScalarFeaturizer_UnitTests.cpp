@@ -286,3 +286,59 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Batch") {
+    NS::Featurizers::RobustScalarTransformer<std::int8_t, std::double_t>    transformer(1.0, 2.0);
+    NS::Featurizers::RobustScalarTransformer<std::int8_t, std::double_t>    zeroTransformer(1.0, 0.0);
+
+    std::vector<std::int8_t> const          inputs{ -1, 1, 2, 9 };
+    std::vector<std::double_t>              outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::double_t>{ -1.0, 0.0, 0.5, 4.0 });
+
+    zeroTransformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+    CHECK(outputs == std::vector<std::double_t>{ -2.0, 0.0, 1.0, 8.0 });
+}
+
+TEST_CASE("Outliers") {
+    // The scale is the interquartile range, which isn't influenced by the outlier
+    CHECK(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::RobustScalarEstimator<std::int32_t, std::double_t>::CreateWithDefaultScaling(NS::CreateTestAnnotationMapsPtr(1), 0, true),
+            std::vector<std::int32_t>{ 1, 2, 1000, 3, 4 },
+            std::vector<std::int32_t>{ 3, 5, 1000 }
+        ) == std::vector<std::double_t>{ 0.0, 1.0, 498.5 }
+    );
+}
+
+TEST_CASE("Approximate") {
+    std::vector<std::int32_t>               training;
+
+    for(std::int32_t i = 0; i < 100000; ++i)
+        training.emplace_back(i * 7919 % 100000);
+
+    std::vector<std::double_t> const        results(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::RobustScalarEstimator<std::int32_t, std::double_t>(NS::CreateTestAnnotationMapsPtr(1), 0, true, 25.0f, 75.0f, 0.01f),
+            training,
+            std::vector<std::int32_t>{ 50000, 100000 }
+        )
+    );
+
+    // median ~= 50000, scale ~= 50000
+    REQUIRE(results.size() == 2);
+    CHECK(results[0] == Approx(0.0).margin(0.02));
+    CHECK(results[1] == Approx(1.0).margin(0.05));
+}
+
+TEST_CASE("Exceptions") {
+    CHECK_THROWS_WITH(
+        (NS::Featurizers::RobustScalarEstimator<std::int8_t, std::double_t>(NS::CreateTestAnnotationMapsPtr(1), 0, true, 25.0f, 75.0f, 1.5f)),
+        "maxRankError"
+    );
+    CHECK_THROWS_WITH(
+        (NS::Featurizers::RobustScalarEstimator<std::int8_t, std::double_t>(NS::CreateTestAnnotationMapsPtr(1), 0, true, 75.0f, 25.0f)),
+        "qRangeMax"
+    );
+}
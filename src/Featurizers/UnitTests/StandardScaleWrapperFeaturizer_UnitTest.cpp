@@ -578,3 +578,39 @@ TEST_CASE("Serialization/Deserialization") {
     TransformerType modelLoaded(loader);
     CHECK(modelLoaded==*model);
 }
+
+TEST_CASE("Batch") {
+    NS::Featurizers::StandardScalerTransformer<std::float_t, std::double_t>    transformer(2.0, 4.0);
+
+    std::vector<std::float_t>               inputs;
+
+    for(int i = 0; i < 37; ++i)
+        inputs.push_back(static_cast<std::float_t>(i));
+
+    inputs[5] = NS::Traits<std::float_t>::CreateNullValue();
+    inputs[33] = NS::Traits<std::float_t>::CreateNullValue();
+
+    std::vector<std::double_t>              outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+
+    for(size_t i = 0; i < inputs.size(); ++i) {
+        if(i == 5 || i == 33)
+            CHECK(NS::Traits<std::double_t>::IsNull(outputs[i]));
+        else
+            CHECK(outputs[i] == transformer.execute(inputs[i]));
+    }
+}
+
+TEST_CASE("Batch - nullable input") {
+    NS::Featurizers::StandardScalerTransformer<nonstd::optional<std::int32_t>, std::float_t>   transformer(2.0, 4.0);
+
+    std::vector<nonstd::optional<std::int32_t>> const   inputs{ 2, nonstd::optional<std::int32_t>(), 10 };
+    std::vector<std::float_t>               outputs(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), outputs.data());
+
+    CHECK(outputs[0] == 0.0f);
+    CHECK(NS::Traits<std::float_t>::IsNull(outputs[1]));
+    CHECK(outputs[2] == 2.0f);
+}
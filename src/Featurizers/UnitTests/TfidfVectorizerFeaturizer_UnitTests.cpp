@@ -5,8 +5,12 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <cstdio>
+#include <fstream>
+
 #include "../../3rdParty/optional.h"
 #include "../../Archive.h"
+#include "../../MemoryMappedFile.h"
 #include "../TfidfVectorizerFeaturizer.h"
 #include "../Structs.h"
 #include "../TestHelpers.h"
@@ -846,6 +850,108 @@ TEST_CASE("Serialization/Deserialization") {
     CHECK(other == original);
 }
 
+TEST_CASE("Deserialization - version 1.0") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+
+    IndexMap indexMap(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3}
+        }
+    );
+
+    NS::Archive                             out;
+
+    NS::Traits<std::uint16_t>::serialize(out, 1);
+    NS::Traits<std::uint16_t>::serialize(out, 0);
+    NS::Traits<IndexMap>::serialize(out, indexMap);
+    NS::Traits<IndexMap>::serialize(out, indexMap);
+    NS::Traits<std::uint32_t>::serialize(out, 5);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(NormMethod::L2));
+    NS::Traits<unsigned int>::serialize(out, static_cast<unsigned int>(TfidfPolicy::UseIdf));
+    NS::Traits<bool>::serialize(out, true);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(AnalyzerMethod::Word));
+    NS::Traits<std::string>::serialize(out, "");
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+
+    NS::Archive                             in(out.commit());
+
+    CHECK(TransformerType(in) == TransformerType(indexMap, indexMap, 5, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1));
+}
+
+TEST_CASE("Deserialization - memory-mapped") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+
+    IndexMap indexMap(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3},
+            {"orange", 4},
+            {"peach", 5}
+        }
+    );
+
+    TransformerType                         original(indexMap, indexMap, 5, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1);
+    NS::Archive                             out;
+
+    original.save(out);
+
+    std::string const                       filename("TfidfVectorizerFeaturizer_UnitTests.bin");
+    NS::Archive::ByteArray const            bytes(out.commit());
+
+    {
+        std::ofstream                       stream(filename, std::ios::binary);
+
+        stream.write(reinterpret_cast<char const *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    {
+        NS::Archive                         in(NS::CreateMappedArchive(filename));
+        TransformerType                     other(in);
+
+        CHECK(in.AtEnd());
+        CHECK(other == original);
+        SparseVectorNumericCheck(other.execute("orange apple orange kiwi"), original.execute("orange apple orange kiwi"));
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Deserialization - invalid idfs") {
+    IndexMap indexMap(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3}
+        }
+    );
+
+    std::vector<std::uint32_t> const        documentFrequencies({1, 2, 3});
+    std::vector<double> const               idfs({1.0, 2.0});
+    NS::Archive                             out;
+
+    NS::Traits<std::uint16_t>::serialize(out, 1);
+    NS::Traits<std::uint16_t>::serialize(out, 1);
+    NS::Featurizers::Components::VocabularyIndex(indexMap).save(out);
+    out.serialize_array(documentFrequencies.data(), documentFrequencies.size());
+    out.serialize_array(idfs.data(), idfs.size());
+    NS::Traits<std::uint32_t>::serialize(out, 5);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(NormMethod::L2));
+    NS::Traits<unsigned int>::serialize(out, static_cast<unsigned int>(TfidfPolicy::UseIdf));
+    NS::Traits<bool>::serialize(out, true);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(AnalyzerMethod::Word));
+    NS::Traits<std::string>::serialize(out, "");
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(NS::Featurizers::TfidfVectorizerTransformer(in), "idfs");
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
@@ -38,7 +38,7 @@ using TransformedType = std::vector<
 >;
 
 TransformedType Test(std::vector<std::vector<InputType>> const &trainingBatches, std::vector<InputType> const &inferenceBatches
-,std::vector<NS::TypeId> colsToImputeDataTypes, bool supressError, NS::Featurizers::Components::TimeSeriesImputeStrategy tsImputeStrategy) {
+,std::vector<NS::TypeId> colsToImputeDataTypes, bool supressError, NS::Featurizers::Components::TimeSeriesImputeStrategy tsImputeStrategy, std::uint64_t maxBufferedRowsPerGrain = 0) {
     using KeyT                      = std::vector<std::string>;
     using ColsToImputeT             = std::vector<nonstd::optional<std::string>>;
     using InputBatchesType          = std::vector<std::vector<InputType>>;
@@ -49,6 +49,9 @@ TransformedType Test(std::vector<std::vector<InputType>> const &trainingBatches,
 
     NS::TestHelpers::Train<TSImputerEstimator, InputType>(estimator, trainingBatches);
     TSImputerEstimator::TransformerUniquePtr                  pTransformer(estimator.create_transformer());
+
+    // The spill limit is a runtime setting of the imputer's transformer
+    static_cast<TSImputerEstimator::TransformerType &>(*pTransformer).get_transformer<2>().set_max_buffered_rows_per_grain(maxBufferedRowsPerGrain);
     TransformedType   	  output;
     auto const              callback(
         [&output](typename TransformedType::value_type value) {
@@ -493,6 +496,51 @@ TEST_CASE("ColumnImputation (bfill): 2 grains (ValidRow, EmptyRow, EmptyRow, Val
                 },{NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward) == output);
     }
 
+TEST_CASE("ColumnImputation (bfill): 2 grains flushed in grain order") {
+    // Grain "b" is seen before grain "a", but buffered rows are flushed in grain order
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"114.5","118"}),
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5","18"}),
+                    std::make_tuple(false,GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"30.5"}),
+                    std::make_tuple(false,GetTimePoint(now,1), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"120.5",nonstd::optional<std::string>{}})
+                };
+    CHECK(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"114.5","118"}),
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5","18"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"120.5","130.5"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"20.5","30.5"})
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"114.5","118"}),
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"14.5","18"}),
+                    std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"120.5",nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"30.5"})
+                },{NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward) == output);
+    }
+
+TEST_CASE("ColumnImputation (bfill): columns filled independently, with spilling") {
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<InputType> input = {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1","2"}),
+                    std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"3"}),
+                    std::make_tuple(GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"4",nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5","6"})
+                };
+    TransformedType output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1","2"}),
+                    std::make_tuple(false,GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"4","3"}),
+                    std::make_tuple(true,GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"4","6"}),
+                    std::make_tuple(false,GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"4","6"}),
+                    std::make_tuple(false,GetTimePoint(now,4), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"5","6"})
+                };
+
+    CHECK(Test({input}, input, {NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward) == output);
+    CHECK(Test({input}, input, {NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward, 1) == output);
+}
+
 TEST_CASE("ColumnImputation (Median): 1 grain (EmptyRow)") {
     std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
     std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
@@ -578,6 +626,30 @@ TEST_CASE("ColumnImputation (Median): 2 grains (EmptyRow, EmptyRow)") {
                 },{NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Median) == output);
     }
 
+TEST_CASE("ColumnImputation (Median): skewed values") {
+    // The median (rather than the mean) of each grain and column is used
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::vector<std::tuple<bool,std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>> output = {
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2.000000","30.000000"}),
+                    std::make_tuple(false,GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"-3.000000","6.000000"})
+                };
+    CHECK(Test({
+                    {
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1","20"}),
+                        std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"-1000","4"}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"100","1000"}),
+                        std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2",nonstd::optional<std::string>{}}),
+                        std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"-3","8"}),
+                        std::make_tuple(GetTimePoint(now,3), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},"30"}),
+                        std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{"-2",nonstd::optional<std::string>{}}),
+                    }
+                },
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},nonstd::optional<std::string>{}}),
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"b"}, std::vector<nonstd::optional<std::string>>{nonstd::optional<std::string>{},nonstd::optional<std::string>{}})
+                },{NS::TypeId::Float64,NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Median) == output);
+    }
+
 TEST_CASE("Suppress Error: Median on unsupported column types") {
     std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
     CHECK_THROWS_WITH(Test({
@@ -923,12 +995,16 @@ TEST_CASE("Serialization") {
     auto const                                          pTransformer(estimator.create_transformer());
     NS::Archive                                         out;
 
+    static_cast<NS::Featurizers::TimeSeriesImputerEstimator::TransformerType &>(*pTransformer).get_transformer<2>().set_max_buffered_rows_per_grain(10);
     pTransformer->save(out);
 
     NS::Archive                                                             in(out.commit());
     NS::Featurizers::TimeSeriesImputerEstimator::TransformerType            other(in);
 
     CHECK(other == static_cast<NS::Featurizers::TimeSeriesImputerEstimator::TransformerType const &>(*pTransformer));
+
+    // The spill limit is a runtime setting, so it isn't serialized
+    CHECK(other.get_transformer<2>().get_max_buffered_rows_per_grain() == 0);
 }
 
 TEST_CASE("Serialization Version Error") {
@@ -944,3 +1020,121 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+using NumericRow = NS::Featurizers::Components::NumericTimeSeriesRow;
+using NumericInputType = NS::Featurizers::Components::NumericTimeSeriesImputerEstimatorInputType;
+using NumericTransformedType = std::vector<NS::Featurizers::Components::NumericTimeSeriesImputerEstimatorTransformedType>;
+
+NumericTransformedType NumericTest(std::vector<NumericInputType> const &training, std::vector<NumericInputType> const &inference, NS::Featurizers::Components::TimeSeriesImputeStrategy tsImputeStrategy) {
+    using Estimator                 = NS::Featurizers::NumericTimeSeriesImputerEstimator;
+
+    NS::AnnotationMapsPtr const     pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator                       estimator(pAllColumnAnnotations, std::get<2>(training.front()).size(), false, tsImputeStrategy);
+
+    NS::TestHelpers::Train<Estimator, NumericInputType>(estimator, std::vector<std::vector<NumericInputType>>{training});
+
+    Estimator::TransformerUniquePtr pTransformer(estimator.create_transformer());
+    NumericTransformedType          output;
+    auto const                      callback(
+        [&output](NumericTransformedType::value_type value) {
+            output.emplace_back(std::move(value));
+        }
+    );
+
+    for(auto const &item : inference)
+        pTransformer->execute(item, callback);
+
+    pTransformer->flush(callback);
+
+    return output;
+}
+
+TEST_CASE("Numeric: ffill, bfill and median") {
+    std::chrono::system_clock::time_point const     now(std::chrono::system_clock::now());
+    std::double_t const                             nan(NS::Traits<std::double_t>::CreateNullValue());
+
+    std::vector<NumericInputType> const             training{
+        std::make_tuple(GetTimePoint(now,0), 1u, NumericRow{1.0, 10.0}),
+        std::make_tuple(GetTimePoint(now,0), 2u, NumericRow{-1.0, nan}),
+        std::make_tuple(GetTimePoint(now,1), 1u, NumericRow{100.0, nan}),
+        std::make_tuple(GetTimePoint(now,2), 1u, NumericRow{2.0, 30.0}),
+        std::make_tuple(GetTimePoint(now,1), 2u, NumericRow{-3.0, 5.0})
+    };
+
+    std::vector<NumericInputType> const             inference{
+        std::make_tuple(GetTimePoint(now,0), 1u, NumericRow{1.0, nan}),
+        std::make_tuple(GetTimePoint(now,2), 1u, NumericRow{nan, 3.0})
+    };
+
+    CHECK(
+        NumericTest(training, inference, NS::Featurizers::Components::TimeSeriesImputeStrategy::Median) == NumericTransformedType{
+            std::make_tuple(false, GetTimePoint(now,0), 1u, NumericRow{1.0, 20.0}),
+            std::make_tuple(true, GetTimePoint(now,1), 1u, NumericRow{2.0, 20.0}),
+            std::make_tuple(false, GetTimePoint(now,2), 1u, NumericRow{2.0, 3.0})
+        }
+    );
+
+    CHECK(
+        NumericTest(
+            training,
+            {
+                std::make_tuple(GetTimePoint(now,0), 1u, NumericRow{1.0, 2.0}),
+                std::make_tuple(GetTimePoint(now,2), 1u, NumericRow{nan, 3.0})
+            },
+            NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward
+        ) == NumericTransformedType{
+            std::make_tuple(false, GetTimePoint(now,0), 1u, NumericRow{1.0, 2.0}),
+            std::make_tuple(true, GetTimePoint(now,1), 1u, NumericRow{1.0, 2.0}),
+            std::make_tuple(false, GetTimePoint(now,2), 1u, NumericRow{1.0, 3.0})
+        }
+    );
+
+    CHECK(
+        NumericTest(
+            training,
+            {
+                std::make_tuple(GetTimePoint(now,0), 1u, NumericRow{1.0, nan}),
+                std::make_tuple(GetTimePoint(now,2), 1u, NumericRow{4.0, 3.0})
+            },
+            NS::Featurizers::Components::TimeSeriesImputeStrategy::Backward
+        ) == NumericTransformedType{
+            std::make_tuple(false, GetTimePoint(now,0), 1u, NumericRow{1.0, 3.0}),
+            std::make_tuple(true, GetTimePoint(now,1), 1u, NumericRow{4.0, 3.0}),
+            std::make_tuple(false, GetTimePoint(now,2), 1u, NumericRow{4.0, 3.0})
+        }
+    );
+}
+
+TEST_CASE("Numeric: Serialization") {
+    NS::AnnotationMapsPtr const                             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NS::Featurizers::NumericTimeSeriesImputerEstimator      estimator(pAllColumnAnnotations, 1, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Median);
+    std::chrono::system_clock::time_point const             now(std::chrono::system_clock::now());
+
+    NS::TestHelpers::Train<NS::Featurizers::NumericTimeSeriesImputerEstimator, NumericInputType>(
+        estimator,
+        std::vector<std::vector<NumericInputType>>{
+            {
+                std::make_tuple(GetTimePoint(now,0), 7u, NumericRow{1.0}),
+                std::make_tuple(GetTimePoint(now,1), 7u, NumericRow{2.0}),
+                std::make_tuple(GetTimePoint(now,0), 8u, NumericRow{3.0})
+            }
+        }
+    );
+
+    auto const                                              pTransformer(estimator.create_transformer());
+    NS::Archive                                             out;
+
+    pTransformer->save(out);
+
+    NS::Archive                                                                 in(out.commit());
+    NS::Featurizers::NumericTimeSeriesImputerEstimator::TransformerType         other(in);
+
+    CHECK(other == static_cast<NS::Featurizers::NumericTimeSeriesImputerEstimator::TransformerType const &>(*pTransformer));
+}
+
+TEST_CASE("Numeric: Invalid number of columns") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK_THROWS_WITH(NS::Featurizers::NumericTimeSeriesImputerEstimator(pAllColumnAnnotations, NumericRow::MaxNumColumns + 1), "numColsToImpute");
+    CHECK_THROWS_WITH(NumericRow(NumericRow::MaxNumColumns + 1, 0.0), "numColumns");
+}
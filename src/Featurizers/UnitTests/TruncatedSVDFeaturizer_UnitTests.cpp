@@ -345,6 +345,125 @@ TEST_CASE("Invalid_fit RowMajor") {
     CHECK_THROWS_WITH(estimator.fit(trainingMatrix), "`fit` should not be invoked on an estimator that is not training or is already finished/complete");
 }
 
+TEST_CASE("Invalid_fit empty") {
+    using MatrixT = Eigen::MatrixX<float>;
+
+    NS::Featurizers::TruncatedSVDEstimator<MatrixT>    estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    estimator.begin_training();
+    CHECK_THROWS_WITH(estimator.fit(MatrixT()), "Input matrix size() invalid");
+}
+
+// Creates a matrix whose singular values decay geometrically, with roughly 90% of the values set to 0
+template <typename T>
+NS::ColMajMatrix<T> CreateTestMatrix(Eigen::Index rows, Eigen::Index cols) {
+    using Matrix                            = NS::ColMajMatrix<T>;
+
+    std::srand(42);
+
+    Matrix                                  result(Matrix::Zero(rows, cols));
+
+    for(Eigen::Index col = 0; col < cols; ++col) {
+        T const                             scale(static_cast<T>(std::pow(0.8, static_cast<double>(col))));
+
+        for(Eigen::Index row = 0; row < rows; ++row) {
+            if(std::rand() % 10 == 0)
+                result(row, col) = scale * static_cast<T>(std::rand() % 100 + 1);
+        }
+    }
+
+    return result;
+}
+
+template <typename MatrixT>
+typename NS::InputMatrixTypeMapper<MatrixT>::OutType TrainAndTransform(MatrixT const &matrix, std::uint32_t numComponents, std::uint32_t numOversamples, std::uint32_t numPowerIterations) {
+    std::srand(1234);
+
+    std::vector<typename NS::InputMatrixTypeMapper<MatrixT>::OutType> results(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::TruncatedSVDEstimator<MatrixT>(NS::CreateTestAnnotationMapsPtr(1), 0, numComponents, numOversamples, numPowerIterations),
+            NS::TestHelpers::make_vector<std::vector<MatrixT>>(NS::TestHelpers::make_vector<MatrixT>(matrix)),
+            NS::TestHelpers::make_vector<MatrixT>(matrix)
+        )
+    );
+
+    REQUIRE(results.size() == 1);
+    return std::move(results[0]);
+}
+
+TEST_CASE("Sparse input") {
+    using Dense                             = NS::ColMajMatrix<std::double_t>;
+    using CSR                               = Eigen::SparseMatrix<std::double_t, Eigen::RowMajor>;
+    using CSC                               = Eigen::SparseMatrix<std::double_t, Eigen::ColMajor>;
+
+    Dense const                             dense(CreateTestMatrix<std::double_t>(500, 40));
+    CSR const                               csr(dense.sparseView());
+    CSC const                               csc(dense.sparseView());
+
+    // The columns of the transformed matrix are the left singular vectors
+    // scaled by the singular values
+    Eigen::JacobiSVD<Dense> const           svd(dense);
+    Eigen::VectorXd const                   expected(svd.singularValues().head(5));
+
+    for(std::uint32_t numPowerIterations : {4, 7}) {
+        Dense const                         fromDense(TrainAndTransform(dense, 5, 10, numPowerIterations));
+        Dense const                         fromCSR(TrainAndTransform(csr, 5, 10, numPowerIterations));
+        Dense const                         fromCSC(TrainAndTransform(csc, 5, 10, numPowerIterations));
+
+        REQUIRE(fromDense.rows() == 500);
+        REQUIRE(fromDense.cols() == 5);
+
+        for(Eigen::Index col = 0; col < 5; ++col)
+            CHECK(fromDense.col(col).norm() == Approx(expected(col)).epsilon(0.001));
+
+        CHECK(fromCSR.isApprox(fromDense, 0.000001));
+        CHECK(fromCSC.isApprox(fromDense, 0.000001));
+    }
+
+    // All components
+    Dense const                             all(TrainAndTransform(csr, 40, 0, 0));
+
+    REQUIRE(all.cols() == 40);
+
+    for(Eigen::Index col = 0; col < 40; ++col)
+        CHECK(all.col(col).norm() == Approx(svd.singularValues()(col)).epsilon(0.001));
+
+    // numComponents is limited by the rank
+    CHECK(TrainAndTransform(csr, 100, 10, 0).cols() == 40);
+
+    // numComponents must be provided for sparse input
+    CHECK_THROWS_WITH(NS::Featurizers::TruncatedSVDEstimator<CSR>(NS::CreateTestAnnotationMapsPtr(1), 0), "numComponents");
+    CHECK_THROWS_WITH(NS::Featurizers::TruncatedSVDEstimator<CSC>(NS::CreateTestAnnotationMapsPtr(1), 0), "numComponents");
+    CHECK(TrainAndTransform(dense, 0, 0, 0).cols() == 40);
+}
+
+TEST_CASE("CreateSparseMatrix") {
+    using Encoding                          = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+    using CSR                               = Eigen::SparseMatrix<std::float_t, Eigen::RowMajor>;
+
+    std::vector<Encoding>                   rows;
+
+    rows.emplace_back(5, NS::TestHelpers::make_vector<Encoding::ValueEncoding>(Encoding::ValueEncoding(1.0f, 0), Encoding::ValueEncoding(2.0f, 3)));
+    rows.emplace_back(5, NS::TestHelpers::make_vector<Encoding::ValueEncoding>(Encoding::ValueEncoding(0.0f, 1)));
+    rows.emplace_back(5, NS::TestHelpers::make_vector<Encoding::ValueEncoding>(Encoding::ValueEncoding(3.0f, 4)));
+
+    CSR const                               matrix(NS::Featurizers::CreateSparseMatrix<CSR>(rows));
+
+    CHECK(matrix.rows() == 3);
+    CHECK(matrix.cols() == 5);
+    CHECK(matrix.coeff(0, 0) == 1.0f);
+    CHECK(matrix.coeff(1, 1) == 0.0f);
+    CHECK(matrix.coeff(0, 3) == 2.0f);
+    CHECK(matrix.coeff(2, 4) == 3.0f);
+
+    rows.emplace_back(6, NS::TestHelpers::make_vector<Encoding::ValueEncoding>(Encoding::ValueEncoding(1.0f, 5)));
+    CHECK_THROWS_WITH(NS::Featurizers::CreateSparseMatrix<CSR>(rows), "rows");
+
+    rows.pop_back();
+    rows.emplace_back(5, NS::TestHelpers::make_vector<Encoding::ValueEncoding>(Encoding::ValueEncoding(1.0f, 5)));
+    CHECK_THROWS_WITH(NS::Featurizers::CreateSparseMatrix<CSR>(rows), "value.Index");
+}
+
 TEST_CASE("Different training and inferencing data ColMajor") {
     using MatrixType = Eigen::MatrixX<std::double_t>;
 
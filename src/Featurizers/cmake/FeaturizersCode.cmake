@@ -12,6 +12,8 @@ add_library(FeaturizersCode STATIC
     ${_this_path}/../DateTimeFeaturizer.h
     ${_this_path}/../DateTimeFeaturizer.cpp
     ${_this_path}/../FromStringFeaturizer.h
+    ${_this_path}/../HashedCountVectorizerFeaturizer.h
+    ${_this_path}/../HashedTfidfVectorizerFeaturizer.h
     ${_this_path}/../HashOneHotVectorizerFeaturizer.h
     ${_this_path}/../ImputationMarkerFeaturizer.h
     ${_this_path}/../L1NormalizeFeaturizer.h
@@ -41,6 +43,7 @@ add_library(FeaturizersCode STATIC
     ${_this_path}/../Components/Components.h
     ${_this_path}/../Components/DocumentStatisticsEstimator.h
     ${_this_path}/../Components/GrainEstimatorImpl.h
+    ${_this_path}/../Components/HashedDocumentStatisticsEstimator.h
     ${_this_path}/../Components/HistogramEstimator.h
     ${_this_path}/../Components/ImputerTransformer.h
     ${_this_path}/../Components/IndexMapEstimator.h
@@ -52,6 +55,7 @@ add_library(FeaturizersCode STATIC
     ${_this_path}/../Components/NormUpdaters.h
     ${_this_path}/../Components/OrderEstimator.h
     ${_this_path}/../Components/PipelineExecutionEstimatorImpl.h
+    ${_this_path}/../Components/ScaleKernels.h
     ${_this_path}/../Components/StandardDeviationEstimator.h
     ${_this_path}/../Components/StatisticalMetricsEstimator.h
     ${_this_path}/../Components/TimeSeriesFrequencyEstimator.h
@@ -59,6 +63,7 @@ add_library(FeaturizersCode STATIC
     ${_this_path}/../Components/TimeSeriesMedianEstimator.h
     ${_this_path}/../Components/TrainingOnlyEstimatorImpl.h
     ${_this_path}/../Components/VectorNormsEstimator.h
+    ${_this_path}/../Components/VocabularyIndex.h
 
     ${_this_path}/../Components/Details/EstimatorTraits.h
     ${_this_path}/../Components/Details/PipelineExecutionEstimatorImpl_details.h
@@ -66,8 +71,32 @@ add_library(FeaturizersCode STATIC
     ${_this_path}/../Base/NormalizeFeaturizer.h
 )
 
-file(GLOB JSON_DATA "${_this_path}/../DateTimeFeaturizerData/GeneratedCode/*.json")
+# DocumentStatisticsEstimator can train on multiple threads
+find_package(Threads REQUIRED)
+target_link_libraries(FeaturizersCode PUBLIC Threads::Threads)
 
-foreach(df ${JSON_DATA})
-    file(COPY ${df} DESTINATION Data/DateTimeFeaturizer)
-endforeach()
+# The binary holiday data loaded by DateTimeTransformer is generated from the
+# JSON files during the build.
+if(CMAKE_VERSION VERSION_LESS 3.12)
+    find_package(PythonInterp 3 REQUIRED)
+    set(_featurizers_python "${PYTHON_EXECUTABLE}")
+else()
+    find_package(Python3 COMPONENTS Interpreter REQUIRED)
+    set(_featurizers_python "${Python3_EXECUTABLE}")
+endif()
+
+file(GLOB _holiday_json_files "${_this_path}/../DateTimeFeaturizerData/GeneratedCode/*.json")
+
+set(_holiday_data "${CMAKE_CURRENT_BINARY_DIR}/Data/DateTimeFeaturizer/Holidays.bin")
+
+add_custom_command(
+    OUTPUT "${_holiday_data}"
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${CMAKE_CURRENT_BINARY_DIR}/Data/DateTimeFeaturizer"
+    COMMAND "${_featurizers_python}" "${_this_path}/../DateTimeFeaturizerData/Tools/HolidayBlob.py" "${_this_path}/../DateTimeFeaturizerData/GeneratedCode" "${_holiday_data}"
+    DEPENDS "${_this_path}/../DateTimeFeaturizerData/Tools/HolidayBlob.py" ${_holiday_json_files}
+    COMMENT "Generating Holidays.bin"
+    VERBATIM
+)
+
+add_custom_target(FeaturizersHolidayData ALL DEPENDS "${_holiday_data}")
+add_dependencies(FeaturizersCode FeaturizersHolidayData)
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Archive.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#   if (!defined NOMINMAX)
+#       define NOMINMAX
+#   endif
+
+#   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MemoryMappedFile
+///  \brief         Read-only, shared mapping of a file. Pages are shared by all
+///                 processes that map the same file, so large read-only data
+///                 (such as serialized transformers) is only resident once.
+///
+class MemoryMappedFile {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    MemoryMappedFile(std::string const &filename);
+    ~MemoryMappedFile(void);
+
+    MemoryMappedFile(MemoryMappedFile const &) = delete;
+    MemoryMappedFile & operator =(MemoryMappedFile const &) = delete;
+
+    unsigned char const * data(void) const;
+    size_t size(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    unsigned char const *                   _pData;
+    size_t                                  _cData;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CreateMappedArchive
+///  \brief         Returns an `Archive` that deserializes from a memory-mapped
+///                 file. The mapping remains valid for as long as the `Archive`
+///                 or any array deserialized in place from it (see
+///                 `Archive::deserialize_array`) is alive.
+///
+inline Archive CreateMappedArchive(std::string const &filename) {
+    std::shared_ptr<MemoryMappedFile const> const   pFile(std::make_shared<MemoryMappedFile>(filename));
+
+    return Archive(pFile, pFile->data(), pFile->size());
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline MemoryMappedFile::MemoryMappedFile(std::string const &filename) :
+    _pData(nullptr),
+    _cData(0) {
+#if (defined _WIN32)
+    HANDLE const                            hFile(CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+
+    if(hFile == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("Unable to open the file");
+
+    LARGE_INTEGER                           fileSize;
+    HANDLE const                            hMapping(
+        GetFileSizeEx(hFile, &fileSize) && fileSize.QuadPart != 0
+            ? CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr)
+            : nullptr
+    );
+
+    CloseHandle(hFile);
+
+    if(hMapping == nullptr)
+        throw std::runtime_error("Unable to map the file");
+
+    // The view remains valid after the mapping handle is closed
+    void * const                            pView(MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+
+    CloseHandle(hMapping);
+
+    if(pView == nullptr)
+        throw std::runtime_error("Unable to map the file");
+
+    _pData = static_cast<unsigned char const *>(pView);
+    _cData = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int const                               fd(open(filename.c_str(), O_RDONLY));
+
+    if(fd == -1)
+        throw std::runtime_error("Unable to open the file");
+
+    struct stat                             info;
+    void *                                  pView(MAP_FAILED);
+
+    if(fstat(fd, &info) == 0 && info.st_size != 0)
+        pView = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if(pView == MAP_FAILED)
+        throw std::runtime_error("Unable to map the file");
+
+    _pData = static_cast<unsigned char const *>(pView);
+    _cData = static_cast<size_t>(info.st_size);
+#endif
+}
+
+inline MemoryMappedFile::~MemoryMappedFile(void) {
+#if (defined _WIN32)
+    UnmapViewOfFile(_pData);
+#else
+    munmap(const_cast<unsigned char *>(_pData), _cData);
+#endif
+}
+
+inline unsigned char const * MemoryMappedFile::data(void) const {
+    return _pData;
+}
+
+inline size_t MemoryMappedFile::size(void) const {
+    return _cData;
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -413,7 +413,7 @@ _nuget_template                             = textwrap.dedent(
             <projectUrl>https://aka.ms/MLFeaturizers</projectUrl>
 
             <contentFiles>
-                <files include="any/any/Data/**/*.json" buildAction="None" copyToOutput="true" />
+                <files include="any/any/Data/**/*.bin" buildAction="None" copyToOutput="true" />
             </contentFiles>
         </metadata>
         <files>
@@ -370,6 +370,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_Transform(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_TransformBatch(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int8_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int8_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <int16> */
@@ -717,6 +774,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_TransformBatch(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int16_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int16_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <int32> */
@@ -1064,6 +1178,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_TransformBatch(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int32_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <int64> */
@@ -1411,6 +1582,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_TransformBatch(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int64_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int64_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <uint8> */
@@ -1758,6 +1986,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_TransformBatch(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint8_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint8_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <uint16> */
@@ -2105,6 +2390,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_TransformBatch(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint16_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint16_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <uint32> */
@@ -2452,6 +2794,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_TransformBatch(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint32_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <uint64> */
@@ -2799,6 +3198,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_TransformBatch(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint64_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint64_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <float> */
@@ -3146,6 +3602,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_TransformBatch(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                float const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <double> */
@@ -3493,6 +4006,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_TransformBatch(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                double const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <bool> */
@@ -3840,6 +4410,63 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_TransformBatch(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                bool const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <string> */
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_Transform(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_TransformBatch(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_TransformBatch(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_TransformBatch(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_TransformBatch(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_TransformBatch(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_TransformBatch(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_TransformBatch(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_TransformBatch(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_TransformBatch(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <double> */
@@ -257,6 +266,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_TransformBatch(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <bool> */
@@ -282,6 +292,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_TransformBatch(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  CatImputerFeaturizer <string> */
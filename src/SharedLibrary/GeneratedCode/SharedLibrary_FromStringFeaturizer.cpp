@@ -370,6 +370,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStrin
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformBatch(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int8_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <int16> */
@@ -717,6 +774,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformBatch(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int16_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <int32> */
@@ -1064,6 +1178,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformBatch(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <int64> */
@@ -1411,6 +1582,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformBatch(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                int64_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <uint8> */
@@ -1758,6 +1986,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformBatch(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint8_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <uint16> */
@@ -2105,6 +2390,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformBatch(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint16_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <uint32> */
@@ -2452,6 +2794,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformBatch(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <uint64> */
@@ -2799,6 +3198,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformBatch(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint64_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <float> */
@@ -3146,6 +3602,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformBatch(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <double> */
@@ -3493,6 +4006,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformBatch(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <bool> */
@@ -3840,6 +4410,63 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStrin
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformBatch(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  FromStringFeaturizer <string> */
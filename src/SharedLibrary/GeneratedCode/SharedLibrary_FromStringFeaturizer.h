@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformBatch(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformBatch(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformBatch(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformBatch(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformBatch(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformBatch(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformBatch(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformBatch(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformBatch(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <double> */
@@ -257,6 +266,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformBatch(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <bool> */
@@ -282,6 +292,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformBatch(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  FromStringFeaturizer <string> */
@@ -370,6 +370,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_Transform(/*in*/ Imp
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int8_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <int16> */
@@ -717,6 +774,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_Transform(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int16_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <int32> */
@@ -1064,6 +1178,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_Transform(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int32_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <int64> */
@@ -1411,6 +1582,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_Transform(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int64_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <uint8> */
@@ -1758,6 +1986,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Transform(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint8_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <uint16> */
@@ -2105,6 +2390,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Transform(/*in*/ I
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint16_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <uint32> */
@@ -2452,6 +2794,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Transform(/*in*/ I
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint32_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <uint64> */
@@ -2799,6 +3198,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Transform(/*in*/ I
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint64_t const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <float> */
@@ -3146,6 +3602,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Transform(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_TransformBatch(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                float const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <double> */
@@ -3493,6 +4006,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Transform(/*in*/ I
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_TransformBatch(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                double const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <bool> */
@@ -3840,6 +4410,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Transform(/*in*/ Imp
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_TransformBatch(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                bool const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <string> */
@@ -4187,6 +4814,63 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Transform(/*in*/ I
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_TransformBatch(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input ? std::string(input) : nonstd::optional<std::string>();
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                bool * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_DestroyTransformer(/
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_Transform(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_DestroyTransformer(
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_Transform(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyTransformer(
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_Transform(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyTransformer(
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_Transform(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyTransformer(
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Transform(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Transform(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Transform(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Transform(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyTransformer(
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Transform(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_TransformBatch(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <double> */
@@ -257,6 +266,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Transform(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_TransformBatch(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <bool> */
@@ -282,6 +292,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyTransformer(/
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Transform(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_TransformBatch(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  ImputationMarkerFeaturizer <string> */
@@ -307,5 +318,6 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Transform(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_TransformBatch(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
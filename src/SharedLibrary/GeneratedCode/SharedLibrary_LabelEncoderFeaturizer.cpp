@@ -355,6 +355,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int8_Transform(/*in*/ LabelEn
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int8_TransformBatch(/*in*/ LabelEncoderFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::int8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int8_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <int16> */
@@ -687,6 +744,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int16_Transform(/*in*/ LabelE
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int16_TransformBatch(/*in*/ LabelEncoderFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::int16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int16_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <int32> */
@@ -1019,6 +1133,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int32_Transform(/*in*/ LabelE
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int32_TransformBatch(/*in*/ LabelEncoderFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::int32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int32_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <int64> */
@@ -1351,6 +1522,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int64_Transform(/*in*/ LabelE
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int64_TransformBatch(/*in*/ LabelEncoderFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::int64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int64_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <uint8> */
@@ -1683,6 +1911,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint8_Transform(/*in*/ LabelE
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint8_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::uint8_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint8_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <uint16> */
@@ -2015,6 +2300,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint16_Transform(/*in*/ Label
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint16_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::uint16_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint16_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <uint32> */
@@ -2347,6 +2689,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint32_Transform(/*in*/ Label
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint32_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::uint32_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint32_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <uint64> */
@@ -2679,6 +3078,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint64_Transform(/*in*/ Label
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint64_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::uint64_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint64_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <float> */
@@ -3011,6 +3467,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_float_Transform(/*in*/ LabelE
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_float_TransformBatch(/*in*/ LabelEncoderFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                float const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <double> */
@@ -3343,6 +3856,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_double_Transform(/*in*/ Label
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_double_TransformBatch(/*in*/ LabelEncoderFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                double const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <bool> */
@@ -3675,6 +4245,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_bool_Transform(/*in*/ LabelEn
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_bool_TransformBatch(/*in*/ LabelEncoderFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<bool>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                bool const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  LabelEncoderFeaturizer <string> */
@@ -4022,6 +4649,63 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_string_Transform(/*in*/ Label
     }
 }
 
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_string_TransformBatch(/*in*/ LabelEncoderFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::LabelEncoderEstimator<std::string>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                char const * const &input(input_ptr[input_index]);
+
+                if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                uint32_t * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int8_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int8_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int8_Transform(/*in*/ LabelEncoderFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int8_TransformBatch(/*in*/ LabelEncoderFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int16_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int16_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int16_Transform(/*in*/ LabelEncoderFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int16_TransformBatch(/*in*/ LabelEncoderFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int32_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int32_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int32_Transform(/*in*/ LabelEncoderFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int32_TransformBatch(/*in*/ LabelEncoderFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int64_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int64_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int64_Transform(/*in*/ LabelEncoderFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_int64_TransformBatch(/*in*/ LabelEncoderFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint8_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint8_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint8_Transform(/*in*/ LabelEncoderFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint8_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint16_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint16_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint16_Transform(/*in*/ LabelEncoderFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint16_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint32_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint32_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint32_Transform(/*in*/ LabelEncoderFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint32_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint64_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint64_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint64_Transform(/*in*/ LabelEncoderFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_uint64_TransformBatch(/*in*/ LabelEncoderFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_float_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_float_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_float_Transform(/*in*/ LabelEncoderFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_float_TransformBatch(/*in*/ LabelEncoderFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <double> */
@@ -257,6 +266,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_double_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_double_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_double_Transform(/*in*/ LabelEncoderFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_double_TransformBatch(/*in*/ LabelEncoderFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <bool> */
@@ -282,6 +292,7 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_bool_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_bool_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_bool_Transform(/*in*/ LabelEncoderFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_bool_TransformBatch(/*in*/ LabelEncoderFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  LabelEncoderFeaturizer <string> */
@@ -307,5 +318,6 @@ FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_string_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_string_CreateTransformerSaveData(/*in*/ LabelEncoderFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_string_Transform(/*in*/ LabelEncoderFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool LabelEncoderFeaturizer_string_TransformBatch(/*in*/ LabelEncoderFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
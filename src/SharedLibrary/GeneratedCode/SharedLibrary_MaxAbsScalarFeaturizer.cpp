@@ -355,6 +355,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int8_Transform(/*in*/ MaxAbsS
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int8_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::int8_t, std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int8_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <int16> */
@@ -687,6 +744,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int16_Transform(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int16_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::int16_t, std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int16_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <uint8> */
@@ -1019,6 +1133,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint8_Transform(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint8_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::uint8_t, std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint8_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <uint16> */
@@ -1351,6 +1522,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint16_Transform(/*in*/ MaxAb
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint16_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::uint16_t, std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint16_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <float> */
@@ -1683,6 +1911,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_float_Transform(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_float_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::float_t, std::float_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                float const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                float * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <int32> */
@@ -2015,6 +2300,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int32_Transform(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int32_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::int32_t, std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int32_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <int64> */
@@ -2347,6 +2689,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int64_Transform(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int64_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::int64_t, std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                int64_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <uint32> */
@@ -2679,6 +3078,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint32_Transform(/*in*/ MaxAb
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint32_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::uint32_t, std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint32_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <uint64> */
@@ -3011,6 +3467,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint64_Transform(/*in*/ MaxAb
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint64_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::uint64_t, std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                uint64_t const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalarFeaturizer <double> */
@@ -3343,6 +3856,63 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_double_Transform(/*in*/ MaxAb
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_double_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+        using TransformerType = Microsoft::Featurizer::Featurizers::MaxAbsScalarEstimator<std::double_t, std::double_t>::TransformerType;
+
+        // The handle is resolved once for the entire batch
+        TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The values are converted in blocks, and each block is transformed with a single call
+        static constexpr std::size_t const block_size = 256;
+
+        std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+        std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+        while(input_items != 0) {
+            std::size_t const block_items(std::min(input_items, block_size));
+
+            for(std::size_t input_index = 0; input_index < block_items; ++input_index) {
+                double const &input(input_ptr[input_index]);
+
+                // No input validation
+
+                // Input
+                inputs[input_index] = input;
+            }
+
+            transformer.execute_batch(inputs.get(), block_items, results.get());
+
+            for(std::size_t output_index = 0; output_index < block_items; ++output_index) {
+                double * const output(output_ptr + output_index);
+                TransformerType::TransformedType const &result(results[output_index]);
+
+                // Output
+                *output = result;
+            }
+
+            input_ptr += block_items;
+            output_ptr += block_items;
+            input_items -= block_items;
+        }
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int8_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int8_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int8_Transform(/*in*/ MaxAbsScalarFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int8_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int16_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int16_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int16_Transform(/*in*/ MaxAbsScalarFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int16_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <uint8> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint8_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint8_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint8_Transform(/*in*/ MaxAbsScalarFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint8_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <uint16> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint16_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint16_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint16_Transform(/*in*/ MaxAbsScalarFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint16_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <float> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_float_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_float_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_float_Transform(/*in*/ MaxAbsScalarFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_float_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <int32> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int32_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int32_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int32_Transform(/*in*/ MaxAbsScalarFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int32_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <int64> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int64_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int64_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int64_Transform(/*in*/ MaxAbsScalarFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_int64_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <uint32> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint32_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint32_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint32_Transform(/*in*/ MaxAbsScalarFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint32_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <uint64> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint64_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint64_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint64_Transform(/*in*/ MaxAbsScalarFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_uint64_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MaxAbsScalarFeaturizer <double> */
@@ -257,5 +266,6 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_double_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_double_CreateTransformerSaveData(/*in*/ MaxAbsScalarFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_double_Transform(/*in*/ MaxAbsScalarFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalarFeaturizer_double_TransformBatch(/*in*/ MaxAbsScalarFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
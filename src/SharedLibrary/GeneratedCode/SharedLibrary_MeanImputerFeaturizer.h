@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int8_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int8_Transform(/*in*/ MeanImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int8_TransformBatch(/*in*/ MeanImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int16_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int16_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int16_Transform(/*in*/ MeanImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int16_TransformBatch(/*in*/ MeanImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int32_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int32_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int32_Transform(/*in*/ MeanImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int32_TransformBatch(/*in*/ MeanImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int64_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int64_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int64_Transform(/*in*/ MeanImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_int64_TransformBatch(/*in*/ MeanImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint8_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint8_Transform(/*in*/ MeanImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint8_TransformBatch(/*in*/ MeanImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint16_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint16_Transform(/*in*/ MeanImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint16_TransformBatch(/*in*/ MeanImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint32_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint32_Transform(/*in*/ MeanImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint32_TransformBatch(/*in*/ MeanImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint64_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint64_Transform(/*in*/ MeanImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_uint64_TransformBatch(/*in*/ MeanImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_float_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_float_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_float_Transform(/*in*/ MeanImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_float_TransformBatch(/*in*/ MeanImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MeanImputerFeaturizer <double> */
@@ -257,5 +266,6 @@ FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_double_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_double_CreateTransformerSaveData(/*in*/ MeanImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_double_Transform(/*in*/ MeanImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MeanImputerFeaturizer_double_TransformBatch(/*in*/ MeanImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int8_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int8_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int8_Transform(/*in*/ MinMaxImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int8_TransformBatch(/*in*/ MinMaxImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int16_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int16_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int16_Transform(/*in*/ MinMaxImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int16_TransformBatch(/*in*/ MinMaxImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int32_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int32_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int32_Transform(/*in*/ MinMaxImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int32_TransformBatch(/*in*/ MinMaxImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int64_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int64_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int64_Transform(/*in*/ MinMaxImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_int64_TransformBatch(/*in*/ MinMaxImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint8_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint8_Transform(/*in*/ MinMaxImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint8_TransformBatch(/*in*/ MinMaxImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint16_DestroyTransformer(/*
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint16_Transform(/*in*/ MinMaxImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint16_TransformBatch(/*in*/ MinMaxImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint32_DestroyTransformer(/*
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint32_Transform(/*in*/ MinMaxImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint32_TransformBatch(/*in*/ MinMaxImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint64_DestroyTransformer(/*
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint64_Transform(/*in*/ MinMaxImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_uint64_TransformBatch(/*in*/ MinMaxImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_float_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_float_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_float_Transform(/*in*/ MinMaxImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_float_TransformBatch(/*in*/ MinMaxImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <double> */
@@ -257,6 +266,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_double_DestroyTransformer(/*
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_double_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_double_Transform(/*in*/ MinMaxImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_double_TransformBatch(/*in*/ MinMaxImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <bool> */
@@ -282,6 +292,7 @@ FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_bool_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_bool_CreateTransformerSaveData(/*in*/ MinMaxImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_bool_Transform(/*in*/ MinMaxImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MinMaxImputerFeaturizer_bool_TransformBatch(/*in*/ MinMaxImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  MinMaxImputerFeaturizer <string> */
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int8_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int8_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int8_Transform(/*in*/ NumericalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int8_TransformBatch(/*in*/ NumericalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <uint8> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint8_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint8_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint8_Transform(/*in*/ NumericalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint8_TransformBatch(/*in*/ NumericalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <int16> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int16_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int16_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int16_Transform(/*in*/ NumericalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int16_TransformBatch(/*in*/ NumericalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <uint16> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint16_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint16_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint16_Transform(/*in*/ NumericalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint16_TransformBatch(/*in*/ NumericalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <int32> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int32_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int32_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int32_Transform(/*in*/ NumericalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int32_TransformBatch(/*in*/ NumericalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <uint32> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint32_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint32_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint32_Transform(/*in*/ NumericalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint32_TransformBatch(/*in*/ NumericalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <int64> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int64_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int64_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int64_Transform(/*in*/ NumericalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_int64_TransformBatch(/*in*/ NumericalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint64_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint64_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint64_Transform(/*in*/ NumericalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_uint64_TransformBatch(/*in*/ NumericalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_float_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_float_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_float_Transform(/*in*/ NumericalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_float_TransformBatch(/*in*/ NumericalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <double> */
@@ -257,6 +266,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_double_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_double_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_double_Transform(/*in*/ NumericalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_double_TransformBatch(/*in*/ NumericalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <bool> */
@@ -282,6 +292,7 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_bool_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_bool_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_bool_Transform(/*in*/ NumericalizeFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_bool_TransformBatch(/*in*/ NumericalizeFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  NumericalizeFeaturizer <string> */
@@ -307,5 +318,6 @@ FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_string_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_string_CreateTransformerSaveData(/*in*/ NumericalizeFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_string_Transform(/*in*/ NumericalizeFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool NumericalizeFeaturizer_string_TransformBatch(/*in*/ NumericalizeFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int8_DestroyTransform
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int8_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int8_Transform(/*in*/ StandardScaleWrapperFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int8_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <int16> */
@@ -57,6 +58,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int16_DestroyTransfor
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int16_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int16_Transform(/*in*/ StandardScaleWrapperFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int16_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <int32> */
@@ -82,6 +84,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int32_DestroyTransfor
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int32_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int32_Transform(/*in*/ StandardScaleWrapperFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int32_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <int64> */
@@ -107,6 +110,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int64_DestroyTransfor
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int64_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int64_Transform(/*in*/ StandardScaleWrapperFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_int64_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <uint8> */
@@ -132,6 +136,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint8_DestroyTransfor
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint8_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint8_Transform(/*in*/ StandardScaleWrapperFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint8_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <uint16> */
@@ -157,6 +162,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint16_DestroyTransfo
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint16_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint16_Transform(/*in*/ StandardScaleWrapperFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint16_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <uint32> */
@@ -182,6 +188,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint32_DestroyTransfo
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint32_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint32_Transform(/*in*/ StandardScaleWrapperFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint32_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <uint64> */
@@ -207,6 +214,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint64_DestroyTransfo
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint64_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint64_Transform(/*in*/ StandardScaleWrapperFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_uint64_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <float> */
@@ -232,6 +240,7 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_float_DestroyTransfor
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_float_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_float_Transform(/*in*/ StandardScaleWrapperFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_float_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
 /* |  StandardScaleWrapperFeaturizer <double> */
@@ -257,5 +266,6 @@ FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_double_DestroyTransfo
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_double_CreateTransformerSaveData(/*in*/ StandardScaleWrapperFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_double_Transform(/*in*/ StandardScaleWrapperFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool StandardScaleWrapperFeaturizer_double_TransformBatch(/*in*/ StandardScaleWrapperFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
@@ -23,3 +23,77 @@ TEST_CASE("double_t") {
         }
     );
 }
+
+TEST_CASE("double_t - TransformBatch") {
+    ErrorInfoHandle * pErrorInfo(nullptr);
+
+    // Create and train the estimator
+    MinMaxScalarFeaturizer_double_EstimatorHandle *pEstimatorHandle(nullptr);
+
+    REQUIRE(MinMaxScalarFeaturizer_double_CreateEstimator(&pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pEstimatorHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::vector<std::double_t> const        training{-1.0, -0.5, 0.0, 1.0};
+    FitResult                               fitResult(0);
+
+    REQUIRE(MinMaxScalarFeaturizer_double_FitBuffer(pEstimatorHandle, training.data(), training.size(), &fitResult, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(MinMaxScalarFeaturizer_double_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Create the transformer
+    MinMaxScalarFeaturizer_double_TransformerHandle * pTransformerHandle(nullptr);
+
+    REQUIRE(MinMaxScalarFeaturizer_double_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pTransformerHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(MinMaxScalarFeaturizer_double_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Inference
+    std::vector<std::double_t> const        inference{2.0, -1.0, 0.0};
+    std::vector<std::double_t>              results(inference.size());
+
+    REQUIRE(MinMaxScalarFeaturizer_double_TransformBatch(pTransformerHandle, inference.data(), inference.size(), results.data(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(results == std::vector<std::double_t>{1.5, 0.0, 0.5});
+
+    // Inputs that span multiple blocks
+    std::vector<std::double_t>              largeInference;
+    std::vector<std::double_t>              largeExpected;
+
+    for(int i = 0; i < 1000; ++i) {
+        largeInference.emplace_back(static_cast<std::double_t>(i % 3) - 1.0);
+        largeExpected.emplace_back(static_cast<std::double_t>(i % 3) / 2.0);
+    }
+
+    std::vector<std::double_t>              largeResults(largeInference.size());
+
+    REQUIRE(MinMaxScalarFeaturizer_double_TransformBatch(pTransformerHandle, largeInference.data(), largeInference.size(), largeResults.data(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(largeResults == largeExpected);
+
+    // An empty batch doesn't produce any output
+    CHECK(MinMaxScalarFeaturizer_double_TransformBatch(pTransformerHandle, nullptr, 0, nullptr, &pErrorInfo));
+    CHECK(pErrorInfo == nullptr);
+
+    // Errors
+    CHECK(MinMaxScalarFeaturizer_double_TransformBatch(pTransformerHandle, nullptr, inference.size(), results.data(), &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    REQUIRE(DestroyErrorInfo(pErrorInfo));
+    pErrorInfo = nullptr;
+
+    CHECK(MinMaxScalarFeaturizer_double_TransformBatch(pTransformerHandle, inference.data(), inference.size(), nullptr, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    REQUIRE(DestroyErrorInfo(pErrorInfo));
+    pErrorInfo = nullptr;
+
+    // Destroy the transformer
+    REQUIRE(MinMaxScalarFeaturizer_double_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
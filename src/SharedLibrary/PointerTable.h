@@ -4,10 +4,14 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <random>
 #include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 #include <assert.h>
 
@@ -19,6 +23,18 @@ namespace Featurizer{
 ///  \brief         Provide an interface to store pointers in exchange of
 ///                 an index to avoid exposing pointers to users
 ///
+///                 Pointers are stored in slots within segments that are
+///                 allocated on demand and never moved, so `Get` doesn't
+///                 need to acquire a lock (it is wait-free). `Add` and
+///                 `Remove` are serialized by a mutex.
+///
+///                 An index encodes the slot in its low bits and a random,
+///                 non-zero tag in its high bits. A slot stores the index that
+///                 currently owns it; `Get` and `Remove` validate the full
+///                 index against this value, which means that stale indexes
+///                 (including those of a slot that has been reused) are
+///                 rejected.
+///
 class PointerTable {
 public:
     // ----------------------------------------------------------------------
@@ -27,6 +43,10 @@ public:
     // |
     // ----------------------------------------------------------------------
     PointerTable(unsigned int seed=(std::random_device())());
+    ~PointerTable(void);
+
+    PointerTable(PointerTable const &) = delete;
+    PointerTable & operator =(PointerTable const &) = delete;
 
     template<typename T>
     size_t Add(const T* const toBeAdded);
@@ -44,14 +64,40 @@ private:
     // ----------------------------------------------------------------------
     using LockGuard                         = std::lock_guard<std::mutex>;
 
+    struct Slot {
+        std::atomic<std::size_t>            index;          // 0 when the slot is available
+        std::atomic<void const *>           pointer;
+    };
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    std::unordered_map<std::size_t, const void *>       m_un;
-    std::mutex                                          m_un_mutex;
+    static constexpr std::size_t            SlotBits = sizeof(std::size_t) * 4;
+    static constexpr std::size_t            SlotMask = (static_cast<std::size_t>(1) << SlotBits) - 1;
+
+    // Segment 'n' contains `FirstSegmentSize << n` slots
+    static constexpr std::size_t            FirstSegmentBits = 6;
+    static constexpr std::size_t            FirstSegmentSize = static_cast<std::size_t>(1) << FirstSegmentBits;
+    static constexpr std::size_t            MaxNumSegments = SlotBits - FirstSegmentBits;
+
+    std::array<std::atomic<Slot *>, MaxNumSegments>     m_segments;
+
+    // The following values are only accessed while `m_mutex` is held
+    std::mutex                                          m_mutex;
+    std::size_t                                         m_numSlots;
+    std::vector<std::size_t>                            m_availableSlots;
     std::mt19937                                        m_mt;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static void GetSegmentAndOffset(std::size_t slot, std::size_t &segment, std::size_t &offset);
+
+    Slot * GetSlot(std::size_t index) const;
 };
 
 
@@ -64,8 +110,17 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline PointerTable::PointerTable(unsigned int seed) : m_mt(seed) {
+inline PointerTable::PointerTable(unsigned int seed) :
+    m_numSlots(0),
+    m_mt(seed) {
+
+    for(auto &segment : m_segments)
+        segment.store(nullptr, std::memory_order_relaxed);
+}
 
+inline PointerTable::~PointerTable(void) {
+    for(auto &segment : m_segments)
+        delete [] segment.load(std::memory_order_relaxed);
 }
 
 
@@ -80,34 +135,69 @@ size_t PointerTable::Add(const T * const templatePointer) {
     size_t                                  empty_index(0);
 
     {
-        LockGuard const                     lock(m_un_mutex);
+        LockGuard const                     lock(m_mutex);
 
         std::ignore = lock;
 
         // since we are controlling where and how to use PointerTable and Add function
-        // it wouldn't worth the cost to have two maps with atomic insertions
+        // it wouldn't worth the cost to maintain a reverse lookup
         // check for duplicates at run time
         // comparing to the chance of adding the same pointer twice,
         // so we would only check for duplicates in debug mode
 #if (defined DEBUG)
-            for (auto pairs : m_un) {
-                assert(pairs.second != toBeAdded);
-            }
+        for(std::size_t slot = 0; slot < m_numSlots; ++slot) {
+            std::size_t                     segment;
+            std::size_t                     offset;
+
+            GetSegmentAndOffset(slot, segment, offset);
+
+            Slot const &                    s(m_segments[segment].load(std::memory_order_relaxed)[offset]);
+
+            assert(s.index.load(std::memory_order_relaxed) == 0 || s.pointer.load(std::memory_order_relaxed) != toBeAdded);
+        }
 #endif
 
-        // size would be changing throughout the process
-        // index zero is reserved
-        std::uniform_int_distribution<size_t>           dist(1,std::numeric_limits<std::size_t>::max());
+        std::size_t                         slot;
+
+        if(m_availableSlots.empty() == false) {
+            slot = m_availableSlots.back();
+            m_availableSlots.pop_back();
+        }
+        else {
+            slot = m_numSlots;
+
+            std::size_t                     segment;
+            std::size_t                     offset;
+
+            GetSegmentAndOffset(slot, segment, offset);
 
-        while(true) {
-            size_t rand_index = dist(m_mt);
-            if (m_un.find(rand_index) == m_un.end()) {
-                empty_index = rand_index;
-                break;
+            if(segment >= MaxNumSegments)
+                throw std::runtime_error("The Pointer table is full!");
+
+            if(offset == 0) {
+                std::unique_ptr<Slot []>    pSegment(new Slot[FirstSegmentSize << segment]);
+
+                for(std::size_t i = 0; i < (FirstSegmentSize << segment); ++i) {
+                    pSegment[i].index.store(0, std::memory_order_relaxed);
+                    pSegment[i].pointer.store(nullptr, std::memory_order_relaxed);
+                }
+
+                m_segments[segment].store(pSegment.release(), std::memory_order_release);
             }
+
+            ++m_numSlots;
         }
+
+        // The tag is never zero, which means that the index is never zero (zero is reserved)
+        std::uniform_int_distribution<size_t>           dist(1, std::numeric_limits<std::size_t>::max() >> SlotBits);
+
+        empty_index = (dist(m_mt) << SlotBits) | slot;
         assert(empty_index != 0);
-        m_un[empty_index] = toBeAdded;
+
+        Slot &                              s(*GetSlot(empty_index));
+
+        s.pointer.store(toBeAdded, std::memory_order_release);
+        s.index.store(empty_index, std::memory_order_release);
     }
 
     return empty_index;
@@ -120,16 +210,18 @@ T* PointerTable::Get(size_t index) {
         throw std::invalid_argument("Invalid query to the Pointer table, index cannot be zero!");
     }
 
-    LockGuard const                         lock(m_un_mutex);
+    Slot const * const                      pSlot(GetSlot(index));
 
-    std::ignore = lock;
+    if(pSlot != nullptr && pSlot->index.load(std::memory_order_acquire) == index) {
+        void const * const                  pointer(pSlot->pointer.load(std::memory_order_acquire));
 
-    std::unordered_map<std::size_t, const void*>::const_iterator found = m_un.find(index);
-    if (found == m_un.end()) {
-        throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
+        // Ensure that the slot wasn't removed (and potentially reused) while
+        // the pointer was being read
+        if(pSlot->index.load(std::memory_order_relaxed) == index)
+            return reinterpret_cast<T*>(const_cast<void*>(pointer));
     }
 
-    return reinterpret_cast<T*>(const_cast<void*>(found->second));
+    throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
 }
 
 
@@ -139,16 +231,49 @@ inline void PointerTable::Remove(size_t index) {
         throw std::invalid_argument("Invalid remove from the Pointer table, index cannot be zero!");
     }
 
-    LockGuard const                         lock(m_un_mutex);
+    LockGuard const                         lock(m_mutex);
 
     std::ignore = lock;
 
-    std::unordered_map<std::size_t, const void*>::const_iterator found = m_un.find(index);
-    if (found == m_un.end()) {
+    Slot * const                            pSlot(GetSlot(index));
+
+    if(pSlot == nullptr || pSlot->index.load(std::memory_order_relaxed) != index) {
         throw std::invalid_argument("Invalid remove from the Pointer table, index pointer not found!");
     }
 
-    m_un.erase(found);
+    pSlot->index.store(0, std::memory_order_release);
+    m_availableSlots.push_back(index & SlotMask);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+/*static*/ inline void PointerTable::GetSegmentAndOffset(std::size_t slot, std::size_t &segment, std::size_t &offset) {
+    // Segment 'n' starts at slot `FirstSegmentSize * (2^n - 1)`
+    std::size_t const                       value((slot >> FirstSegmentBits) + 1);
+
+    segment = 0;
+    while((value >> (segment + 1)) != 0)
+        ++segment;
+
+    offset = slot - FirstSegmentSize * ((static_cast<std::size_t>(1) << segment) - 1);
+}
+
+inline PointerTable::Slot * PointerTable::GetSlot(std::size_t index) const {
+    std::size_t                             segment;
+    std::size_t                             offset;
+
+    GetSegmentAndOffset(index & SlotMask, segment, offset);
+
+    if(segment >= MaxNumSegments)
+        return nullptr;
+
+    Slot * const                            pSegment(m_segments[segment].load(std::memory_order_acquire));
+
+    if(pSegment == nullptr)
+        return nullptr;
+
+    return pSegment + offset;
 }
 
 } // namespace Featurizer
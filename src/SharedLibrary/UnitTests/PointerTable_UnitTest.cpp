@@ -4,8 +4,12 @@
 // ----------------------------------------------------------------------
 
 #define CATCH_CONFIG_MAIN
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <iostream>
+#include <thread>
+#include <unordered_map>
 
 #include "catch.hpp"
 
@@ -63,18 +67,222 @@ TEST_CASE("Check_Randomness_Given_Seed") {
 
     if(sizeof(size_t) == 8) {
         // 64 bit
-        CHECK(i0 == 4095051218741643471UL);
-        CHECK(i1 == 16062175962503177918UL);
-        CHECK(i2 == 3813295331020233847UL);
+        CHECK(i0 == 4095051218504646656UL);
+        CHECK(i1 == 1017893565386194945UL);
+        CHECK(i2 == 16062175958932652034UL);
     }
     else {
         // 32 bit
-        CHECK(i0 == 953453412);
-        CHECK(i1 == 236996815);
-        CHECK(i2 == 3739766768);
+        CHECK(i0 == 953483264);
+        CHECK(i1 == 237043713);
+        CHECK(i2 == 3739746306);
     }
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
 #endif
 }
+
+TEST_CASE("Slot_Reuse") {
+    PointerTable TestTable(5);
+
+    int p0 = 0;
+    int p1 = 1;
+
+    size_t i0 = TestTable.Add<int>(&p0);
+    TestTable.Remove(i0);
+
+    // The slot is reused, but the stale index is not valid
+    size_t i1 = TestTable.Add<int>(&p1);
+
+    CHECK(i1 != i0);
+    CHECK(TestTable.Get<int>(i1) == &p1);
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i0),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Remove(i0),"Invalid remove from the Pointer table, index pointer not found!");
+
+    // Indexes that reference slots that haven't been allocated
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i1 + 1000000),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(std::numeric_limits<size_t>::max()),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Remove(std::numeric_limits<size_t>::max()),"Invalid remove from the Pointer table, index pointer not found!");
+
+    CHECK(TestTable.Get<int>(i1) == &p1);
+}
+
+TEST_CASE("Many_Values") {
+    PointerTable TestTable;
+
+    std::vector<int> values(10000);
+    std::vector<size_t> indexes;
+
+    for(size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+        indexes.push_back(TestTable.Add<int>(&values[i]));
+    }
+
+    for(size_t i = 0; i < values.size(); ++i)
+        CHECK(*TestTable.Get<int>(indexes[i]) == static_cast<int>(i));
+
+    for(size_t i = 0; i < values.size(); i += 2)
+        TestTable.Remove(indexes[i]);
+
+    for(size_t i = 0; i < values.size(); ++i) {
+        if(i % 2 == 0)
+            CHECK_THROWS(TestTable.Get<int>(indexes[i]));
+        else
+            CHECK(TestTable.Get<int>(indexes[i]) == &values[i]);
+    }
+}
+
+TEST_CASE("Multithreaded_Stress") {
+    PointerTable TestTable;
+
+    // Values that are present for the duration of the test
+    std::vector<int> stable(64);
+    std::vector<size_t> stable_indexes;
+
+    for(size_t i = 0; i < stable.size(); ++i) {
+        stable[i] = static_cast<int>(i);
+        stable_indexes.push_back(TestTable.Add<int>(&stable[i]));
+    }
+
+    size_t const num_threads(8);
+    size_t const num_iterations(20000);
+
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> threads;
+
+    for(size_t thread_index = 0; thread_index < num_threads; ++thread_index) {
+        threads.emplace_back(
+            [&TestTable, &stable, &stable_indexes, &errors, thread_index, num_iterations](void) {
+                int local(static_cast<int>(thread_index));
+
+                for(size_t iteration = 0; iteration < num_iterations; ++iteration) {
+                    // Readers
+                    size_t const stable_index(iteration % stable_indexes.size());
+
+                    if(TestTable.Get<int>(stable_indexes[stable_index]) != &stable[stable_index])
+                        ++errors;
+
+                    // Writers
+                    size_t const index(TestTable.Add<int>(&local));
+
+                    if(TestTable.Get<int>(index) != &local)
+                        ++errors;
+
+                    TestTable.Remove(index);
+
+                    // Stale indexes and double removals must be detected
+                    try {
+                        TestTable.Get<int>(index);
+                        ++errors;
+                    }
+                    catch(std::invalid_argument const &) {
+                    }
+
+                    try {
+                        TestTable.Remove(index);
+                        ++errors;
+                    }
+                    catch(std::invalid_argument const &) {
+                    }
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(errors == 0);
+
+    for(size_t i = 0; i < stable.size(); ++i)
+        CHECK(TestTable.Get<int>(stable_indexes[i]) == &stable[i]);
+}
+
+namespace {
+
+// The implementation of `PointerTable` prior to the introduction of lock-free
+// lookups; used as a baseline when benchmarking.
+class MutexPointerTable {
+public:
+    template <typename T>
+    size_t Add(T const *pointer) {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        std::uniform_int_distribution<size_t> dist(1, std::numeric_limits<std::size_t>::max());
+
+        while(true) {
+            size_t const index(dist(m_mt));
+
+            if(m_un.find(index) == m_un.end()) {
+                m_un[index] = pointer;
+                return index;
+            }
+        }
+    }
+
+    template <typename T>
+    T * Get(size_t index) {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const found(m_un.find(index));
+
+        if(found == m_un.end())
+            throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
+
+        return reinterpret_cast<T *>(const_cast<void *>(found->second));
+    }
+
+private:
+    std::unordered_map<std::size_t, void const *> m_un;
+    std::mutex m_mutex;
+    std::mt19937 m_mt;
+};
+
+template <typename TableT>
+double BenchmarkGet(TableT &table, size_t num_threads, size_t num_iterations) {
+    int value(0);
+    size_t const index(table.template Add<int>(&value));
+
+    std::atomic<size_t> sum(0);
+    std::vector<std::thread> threads;
+
+    auto const start(std::chrono::steady_clock::now());
+
+    for(size_t thread_index = 0; thread_index < num_threads; ++thread_index) {
+        threads.emplace_back(
+            [&table, &sum, index, num_iterations](void) {
+                size_t local(0);
+
+                for(size_t iteration = 0; iteration < num_iterations; ++iteration)
+                    local += static_cast<size_t>(*table.template Get<int>(index) + 1);
+
+                sum += local;
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    auto const duration(std::chrono::steady_clock::now() - start);
+
+    CHECK(sum == num_threads * num_iterations);
+
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // anonymous namespace
+
+// This test is not run by default; invoke it with the "[benchmark]" tag
+TEST_CASE("Benchmark_Get", "[.][benchmark]") {
+    size_t const num_iterations(1000000);
+
+    for(size_t num_threads : {1, 4, 16, 32}) {
+        PointerTable table;
+        MutexPointerTable mutex_table;
+
+        double const table_ms(BenchmarkGet(table, num_threads, num_iterations));
+        double const mutex_table_ms(BenchmarkGet(mutex_table, num_threads, num_iterations));
+
+        std::cout << num_threads << " thread(s): PointerTable " << table_ms << "ms, mutex-based table " << mutex_table_ms << "ms\n";
+    }
+}
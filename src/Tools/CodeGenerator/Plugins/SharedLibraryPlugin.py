@@ -7,6 +7,7 @@
 import copy
 import itertools
 import os
+import re
 import sys
 import textwrap
 
@@ -146,6 +147,81 @@ def _CreateInterfaceSubstitutionDict(item, c_data):
     }
 
 
+# ----------------------------------------------------------------------
+def _GetTransformBatchInfo(item, c_data):
+    """\
+    Returns information used to generate the `TransformBatch` method, or None
+    if the input and output types do not support batch transformations.
+
+    Batch transformations are supported when a single input value is passed as
+    a single parameter and a single output value is written through a single
+    pointer that doesn't require explicit destruction; the batch method accepts
+    an array of input values and writes to an array of output values.
+
+    The input values are converted into a block of the transformer's input type
+    and each block is transformed with a single call to `execute_batch`.
+    """
+
+    if c_data.OutputTypeInfoFactory.GetDestroyOutputInfo() is not None:
+        return None
+
+    input_info = c_data.InputTypeInfoFactory.GetInputInfo(
+        "input",
+        getattr(item, "is_input_optional", False),
+        "inputs[input_index] = {};",
+    )
+
+    output_info = c_data.OutputTypeInfoFactory.GetOutputInfo("output")
+
+    if len(input_info.ParameterDecl) != 1 or len(output_info.ParameterDecl) != 1:
+        return None
+
+    # ----------------------------------------------------------------------
+    def ExtractType(parameter_decl, arg_name):
+        match = re.match(
+            r"^/\*[^*]+\*/\s*(?P<type>.+?)\s*{}$".format(re.escape(arg_name)),
+            parameter_decl,
+        )
+        assert match, parameter_decl
+
+        return match.group("type")
+
+    # ----------------------------------------------------------------------
+
+    input_type = ExtractType(input_info.ParameterDecl[0], "input")
+    output_type = ExtractType(output_info.ParameterDecl[0], "output")
+
+    if not output_type.endswith("*"):
+        return None
+
+    return _TransformBatchInfo(
+        [
+            "/*in*/ {} const * input_ptr".format(input_type),
+            "/*in*/ std::size_t input_items",
+            "/*out*/ {} output_ptr".format(output_type),
+        ],
+        input_type,
+        input_info,
+        output_type,
+        output_info,
+    )
+
+
+# ----------------------------------------------------------------------
+class _TransformBatchInfo(object):
+    # ----------------------------------------------------------------------
+    def __init__(self, parameter_decl, input_type, input_info, output_type, output_info):
+        self.ParameterDecl                  = parameter_decl
+        self.InputType                      = input_type
+        self.InputInfo                      = input_info
+        self.OutputType                     = output_type
+        self.OutputInfo                     = output_info
+
+    # ----------------------------------------------------------------------
+    def __repr__(self):
+        return CommonEnvironment.ObjectReprImpl(self)
+
+
 # ----------------------------------------------------------------------
 def _GenerateCommonFiles(open_file_func, output_dir, output_stream):
     with open_file_func(os.path.join(output_dir, "SharedLibrary_Common.h"), "w") as f:
@@ -539,6 +615,19 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
             else:
                 delete_transformed_method = ""
 
+            transform_batch_info = _GetTransformBatchInfo(item, c_data)
+            if transform_batch_info is not None:
+                transform_batch_method = textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBatch(/*in*/ {name}{suffix}TransformerHandle *pHandle, {parameters}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    parameters=", ".join(transform_batch_info.ParameterDecl),
+                    **d
+                )
+            else:
+                transform_batch_method = ""
+
             # Create the custom structs (if any)
             custom_structs = []
 
@@ -653,7 +742,7 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveData(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
                     FEATURIZER_LIBRARY_API bool {name}{suffix}Transform(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {transform_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
-                    {delete_transformed_method}
+                    {transform_batch_method}{delete_transformed_method}
                     """,
                 ).format(
                     construct_params="{},".format(
@@ -676,6 +765,7 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
                     transform_output_param=", ".join(
                         c_data.OutputTypeInfoFactory.GetOutputInfo("output").ParameterDecl,
                     ),
+                    transform_batch_method=transform_batch_method,
                     delete_transformed_method=delete_transformed_method,
                     **d
                 )
@@ -1167,6 +1257,80 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
                 )
             )
 
+            # TransformBatch (optional)
+            transform_batch_info = _GetTransformBatchInfo(item, c_data)
+            if transform_batch_info is not None:
+                content = textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBatch(/*in*/ {name}{suffix}TransformerHandle *pHandle, {params}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                        {method_prefix}
+                            if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+                            if(input_ptr == nullptr && input_items != 0) throw std::invalid_argument("'input_ptr' is null");
+                            if(output_ptr == nullptr && input_items != 0) throw std::invalid_argument("'output_ptr' is null");
+
+                            using TransformerType = Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType;
+
+                            // The handle is resolved once for the entire batch
+                            TransformerType & transformer(*g_pointerTable.Get<TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                            // The values are converted in blocks, and each block is transformed with a single call
+                            static constexpr std::size_t const block_size = 256;
+
+                            std::unique_ptr<TransformerType::InputType []> const inputs(new TransformerType::InputType[std::min(input_items, block_size)]);
+                            std::unique_ptr<TransformerType::TransformedType []> const results(new TransformerType::TransformedType[std::min(input_items, block_size)]);
+
+                            while(input_items != 0) {{
+                                std::size_t const block_items(std::min(input_items, block_size));
+
+                                for(std::size_t input_index = 0; input_index < block_items; ++input_index) {{
+                                    {input_type} const &input(input_ptr[input_index]);
+
+                                    {input_validation}
+
+                                    // Input
+                                    {input_statement}
+                                }}
+
+                                transformer.execute_batch(inputs.get(), block_items, results.get());
+
+                                for(std::size_t output_index = 0; output_index < block_items; ++output_index) {{
+                                    {output_type} const output(output_ptr + output_index);
+                                    TransformerType::TransformedType const &result(results[output_index]);
+
+                                    // Output
+                                    {output_statement}
+                                }}
+
+                                input_ptr += block_items;
+                                output_ptr += block_items;
+                                input_items -= block_items;
+                            }}
+                        {method_suffix}
+                    }}
+
+                    """,
+                ).format(
+                    params=", ".join(transform_batch_info.ParameterDecl),
+                    input_type=transform_batch_info.InputType,
+                    output_type=transform_batch_info.OutputType,
+                    input_validation="// No input validation" if not transform_batch_info.InputInfo.ValidationStatements else StringHelpers.LeftJustify(
+                        transform_batch_info.InputInfo.ValidationStatements.strip(),
+                        16,
+                    ),
+                    input_statement=StringHelpers.LeftJustify(
+                        transform_batch_info.InputInfo.InvocationStatements.strip(),
+                        16,
+                    ),
+                    output_statement=StringHelpers.LeftJustify(
+                        transform_batch_info.OutputInfo.InvocationStatements.strip(),
+                        16,
+                    ),
+                    **d
+                )
+
+                # Don't emit the whitespace-only lines introduced by the indented substitutions
+                f.write(re.sub(r"^[ ]+$", "", content, flags=re.MULTILINE))
+
             # DestroyTransformedData (optional)
             output_info = c_data.OutputTypeInfoFactory.GetDestroyOutputInfo()
             if output_info is not None:
@@ -7,6 +7,8 @@
 
 #include "../Archive.h"
 
+#include <memory>
+
 namespace NS                                = Microsoft::Featurizer;
 
 TEST_CASE("Construct - Serialization") {
@@ -130,3 +132,125 @@ TEST_CASE("Serialization_Based_On_Endianess") {
     CHECK(SerializeOnly(static_cast<std::double_t>(-23)) == expected_result);
     CHECK(SerializeOnly(static_cast<std::float_t>(-23)) == expected_result);
 }
+
+TEST_CASE("Arrays") {
+    std::vector<std::uint32_t> const        ids{1, 2, 3};
+    std::vector<double> const               values{1.5, 2.5};
+    NS::Archive                             out;
+
+    // Misalign the arrays
+    out.serialize(true);
+    out.serialize_array(ids.data(), ids.size());
+    out.serialize(true);
+    out.serialize_array(values.data(), values.size());
+    out.serialize_array(static_cast<char const *>(nullptr), 0);
+    out.serialize(true);
+
+    std::shared_ptr<NS::Archive::ByteArray const> const     pBuffer(std::make_shared<NS::Archive::ByteArray>(out.commit()));
+
+    // The items are aligned relative to the start of the archive
+    CHECK(pBuffer->size() == 1 + 8 + 7 + 12 + 1 + 8 + 11 + 16 + 8 + 8 + 1);
+
+    SECTION("Copied") {
+        NS::Archive                         in(*pBuffer);
+
+        CHECK(in.deserialize<bool>());
+
+        NS::ArchiveArray<std::uint32_t>     inIds(in.deserialize_array<std::uint32_t>());
+
+        CHECK(in.deserialize<bool>());
+
+        NS::ArchiveArray<double>            inValues(in.deserialize_array<double>());
+        NS::ArchiveArray<char>              inChars(in.deserialize_array<char>());
+
+        CHECK(in.deserialize<bool>());
+        CHECK(in.AtEnd());
+
+        CHECK(std::vector<std::uint32_t>(inIds.begin(), inIds.end()) == ids);
+        CHECK(std::vector<double>(inValues.begin(), inValues.end()) == values);
+        CHECK(inChars.empty());
+
+        CHECK(inIds.is_in_place() == false);
+        CHECK(inValues.is_in_place() == false);
+    }
+
+    SECTION("In place") {
+        NS::ArchiveArray<std::uint32_t>     inIds;
+        NS::ArchiveArray<double>            inValues;
+
+        {
+            NS::Archive                     in(pBuffer, pBuffer->data(), pBuffer->size());
+
+            CHECK(in.deserialize<bool>());
+            inIds = in.deserialize_array<std::uint32_t>();
+            CHECK(in.deserialize<bool>());
+            inValues = in.deserialize_array<double>();
+            CHECK(in.deserialize_array<char>().empty());
+            CHECK(in.deserialize<bool>());
+            CHECK(in.AtEnd());
+        }
+
+        REQUIRE(inIds.is_in_place());
+        REQUIRE(inValues.is_in_place());
+
+        CHECK(reinterpret_cast<unsigned char const *>(inIds.data()) == pBuffer->data() + 1 + 8 + 7);
+        CHECK(reinterpret_cast<unsigned char const *>(inValues.data()) == pBuffer->data() + 1 + 8 + 7 + 12 + 1 + 8 + 11);
+
+        // The arrays keep the buffer alive
+        CHECK(pBuffer.use_count() == 3);
+
+        CHECK(inIds.size() == 3);
+        CHECK(inIds.front() == 1);
+        CHECK(inIds[1] == 2);
+        CHECK(inIds.back() == 3);
+        CHECK(inValues == NS::ArchiveArray<double>(values));
+    }
+}
+
+TEST_CASE("ArchiveArray - move") {
+    std::vector<int> const                  items{1, 2, 3};
+    NS::ArchiveArray<int>                   original{std::vector<int>(items)};
+    NS::ArchiveArray<int>                   moved(std::move(original));
+
+    CHECK(std::vector<int>(moved.begin(), moved.end()) == items);
+    CHECK(original.empty());
+    CHECK(original.data() == nullptr);
+    CHECK(original.begin() == original.end());
+
+    std::shared_ptr<int> const              pOwner(std::make_shared<int>(10));
+    NS::ArchiveArray<int>                   inPlace(pOwner, pOwner.get(), 1);
+
+    moved = std::move(inPlace);
+
+    CHECK(moved.is_in_place());
+    CHECK(moved.size() == 1);
+    CHECK(moved.front() == 10);
+    CHECK(inPlace.empty());
+    CHECK(inPlace.data() == nullptr);
+    CHECK(inPlace.is_in_place() == false);
+    CHECK(pOwner.use_count() == 2);
+}
+
+TEST_CASE("Arrays - errors") {
+    NS::Archive                             archive;
+
+    CHECK_THROWS_WITH(archive.serialize_array(static_cast<int const *>(nullptr), 2), "Invalid buffer");
+    CHECK_THROWS_WITH(archive.deserialize_array<int>(), "Invalid mode");
+
+    CHECK_THROWS_WITH(NS::Archive(NS::Archive::BufferOwner(), nullptr, 0), "pOwner");
+
+    std::vector<std::uint32_t> const        ids{1, 2, 3};
+
+    archive.serialize_array(ids.data(), ids.size());
+
+    NS::Archive::ByteArray                  buffer(archive.commit());
+
+    // Missing item
+    buffer.resize(buffer.size() - 1);
+
+    NS::Archive                             in(std::move(buffer));
+
+    CHECK_THROWS_WITH(in.deserialize_array<std::uint32_t>(), "Invalid buffer");
+    CHECK_THROWS_WITH(NS::ArchiveArray<int>(NS::Archive::BufferOwner(), nullptr, 0), "pOwner");
+    CHECK_THROWS_WITH(NS::ArchiveArray<int>(std::make_shared<int>(0), nullptr, 2), "pItems");
+}
@@ -10,6 +10,7 @@
 
 // ----------------------------------------------------------------------
 using Microsoft::Featurizer::AnnotationPtr;
+using Microsoft::Featurizer::AnnotationPtrs;
 using Microsoft::Featurizer::AnnotationMaps;
 using Microsoft::Featurizer::AnnotationMapsPtr;
 using Microsoft::Featurizer::CreateTestAnnotationMapsPtr;
@@ -91,6 +92,47 @@ TEST_CASE("Estimator") {
     CHECK_THROWS_WITH(estimator.get_annotation(99999), "colIndex");
 }
 
+TEST_CASE("AnnotationMap") {
+    Microsoft::Featurizer::AnnotationMap    annotations;
+    std::string                             name("MyEstimator");
+
+    annotations.add_annotation(name.c_str(), std::make_shared<MyAnnotation>(1));
+    annotations.add_annotation("MyEstimator", std::make_shared<MyAnnotation>(2));
+
+    // Keys are copied, so the original name can change
+    name = "Other";
+
+    REQUIRE(annotations.size() == 1);
+    REQUIRE(annotations.get_annotations("MyEstimator").size() == 2);
+    CHECK(annotations.get_annotations("Other").empty());
+
+    CHECK(annotations.get_annotation<MyAnnotation>("MyEstimator")->State == 1);
+    CHECK(annotations.get_annotation<MyAnnotation>("Other") == nullptr);
+
+    Microsoft::Featurizer::AnnotationMap const          copy(annotations);
+
+    CHECK(copy.get_annotation<MyAnnotation>("MyEstimator")->State == 1);
+
+    std::shared_ptr<MyAnnotation> const     pAnnotation(annotations.get_annotation<MyAnnotation>("MyEstimator"));
+    AnnotationPtrs const                    removed(annotations.remove_annotations("MyEstimator"));
+
+    CHECK(removed.size() == 2);
+    CHECK(annotations.get_annotation<MyAnnotation>("MyEstimator") == nullptr);
+
+    // The result shares ownership, so it remains valid after removal
+    CHECK(pAnnotation->State == 1);
+    CHECK(annotations.empty());
+    CHECK(annotations.remove_annotations("MyEstimator").empty());
+    CHECK(copy.size() == 1);
+
+    CHECK_THROWS_WITH(annotations.add_annotation(nullptr, std::make_shared<MyAnnotation>(3)), "name");
+    CHECK_THROWS_WITH(annotations.add_annotation("", std::make_shared<MyAnnotation>(3)), "name");
+    CHECK_THROWS_WITH(annotations.add_annotation("MyEstimator", AnnotationPtr()), "pAnnotation");
+    CHECK_THROWS_WITH(annotations.get_annotation<MyAnnotation>(nullptr), "name");
+    CHECK_THROWS_WITH(annotations.get_annotations(""), "name");
+    CHECK_THROWS_WITH(annotations.remove_annotations(nullptr), "name");
+}
+
 class MyFitEstimator : public Microsoft::Featurizer::FitEstimator<int> {
 public:
     // ----------------------------------------------------------------------
@@ -290,3 +332,24 @@ TEST_CASE("TransformerEstimator") {
 
     CHECK_THROWS_WITH(MyTransformerEstimator(true, true).create_transformer(), "Invalid result");
 }
+
+TEST_CASE("StandardTransformer - execute_batch") {
+    MyTransformerEstimator::MyTransformer   transformer;
+
+    int const                               inputs[] = { 1, 2, 3, 4, 5 };
+    bool                                    outputs[] = { false, true, false, true, false };
+
+    transformer.execute_batch(inputs, 5, outputs);
+
+    CHECK(outputs[0] == true);
+    CHECK(outputs[1] == false);
+    CHECK(outputs[2] == true);
+    CHECK(outputs[3] == false);
+    CHECK(outputs[4] == true);
+
+    // No items
+    transformer.execute_batch(nullptr, 0, nullptr);
+
+    CHECK_THROWS_WITH(transformer.execute_batch(nullptr, 5, outputs), "pInputs");
+    CHECK_THROWS_WITH(transformer.execute_batch(inputs, 5, nullptr), "pOutputs");
+}
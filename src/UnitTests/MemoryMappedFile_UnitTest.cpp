@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include "../MemoryMappedFile.h"
+
+namespace NS                                = Microsoft::Featurizer;
+
+std::string WriteFile(std::string const &filename, NS::Archive::ByteArray const &data) {
+    std::ofstream                           stream(filename, std::ios::binary);
+
+    stream.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+    return filename;
+}
+
+TEST_CASE("Mapped archive") {
+    std::vector<std::uint32_t> const        ids{1, 2, 3, 4, 5};
+    NS::Archive                             out;
+
+    out.serialize(static_cast<std::uint16_t>(10));
+    out.serialize_array(ids.data(), ids.size());
+
+    std::string const                       filename(WriteFile("MemoryMappedFile_UnitTest.bin", out.commit()));
+    NS::ArchiveArray<std::uint32_t>         inIds;
+
+    {
+        NS::Archive                         in(NS::CreateMappedArchive(filename));
+
+        CHECK(in.deserialize<std::uint16_t>() == 10);
+        inIds = in.deserialize_array<std::uint32_t>();
+        CHECK(in.AtEnd());
+    }
+
+    // The array keeps the mapping alive after the archive is destroyed
+    CHECK(inIds.is_in_place());
+    CHECK(std::vector<std::uint32_t>(inIds.begin(), inIds.end()) == ids);
+
+    inIds = NS::ArchiveArray<std::uint32_t>();
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Errors") {
+    CHECK_THROWS_WITH(NS::MemoryMappedFile("MemoryMappedFile_UnitTest.DoesNotExist"), "Unable to open the file");
+
+    std::string const                       filename(WriteFile("MemoryMappedFile_UnitTest.empty", NS::Archive::ByteArray()));
+
+    CHECK_THROWS_WITH(NS::MemoryMappedFile(filename), "Unable to map the file");
+    std::remove(filename.c_str());
+}